@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AIDM/AIDMGameplayEventSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+void UAIDMGameplayEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Actors spawned at runtime (AI Director content, dropped loot) are bound as they appear
+    if (UWorld* World = GetWorld())
+    {
+        ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+            FOnActorSpawned::FDelegate::CreateUObject(this, &UAIDMGameplayEventSubsystem::BindEventSource));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AIDMGameplayEventSubsystem: Initialized"));
+}
+
+void UAIDMGameplayEventSubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+
+    for (FOnAIDMGameplayEventNative& Listeners : NativeListeners)
+    {
+        Listeners.Clear();
+    }
+
+    Super::Deinitialize();
+}
+
+void UAIDMGameplayEventSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Level-placed actors never go through the spawn handler; bind them once here
+    for (TActorIterator<AEnemyActor> It(&InWorld); It; ++It)
+    {
+        BindEventSource(*It);
+    }
+    for (TActorIterator<ALootPickupActor> It(&InWorld); It; ++It)
+    {
+        BindEventSource(*It);
+    }
+}
+
+UAIDMGameplayEventSubsystem* UAIDMGameplayEventSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAIDMGameplayEventSubsystem>() : nullptr;
+}
+
+void UAIDMGameplayEventSubsystem::Publish(const FAIDMGameplayEvent& Event)
+{
+    if (Event.Type == EAIDMGameplayEventType::None || Event.Type == EAIDMGameplayEventType::Count)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AIDMGameplayEventSubsystem: Ignoring event without a type (target %s)"), *Event.TargetID);
+        return;
+    }
+
+    NativeListeners[static_cast<int32>(Event.Type)].Broadcast(Event);
+    OnGameplayEvent.Broadcast(Event);
+}
+
+FOnAIDMGameplayEventNative& UAIDMGameplayEventSubsystem::OnEvent(EAIDMGameplayEventType Type)
+{
+    check(Type < EAIDMGameplayEventType::Count);
+    return NativeListeners[static_cast<int32>(Type)];
+}
+
+void UAIDMGameplayEventSubsystem::BindEventSource(AActor* Actor)
+{
+    if (AEnemyActor* Enemy = Cast<AEnemyActor>(Actor))
+    {
+        Enemy->OnEnemyDeath.AddUniqueDynamic(this, &UAIDMGameplayEventSubsystem::HandleEnemyDeath);
+    }
+    else if (ALootPickupActor* Loot = Cast<ALootPickupActor>(Actor))
+    {
+        Loot->OnLootPickedUp.AddUniqueDynamic(this, &UAIDMGameplayEventSubsystem::HandleLootPickedUp);
+    }
+}
+
+void UAIDMGameplayEventSubsystem::HandleEnemyDeath(AEnemyActor* Enemy)
+{
+    if (!Enemy)
+    {
+        return;
+    }
+
+    const FEnemyData EnemyData = Enemy->GetEnemyData();
+
+    FAIDMGameplayEvent Event;
+    Event.Type = EAIDMGameplayEventType::EnemyKilled;
+    Event.TargetID = EnemyData.EnemyID;
+    Event.TargetName = EnemyData.DisplayName;
+    Publish(Event);
+}
+
+void UAIDMGameplayEventSubsystem::HandleLootPickedUp(const FLootItemData& LootItem, AActor* Collector)
+{
+    FAIDMGameplayEvent Event;
+    Event.Type = EAIDMGameplayEventType::LootPickedUp;
+    Event.TargetID = LootItem.ItemID;
+    Event.TargetName = LootItem.ItemName;
+    Event.Count = FMath::Max(LootItem.Quantity, 1);
+    Event.Instigator = Collector;
+    Publish(Event);
+}
@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AIDM/AIDMSymbolTable.h"
+#include "Misc/ScopeRWLock.h"
+
+FAIDMSymbolTable& FAIDMSymbolTable::Get()
+{
+    static FAIDMSymbolTable Instance;
+    return Instance;
+}
+
+FAIDMId FAIDMSymbolTable::Intern(EAIDMSymbolKind Kind, const FString& Name)
+{
+    if (Name.IsEmpty())
+    {
+        return FAIDMId();
+    }
+
+    FKindTable& Table = Tables[static_cast<int32>(Kind)];
+
+    {
+        FReadScopeLock ReadLock(Lock);
+        if (const int32* Existing = Table.Lookup.Find(Name))
+        {
+            return FAIDMId(*Existing);
+        }
+    }
+
+    FWriteScopeLock WriteLock(Lock);
+
+    // Another thread may have interned the name between the two locks
+    if (const int32* Existing = Table.Lookup.Find(Name))
+    {
+        return FAIDMId(*Existing);
+    }
+
+    const int32 NewIndex = Table.Names.Add(Name);
+    Table.Lookup.Add(Name, NewIndex);
+    return FAIDMId(NewIndex);
+}
+
+FAIDMId FAIDMSymbolTable::Find(EAIDMSymbolKind Kind, const FString& Name) const
+{
+    if (Name.IsEmpty())
+    {
+        return FAIDMId();
+    }
+
+    FReadScopeLock ReadLock(Lock);
+    const int32* Existing = Tables[static_cast<int32>(Kind)].Lookup.Find(Name);
+    return Existing ? FAIDMId(*Existing) : FAIDMId();
+}
+
+FString FAIDMSymbolTable::ToString(EAIDMSymbolKind Kind, FAIDMId Id) const
+{
+    FReadScopeLock ReadLock(Lock);
+    const FKindTable& Table = Tables[static_cast<int32>(Kind)];
+    return Table.Names.IsValidIndex(Id.Index) ? Table.Names[Id.Index] : FString();
+}
+
+int32 FAIDMSymbolTable::Num(EAIDMSymbolKind Kind) const
+{
+    FReadScopeLock ReadLock(Lock);
+    return Tables[static_cast<int32>(Kind)].Names.Num();
+}
+
+void FAIDMSymbolTable::Reset()
+{
+    {
+        FWriteScopeLock WriteLock(Lock);
+        for (FKindTable& Table : Tables)
+        {
+            Table.Names.Empty();
+            Table.Lookup.Empty();
+        }
+    }
+
+    // Listeners re-intern their IDs, so they must not run under the write lock
+    ResetDelegate.Broadcast();
+}
+
+TArray<FString> FAIDMSymbolTable::ExportSymbols(EAIDMSymbolKind Kind) const
+{
+    FReadScopeLock ReadLock(Lock);
+    return Tables[static_cast<int32>(Kind)].Names;
+}
+
+void FAIDMSymbolTable::ImportSymbols(EAIDMSymbolKind Kind, const TArray<FString>& SavedSymbols, TArray<FAIDMId>& OutRemap)
+{
+    OutRemap.Reset(SavedSymbols.Num());
+    for (const FString& Name : SavedSymbols)
+    {
+        OutRemap.Add(Intern(Kind, Name));
+    }
+}
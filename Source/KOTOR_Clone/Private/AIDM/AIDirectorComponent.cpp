@@ -1,12 +1,22 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AIDM/AIDirectorComponent.h"
+#include "AIDM/AIDMGameplayEventSubsystem.h"
+#include "Player/InteractableRegistrySubsystem.h"
+#include "Enemies/EnemyActor.h"
+#include "Loot/LootPickupSystem.h"
+#include "NPCs/ProceduralNPCActor.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "Components/StaticMeshComponent.h"
 #include "DrawDebugHelpers.h"
 
+// Marks actors the director spawned itself; only these go back to the pool
+static const FName AIDirectorPooledTag(TEXT("AIDirectorPooled"));
+
 UAIDirectorComponent::UAIDirectorComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
@@ -23,6 +33,15 @@ UAIDirectorComponent::UAIDirectorComponent()
     bAutoSpawnEnemies = true;
     bAutoSpawnLoot = true;
     
+    // Spawn budget settings
+    bTimeSliceSpawning = true;
+    SpawnBudgetMs = 2.0f;
+    SpawnedThisLayout = 0;
+    
+    // Actor pool settings
+    bUseActorPool = true;
+    MaxPooledActorsPerClass = 32;
+    
     // Debug settings
     bDebugMode = false;
     bShowSpawnPointDebug = false;
@@ -52,7 +71,13 @@ void UAIDirectorComponent::BeginPlay()
 
 void UAIDirectorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (CampaignLoader)
+    {
+        CampaignLoader->OnCampaignAsyncLoadFinished.RemoveDynamic(this, &UAIDirectorComponent::HandleCampaignAsyncLoadFinished);
+    }
+    
     ClearAllSpawnedContent();
+    EmptyActorPool();
     Super::EndPlay(EndPlayReason);
 }
 
@@ -60,6 +85,12 @@ void UAIDirectorComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
+    // Stream queued layout content in within the frame budget
+    if (PendingSpawns.Num() > 0)
+    {
+        ProcessSpawnQueue(SpawnBudgetMs / 1000.0);
+    }
+    
     // Debug drawing
     if (bDebugMode && bShowSpawnPointDebug)
     {
@@ -82,6 +113,46 @@ bool UAIDirectorComponent::InitializeWithCampaign(const FString& CampaignFilePat
         return false;
     }
     
+    FinishCampaignInitialization();
+    
+    return true;
+}
+
+bool UAIDirectorComponent::InitializeWithCampaignAsync(const FString& CampaignFilePath)
+{
+    if (!CampaignLoader)
+    {
+        UE_LOG(LogTemp, Error, TEXT("AIDirectorComponent: CampaignLoader is null"));
+        return false;
+    }
+    
+    CampaignLoader->OnCampaignAsyncLoadFinished.AddUniqueDynamic(this, &UAIDirectorComponent::HandleCampaignAsyncLoadFinished);
+    
+    if (!CampaignLoader->LoadCampaignAsync(CampaignFilePath))
+    {
+        CampaignLoader->OnCampaignAsyncLoadFinished.RemoveDynamic(this, &UAIDirectorComponent::HandleCampaignAsyncLoadFinished);
+        UE_LOG(LogTemp, Error, TEXT("AIDirectorComponent: Failed to start async load of %s"), *CampaignFilePath);
+        return false;
+    }
+    
+    return true;
+}
+
+void UAIDirectorComponent::HandleCampaignAsyncLoadFinished(const FString& JsonFilePath, bool bSuccess)
+{
+    CampaignLoader->OnCampaignAsyncLoadFinished.RemoveDynamic(this, &UAIDirectorComponent::HandleCampaignAsyncLoadFinished);
+    
+    if (!bSuccess)
+    {
+        UE_LOG(LogTemp, Error, TEXT("AIDirectorComponent: Failed to load campaign from %s"), *JsonFilePath);
+        return;
+    }
+    
+    FinishCampaignInitialization();
+}
+
+void UAIDirectorComponent::FinishCampaignInitialization()
+{
     // Initialize state
     bIsInitialized = true;
     CurrentPlanetIndex = 0; // Start with first planet
@@ -95,6 +166,7 @@ bool UAIDirectorComponent::InitializeWithCampaign(const FString& CampaignFilePat
     
     // Broadcast campaign loaded event
     OnCampaignLoaded.Broadcast(Campaign);
+    PublishLayoutEntered();
     
     UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Successfully initialized with campaign: %s"), 
            *Campaign.Config.StorySeed);
@@ -104,8 +176,24 @@ bool UAIDirectorComponent::InitializeWithCampaign(const FString& CampaignFilePat
     {
         SpawnContentForCurrentLayout();
     }
+}
+
+void UAIDirectorComponent::PublishLayoutEntered() const
+{
+    UAIDMGameplayEventSubsystem* EventBus = UAIDMGameplayEventSubsystem::Get(this);
+    if (!EventBus || CurrentLayoutName.IsEmpty())
+    {
+        return;
+    }
     
-    return true;
+    const FCampaignPlan& Campaign = CampaignLoader->GetCurrentCampaign();
+    
+    FAIDMGameplayEvent Event;
+    Event.Type = EAIDMGameplayEventType::LayoutEntered;
+    Event.TargetID = CurrentLayoutName;
+    Event.TargetName = Campaign.Planets.IsValidIndex(CurrentPlanetIndex) ? Campaign.Planets[CurrentPlanetIndex].Name : FString();
+    Event.Instigator = GetOwner();
+    EventBus->Publish(Event);
 }
 
 bool UAIDirectorComponent::ChangeToPlanet(int32 PlanetIndex)
@@ -143,6 +231,7 @@ bool UAIDirectorComponent::ChangeToPlanet(int32 PlanetIndex)
         // Call blueprint events
         OnPlanetChangedEvent(OldPlanetIndex, CurrentPlanetIndex);
         OnLayoutChangedEvent(OldLayout, CurrentLayoutName);
+        PublishLayoutEntered();
         
         // Auto-spawn content if enabled
         if (bAutoSpawnOnLayoutChange)
@@ -169,17 +258,11 @@ bool UAIDirectorComponent::ChangeToLayout(const FString& LayoutName)
     }
     
     // Verify layout exists on current planet
-    const FPlanetData CurrentPlanet = GetCurrentPlanetData();
-    bool bLayoutFound = false;
-    
-    for (const FMapLayout& Layout : CurrentPlanet.Layouts)
+    const FPlanetData* CurrentPlanet = FindCurrentPlanetData();
+    const bool bLayoutFound = CurrentPlanet && CurrentPlanet->Layouts.ContainsByPredicate([&LayoutName](const FMapLayout& Layout)
     {
-        if (Layout.Name == LayoutName)
-        {
-            bLayoutFound = true;
-            break;
-        }
-    }
+        return Layout.Name == LayoutName;
+    });
     
     if (!bLayoutFound)
     {
@@ -196,6 +279,7 @@ bool UAIDirectorComponent::ChangeToLayout(const FString& LayoutName)
     // Broadcast events
     OnLayoutChanged.Broadcast(OldLayout, CurrentLayoutName);
     OnLayoutChangedEvent(OldLayout, CurrentLayoutName);
+    PublishLayoutEntered();
     
     // Auto-spawn content if enabled
     if (bAutoSpawnOnLayoutChange)
@@ -233,38 +317,87 @@ void UAIDirectorComponent::SpawnContentForCurrentLayout(bool bForceRespawn)
         ClearAllSpawnedContent();
     }
     
-    // Spawn different types of content
+    // Queue different types of content (each request reserves its spawn point)
+    const int32 FirstNewRequest = PendingSpawns.Num();
+    
     if (bAutoSpawnNPCs)
     {
-        SpawnNPCsForLayout();
+        QueueNPCsForLayout();
     }
     
     if (bAutoSpawnEnemies)
     {
-        SpawnEnemiesForLayout();
+        QueueEnemiesForLayout();
     }
     
     if (bAutoSpawnLoot)
     {
-        SpawnLootForLayout();
+        QueueLootForLayout();
     }
     
     SpawnQuestsForLayout();
     
+    // Highest priority first: enemies, then NPCs, then loot, nearest to the player within each.
+    // The queue is stored in reverse so ProcessSpawnQueue pops the next request off the back.
+    const FVector Origin = GetSpawnPriorityOrigin();
+    for (int32 Index = FirstNewRequest; Index < PendingSpawns.Num(); ++Index)
+    {
+        FAIDirectorSpawnRequest& Request = PendingSpawns[Index];
+        Request.DistanceSq = FVector::DistSquared(Origin, RegisteredSpawnPoints[Request.SpawnPointIndex].Location);
+    }
+    PendingSpawns.Sort([](const FAIDirectorSpawnRequest& A, const FAIDirectorSpawnRequest& B)
+    {
+        if (A.Kind != B.Kind)
+        {
+            return A.Kind > B.Kind;
+        }
+        return A.DistanceSq > B.DistanceSq;
+    });
+    
     if (bDebugMode)
     {
-        LogDirectorState();
+        UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Queued %d spawns for layout %s"), PendingSpawns.Num(), *CurrentLayoutName);
+    }
+    
+    if (!bTimeSliceSpawning)
+    {
+        ProcessSpawnQueue(TNumericLimits<double>::Max());
+    }
+    else if (PendingSpawns.Num() == 0)
+    {
+        // Nothing to stream in; still report the layout as populated
+        ProcessSpawnQueue(0.0);
     }
 }
 
+void UAIDirectorComponent::CancelPendingSpawns()
+{
+    // Release the reservations of requests that never spawned
+    for (const FAIDirectorSpawnRequest& Request : PendingSpawns)
+    {
+        if (RegisteredSpawnPoints.IsValidIndex(Request.SpawnPointIndex))
+        {
+            RegisteredSpawnPoints[Request.SpawnPointIndex].bIsOccupied = false;
+        }
+    }
+    
+    PendingSpawns.Empty();
+    SpawnedThisLayout = 0;
+    SpawnQueueSerial++;
+}
+
 void UAIDirectorComponent::ClearAllSpawnedContent()
 {
-    // Destroy all spawned actors
+    PendingSpawns.Empty();
+    SpawnedThisLayout = 0;
+    SpawnQueueSerial++;
+    
+    // Deactivate director-spawned actors into the pool; destroy the rest
     for (AActor* Actor : SpawnedActors)
     {
         if (IsValid(Actor))
         {
-            Actor->Destroy();
+            ReleasePooledActor(Actor);
         }
     }
     
@@ -284,24 +417,31 @@ void UAIDirectorComponent::ClearAllSpawnedContent()
 }
 
 FPlanetData UAIDirectorComponent::GetCurrentPlanetData() const
+{
+    const FPlanetData* Planet = FindCurrentPlanetData();
+    return Planet ? *Planet : FPlanetData();
+}
+
+const FPlanetData* UAIDirectorComponent::FindCurrentPlanetData() const
 {
     if (!bIsInitialized || !CampaignLoader)
     {
-        return FPlanetData();
+        return nullptr;
     }
     
-    return CampaignLoader->GetPlanetData(CurrentPlanetIndex);
+    return CampaignLoader->FindPlanetData(CurrentPlanetIndex);
 }
 
 FMapLayout UAIDirectorComponent::GetCurrentLayoutData() const
 {
-    const FPlanetData Planet = GetCurrentPlanetData();
-    
-    for (const FMapLayout& Layout : Planet.Layouts)
+    if (const FPlanetData* Planet = FindCurrentPlanetData())
     {
-        if (Layout.Name == CurrentLayoutName)
+        for (const FMapLayout& Layout : Planet->Layouts)
         {
-            return Layout;
+            if (Layout.Name == CurrentLayoutName)
+            {
+                return Layout;
+            }
         }
     }
     
@@ -323,159 +463,256 @@ TArray<FAIDirectorSpawnData> UAIDirectorComponent::GetSpawnPointsByType(const FS
     return Result;
 }
 
-void UAIDirectorComponent::SpawnNPCsForLayout()
+void UAIDirectorComponent::QueueNPCsForLayout()
 {
-    // Get NPCs for current location
-    TArray<FNPCData> NPCs = CampaignLoader->GetNPCsForLocation(CurrentPlanetIndex, CurrentLayoutName);
+    // Get NPCs for current location (view into the loader's index, no copy)
+    TArrayView<const int32> NPCIndices = CampaignLoader->GetNPCIndicesForLocationView(CurrentPlanetIndex, FName(*CurrentLayoutName, FNAME_Find));
     
-    for (const FNPCData& NPCData : NPCs)
+    for (const int32 NPCIndex : NPCIndices)
     {
-        FAIDirectorSpawnData* SpawnPoint = FindAvailableSpawnPoint(TEXT("NPC"), CurrentLayoutName);
-        if (SpawnPoint)
+        const int32 SpawnPointIndex = FindAvailableSpawnPointIndex(TEXT("NPC"), CurrentLayoutName);
+        if (SpawnPointIndex == INDEX_NONE)
         {
-            // Try blueprint implementation first
-            APawn* SpawnedNPC = OnSpawnNPC(NPCData, *SpawnPoint);
-            
-            if (!SpawnedNPC && DefaultNPCClass)
-            {
-                // Fallback to default spawning
-                TSubclassOf<APawn> NPCClass = GetNPCClassForSpecies(NPCData.Species);
-                if (!NPCClass)
-                {
-                    NPCClass = DefaultNPCClass;
-                }
-                
-                FActorSpawnParameters SpawnParams;
-                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-                
-                SpawnedNPC = GetWorld()->SpawnActor<APawn>(NPCClass, SpawnPoint->Location, SpawnPoint->Rotation, SpawnParams);
-            }
-            
-            if (SpawnedNPC)
-            {
-                SpawnPoint->bIsOccupied = true;
-                SpawnPoint->SpawnedActor = SpawnedNPC;
-                SpawnedActors.Add(SpawnedNPC);
-                
-                SetupSpawnedActor(SpawnedNPC, TEXT("NPC"), &NPCData);
-                OnContentSpawned.Broadcast(SpawnedNPC);
-                
-                if (bDebugMode)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned NPC %s"), *NPCData.Name);
-                }
-            }
+            break;
         }
+        
+        RegisteredSpawnPoints[SpawnPointIndex].bIsOccupied = true;
+        PendingSpawns.Add(FAIDirectorSpawnRequest{EAIDirectorSpawnKind::NPC, NPCIndex, SpawnPointIndex});
     }
 }
 
-void UAIDirectorComponent::SpawnEnemiesForLayout()
+void UAIDirectorComponent::QueueEnemiesForLayout()
 {
-    // Get enemies for current planet
-    TArray<FCampaignEnemyData> Enemies = CampaignLoader->GetEnemiesForPlanet(CurrentPlanetIndex);
+    // Get enemies for current planet (view, no copy)
+    TArrayView<const FCampaignEnemyData> Enemies = CampaignLoader->GetEnemiesForPlanetView(CurrentPlanetIndex);
     
     // Limit number of enemies spawned (for performance)
     int32 MaxEnemies = FMath::Min(Enemies.Num(), 5);
     
     for (int32 i = 0; i < MaxEnemies; i++)
     {
-        FAIDirectorSpawnData* SpawnPoint = FindAvailableSpawnPoint(TEXT("Enemy"), CurrentLayoutName);
-        if (SpawnPoint && i < Enemies.Num())
+        const int32 SpawnPointIndex = FindAvailableSpawnPointIndex(TEXT("Enemy"), CurrentLayoutName);
+        if (SpawnPointIndex == INDEX_NONE)
         {
-            const FCampaignEnemyData& EnemyData = Enemies[i];
-            
-            // Try blueprint implementation first
-            APawn* SpawnedEnemy = OnSpawnEnemy(EnemyData, *SpawnPoint);
-            
-            if (!SpawnedEnemy && DefaultEnemyClass)
-            {
-                // Fallback to default spawning
-                TSubclassOf<APawn> EnemyClass = GetEnemyClassForSpecies(EnemyData.Species);
-                if (!EnemyClass)
-                {
-                    EnemyClass = DefaultEnemyClass;
-                }
-                
-                FActorSpawnParameters SpawnParams;
-                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-                
-                SpawnedEnemy = GetWorld()->SpawnActor<APawn>(EnemyClass, SpawnPoint->Location, SpawnPoint->Rotation, SpawnParams);
-            }
-            
-            if (SpawnedEnemy)
+            break;
+        }
+        
+        RegisteredSpawnPoints[SpawnPointIndex].bIsOccupied = true;
+        PendingSpawns.Add(FAIDirectorSpawnRequest{EAIDirectorSpawnKind::Enemy, i, SpawnPointIndex});
+    }
+}
+
+void UAIDirectorComponent::QueueLootForLayout()
+{
+    // For now, spawn some basic loot at every free loot spawn point
+    for (int32 SpawnPointIndex = 0; SpawnPointIndex < RegisteredSpawnPoints.Num(); ++SpawnPointIndex)
+    {
+        FAIDirectorSpawnData& SpawnPoint = RegisteredSpawnPoints[SpawnPointIndex];
+        if (SpawnPoint.SpawnType == TEXT("Loot") && SpawnPoint.LayoutName == CurrentLayoutName && !SpawnPoint.bIsOccupied)
+        {
+            SpawnPoint.bIsOccupied = true;
+            PendingSpawns.Add(FAIDirectorSpawnRequest{EAIDirectorSpawnKind::Loot, INDEX_NONE, SpawnPointIndex});
+        }
+    }
+}
+
+void UAIDirectorComponent::ProcessSpawnQueue(double BudgetSeconds)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    
+    // Resolve the data views once per batch; requests index into them
+    TArrayView<const FNPCData> NPCs = CampaignLoader->GetNPCsForPlanetView(CurrentPlanetIndex);
+    TArrayView<const FCampaignEnemyData> Enemies = CampaignLoader->GetEnemiesForPlanetView(CurrentPlanetIndex);
+    
+    // Requests are popped before their spawn hooks run, so hooks that queue, cancel or clear
+    // content mid-batch only ever see the entries that are still pending
+    const uint32 BatchQueueSerial = SpawnQueueSerial;
+    
+    // Always make progress, even if a single spawn blows the budget
+    int32 Processed = 0;
+    while (PendingSpawns.Num() > 0)
+    {
+        if (Processed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+        
+        // Copies: Blueprint spawn hooks may register spawn points mid-batch
+        const FAIDirectorSpawnRequest Request = PendingSpawns.Pop(EAllowShrinking::No);
+        const FAIDirectorSpawnData SpawnPoint = RegisteredSpawnPoints[Request.SpawnPointIndex];
+        Processed++;
+        
+        AActor* SpawnedActor = nullptr;
+        switch (Request.Kind)
+        {
+        case EAIDirectorSpawnKind::Enemy:
+            SpawnedActor = Enemies.IsValidIndex(Request.DataIndex) ? SpawnEnemyAt(Enemies[Request.DataIndex], SpawnPoint) : nullptr;
+            break;
+        case EAIDirectorSpawnKind::NPC:
+            SpawnedActor = NPCs.IsValidIndex(Request.DataIndex) ? SpawnNPCAt(NPCs[Request.DataIndex], SpawnPoint) : nullptr;
+            break;
+        case EAIDirectorSpawnKind::Loot:
+            SpawnedActor = SpawnLootAt(SpawnPoint);
+            break;
+        }
+        
+        // The spawn hook cleared or cancelled the queue (e.g. changed layout): this actor belongs to the
+        // old content, and anything queued since indexes fresh data views, so end the batch here
+        if (SpawnQueueSerial != BatchQueueSerial)
+        {
+            if (SpawnedActor)
             {
-                SpawnPoint->bIsOccupied = true;
-                SpawnPoint->SpawnedActor = SpawnedEnemy;
-                SpawnedActors.Add(SpawnedEnemy);
-                
-                SetupSpawnedActor(SpawnedEnemy, TEXT("Enemy"), &EnemyData);
-                OnContentSpawned.Broadcast(SpawnedEnemy);
-                
-                if (bDebugMode)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned Enemy %s"), *EnemyData.Name);
-                }
+                ReleasePooledActor(SpawnedActor);
             }
+            return;
         }
+        
+        FAIDirectorSpawnData& ReservedPoint = RegisteredSpawnPoints[Request.SpawnPointIndex];
+        if (SpawnedActor)
+        {
+            ReservedPoint.SpawnedActor = SpawnedActor;
+            SpawnedActors.Add(SpawnedActor);
+            SpawnedThisLayout++;
+        }
+        else
+        {
+            // Nothing spawned; free the reservation
+            ReservedPoint.bIsOccupied = false;
+        }
+    }
+    
+    if (PendingSpawns.Num() == 0)
+    {
+        const int32 SpawnedCount = SpawnedThisLayout;
+        SpawnedThisLayout = 0;
+        
+        if (bDebugMode)
+        {
+            UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Finished spawning %d actors for layout %s"), SpawnedCount, *CurrentLayoutName);
+            LogDirectorState();
+        }
+        
+        OnLayoutContentSpawned.Broadcast(CurrentLayoutName, SpawnedCount);
     }
 }
 
-void UAIDirectorComponent::SpawnLootForLayout()
+APawn* UAIDirectorComponent::SpawnNPCAt(const FNPCData& NPCData, const FAIDirectorSpawnData& SpawnPoint)
 {
-    // For now, spawn some basic loot at loot spawn points
-    TArray<FAIDirectorSpawnData> LootSpawnPoints = GetSpawnPointsByType(TEXT("Loot"));
+    // Try blueprint implementation first
+    APawn* SpawnedNPC = OnSpawnNPC(NPCData, SpawnPoint);
+    
+    if (!SpawnedNPC && DefaultNPCClass)
+    {
+        // Fallback to default spawning
+        TSubclassOf<APawn> NPCClass = GetNPCClassForSpecies(NPCData.Species);
+        if (!NPCClass)
+        {
+            NPCClass = DefaultNPCClass;
+        }
+        
+        SpawnedNPC = Cast<APawn>(AcquirePooledActor(NPCClass, SpawnPoint.Location, SpawnPoint.Rotation));
+    }
+    
+    if (SpawnedNPC)
+    {
+        SetupSpawnedActor(SpawnedNPC, TEXT("NPC"), &NPCData);
+        OnContentSpawned.Broadcast(SpawnedNPC);
+        
+        if (bDebugMode)
+        {
+            UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned NPC %s"), *NPCData.Name);
+        }
+    }
+    
+    return SpawnedNPC;
+}
 
-    for (FAIDirectorSpawnData& SpawnPoint : LootSpawnPoints)
+APawn* UAIDirectorComponent::SpawnEnemyAt(const FCampaignEnemyData& EnemyData, const FAIDirectorSpawnData& SpawnPoint)
+{
+    // Try blueprint implementation first
+    APawn* SpawnedEnemy = OnSpawnEnemy(EnemyData, SpawnPoint);
+    
+    if (!SpawnedEnemy && DefaultEnemyClass)
     {
-        if (!SpawnPoint.bIsOccupied)
+        // Fallback to default spawning
+        TSubclassOf<APawn> EnemyClass = GetEnemyClassForSpecies(EnemyData.Species);
+        if (!EnemyClass)
+        {
+            EnemyClass = DefaultEnemyClass;
+        }
+        
+        SpawnedEnemy = Cast<APawn>(AcquirePooledActor(EnemyClass, SpawnPoint.Location, SpawnPoint.Rotation));
+    }
+    
+    if (SpawnedEnemy)
+    {
+        SetupSpawnedActor(SpawnedEnemy, TEXT("Enemy"), &EnemyData);
+        OnContentSpawned.Broadcast(SpawnedEnemy);
+        
+        if (bDebugMode)
         {
-            // Create a basic loot item for testing
-            FLootItem TestLoot;
-            TestLoot.Name = TEXT("Test Loot");
-            TestLoot.Rarity = TEXT("Common");
-            TestLoot.ItemType = TEXT("Credits");
+            UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned Enemy %s"), *EnemyData.Name);
+        }
+    }
+    
+    return SpawnedEnemy;
+}
 
-            // Try blueprint implementation first
-            AActor* SpawnedLoot = OnSpawnLoot(TestLoot, SpawnPoint);
+AActor* UAIDirectorComponent::SpawnLootAt(const FAIDirectorSpawnData& SpawnPoint)
+{
+    // Create a basic loot item for testing
+    FLootItem TestLoot;
+    TestLoot.Name = TEXT("Test Loot");
+    TestLoot.Rarity = TEXT("Common");
+    TestLoot.ItemType = TEXT("Credits");
 
-            if (!SpawnedLoot && DefaultLootClass)
-            {
-                // Fallback to default spawning
-                FActorSpawnParameters SpawnParams;
-                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    // Try blueprint implementation first
+    AActor* SpawnedLoot = OnSpawnLoot(TestLoot, SpawnPoint);
 
-                SpawnedLoot = GetWorld()->SpawnActor<AActor>(DefaultLootClass, SpawnPoint.Location, SpawnPoint.Rotation, SpawnParams);
-            }
+    if (!SpawnedLoot && DefaultLootClass)
+    {
+        // Fallback to default spawning
+        SpawnedLoot = AcquirePooledActor(DefaultLootClass, SpawnPoint.Location, SpawnPoint.Rotation);
+    }
 
-            if (SpawnedLoot)
-            {
-                SpawnPoint.bIsOccupied = true;
-                SpawnPoint.SpawnedActor = SpawnedLoot;
-                SpawnedActors.Add(SpawnedLoot);
+    if (SpawnedLoot)
+    {
+        SetupSpawnedActor(SpawnedLoot, TEXT("Loot"), &TestLoot);
+        OnContentSpawned.Broadcast(SpawnedLoot);
 
-                SetupSpawnedActor(SpawnedLoot, TEXT("Loot"), &TestLoot);
-                OnContentSpawned.Broadcast(SpawnedLoot);
+        if (bDebugMode)
+        {
+            UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned Loot %s"), *TestLoot.Name);
+        }
+    }
 
-                if (bDebugMode)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Spawned Loot %s"), *TestLoot.Name);
-                }
-            }
+    return SpawnedLoot;
+}
+
+FVector UAIDirectorComponent::GetSpawnPriorityOrigin() const
+{
+    if (const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+    {
+        if (const APawn* PlayerPawn = PlayerController->GetPawn())
+        {
+            return PlayerPawn->GetActorLocation();
         }
     }
+    
+    return GetOwner() ? GetOwner()->GetActorLocation() : FVector::ZeroVector;
 }
 
 void UAIDirectorComponent::SpawnQuestsForLayout()
 {
     // Quest spawning logic - for now just log available quests
-    const FPlanetData Planet = GetCurrentPlanetData();
+    const FPlanetData* Planet = FindCurrentPlanetData();
 
-    if (bDebugMode)
+    if (bDebugMode && Planet)
     {
-        UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Available quests for %s:"), *Planet.Name);
-        UE_LOG(LogTemp, Log, TEXT("  Main Quest: %s"), *Planet.MainQuest);
+        UE_LOG(LogTemp, Log, TEXT("AIDirectorComponent: Available quests for %s:"), *Planet->Name);
+        UE_LOG(LogTemp, Log, TEXT("  Main Quest: %s"), *Planet->MainQuest);
 
-        for (const FString& SideQuest : Planet.SideQuests)
+        for (const FString& SideQuest : Planet->SideQuests)
         {
             UE_LOG(LogTemp, Log, TEXT("  Side Quest: %s"), *SideQuest);
         }
@@ -502,19 +739,20 @@ TSubclassOf<APawn> UAIDirectorComponent::GetEnemyClassForSpecies(const FString&
     return DefaultEnemyClass;
 }
 
-FAIDirectorSpawnData* UAIDirectorComponent::FindAvailableSpawnPoint(const FString& SpawnType, const FString& LayoutName)
+int32 UAIDirectorComponent::FindAvailableSpawnPointIndex(const FString& SpawnType, const FString& LayoutName) const
 {
-    for (FAIDirectorSpawnData& SpawnPoint : RegisteredSpawnPoints)
+    for (int32 Index = 0; Index < RegisteredSpawnPoints.Num(); ++Index)
     {
+        const FAIDirectorSpawnData& SpawnPoint = RegisteredSpawnPoints[Index];
         if (SpawnPoint.SpawnType == SpawnType &&
             SpawnPoint.LayoutName == LayoutName &&
             !SpawnPoint.bIsOccupied)
         {
-            return &SpawnPoint;
+            return Index;
         }
     }
 
-    return nullptr;
+    return INDEX_NONE;
 }
 
 void UAIDirectorComponent::SetupSpawnedActor(AActor* SpawnedActor, const FString& ActorType, const void* Data)
@@ -524,26 +762,179 @@ void UAIDirectorComponent::SetupSpawnedActor(AActor* SpawnedActor, const FString
         return;
     }
 
-    // Set actor name for debugging
+    // Set actor name for debugging, and (re)initialize gameplay state - pooled actors
+    // still carry whatever the previous layout left on them
     if (ActorType == TEXT("NPC") && Data)
     {
         const FNPCData* NPCData = static_cast<const FNPCData*>(Data);
         SpawnedActor->SetActorLabel(FString::Printf(TEXT("NPC_%s"), *NPCData->Name));
+        
+        if (AProceduralNPCActor* NPCActor = Cast<AProceduralNPCActor>(SpawnedActor))
+        {
+            FProceduralNPCData ProceduralData;
+            ProceduralData.NPCID = NPCData->Name;
+            ProceduralData.DisplayName = NPCData->Name;
+            ProceduralData.Faction = NPCData->Faction;
+            ProceduralData.Species = NPCData->Species;
+            ProceduralData.Appearance = NPCData->Backstory;
+            NPCActor->InitializeNPC(ProceduralData);
+        }
     }
     else if (ActorType == TEXT("Enemy") && Data)
     {
         const FCampaignEnemyData* EnemyData = static_cast<const FCampaignEnemyData*>(Data);
         SpawnedActor->SetActorLabel(FString::Printf(TEXT("Enemy_%s"), *EnemyData->Name));
+        
+        if (AEnemyActor* EnemyActor = Cast<AEnemyActor>(SpawnedActor))
+        {
+            FEnemyData ActorData;
+            ActorData.EnemyID = EnemyData->Name;
+            ActorData.DisplayName = EnemyData->Name;
+            ActorData.Faction = EnemyData->Faction;
+            ActorData.Abilities = EnemyData->Abilities;
+            ActorData.ChallengeRating.ChallengeRating = EnemyData->ChallengeRating;
+            ActorData.Stats.MaxHitPoints = EnemyData->HitPoints;
+            ActorData.Stats.CurrentHitPoints = EnemyData->HitPoints;
+            ActorData.Stats.ArmorClass = EnemyData->ArmorClass;
+            EnemyActor->InitializeEnemy(ActorData);
+        }
     }
     else if (ActorType == TEXT("Loot") && Data)
     {
         const FLootItem* LootData = static_cast<const FLootItem*>(Data);
         SpawnedActor->SetActorLabel(FString::Printf(TEXT("Loot_%s"), *LootData->Name));
+        
+        if (ALootPickupActor* LootActor = Cast<ALootPickupActor>(SpawnedActor))
+        {
+            FLootItemData ItemData;
+            ItemData.ItemID = LootData->Name;
+            ItemData.ItemName = LootData->Name;
+            ItemData.ItemType = LootData->ItemType;
+            ItemData.Value = LootData->ValueCredits;
+            ItemData.Description = LootData->FlavorText;
+            
+            const int64 RarityValue = StaticEnum<ELootRarity>()->GetValueByNameString(LootData->Rarity);
+            if (RarityValue != INDEX_NONE)
+            {
+                ItemData.Rarity = static_cast<ELootRarity>(RarityValue);
+            }
+            
+            LootActor->InitializeLootPickup(ItemData);
+        }
     }
 
     // Additional setup can be added here (components, properties, etc.)
 }
 
+AActor* UAIDirectorComponent::AcquirePooledActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation)
+{
+    if (!ActorClass)
+    {
+        return nullptr;
+    }
+    
+    if (FAIDirectorPooledActorList* Pooled = ActorPool.Find(ActorClass))
+    {
+        while (Pooled->Actors.Num() > 0)
+        {
+            AActor* Actor = Pooled->Actors.Pop(EAllowShrinking::No);
+            PoolStats.PooledActors--;
+            
+            // Something else may have destroyed it while it sat in the pool
+            if (!IsValid(Actor))
+            {
+                continue;
+            }
+            
+            Actor->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+            SetPooledActorActive(Actor, true);
+            PoolStats.Hits++;
+            return Actor;
+        }
+    }
+    
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    
+    AActor* Actor = GetWorld()->SpawnActor<AActor>(ActorClass, Location, Rotation, SpawnParams);
+    if (Actor)
+    {
+        Actor->Tags.AddUnique(AIDirectorPooledTag);
+        PoolStats.Misses++;
+    }
+    
+    return Actor;
+}
+
+void UAIDirectorComponent::ReleasePooledActor(AActor* Actor)
+{
+    // Blueprint-spawned content (OnSpawnNPC etc.) is not ours to recycle
+    if (!bUseActorPool || !Actor->Tags.Contains(AIDirectorPooledTag))
+    {
+        Actor->Destroy();
+        return;
+    }
+    
+    FAIDirectorPooledActorList& Pooled = ActorPool.FindOrAdd(Actor->GetClass());
+    if (Pooled.Actors.Num() >= MaxPooledActorsPerClass)
+    {
+        Actor->Destroy();
+        PoolStats.Discarded++;
+        return;
+    }
+    
+    SetPooledActorActive(Actor, false);
+    Pooled.Actors.Add(Actor);
+    PoolStats.Released++;
+    PoolStats.PooledActors++;
+}
+
+void UAIDirectorComponent::SetPooledActorActive(AActor* Actor, bool bActive) const
+{
+    Actor->SetActorHiddenInGame(!bActive);
+    Actor->SetActorEnableCollision(bActive);
+    Actor->SetActorTickEnabled(bActive);
+    
+    if (APawn* Pawn = Cast<APawn>(Actor))
+    {
+        if (UPawnMovementComponent* Movement = Pawn->GetMovementComponent())
+        {
+            Movement->StopMovementImmediately();
+            Movement->SetComponentTickEnabled(bActive);
+        }
+    }
+    
+    // Inactive actors must not show up as interaction targets
+    if (UInteractableRegistrySubsystem* Registry = GetWorld()->GetSubsystem<UInteractableRegistrySubsystem>())
+    {
+        if (!bActive)
+        {
+            Registry->UnregisterInteractable(Actor);
+        }
+        else if (UInteractableRegistrySubsystem::ShouldAutoRegister(Actor))
+        {
+            Registry->RegisterInteractable(Actor);
+        }
+    }
+}
+
+void UAIDirectorComponent::EmptyActorPool()
+{
+    for (TPair<UClass*, FAIDirectorPooledActorList>& Pair : ActorPool)
+    {
+        for (AActor* Actor : Pair.Value.Actors)
+        {
+            if (IsValid(Actor))
+            {
+                Actor->Destroy();
+            }
+        }
+    }
+    
+    ActorPool.Empty();
+    PoolStats.PooledActors = 0;
+}
+
 void UAIDirectorComponent::DrawSpawnPointDebug() const
 {
     if (!GetWorld())
@@ -593,9 +984,14 @@ void UAIDirectorComponent::LogDirectorState() const
     UE_LOG(LogTemp, Log, TEXT("Current Layout: %s"), *CurrentLayoutName);
     UE_LOG(LogTemp, Log, TEXT("Registered Spawn Points: %d"), RegisteredSpawnPoints.Num());
     UE_LOG(LogTemp, Log, TEXT("Spawned Actors: %d"), SpawnedActors.Num());
+    UE_LOG(LogTemp, Log, TEXT("Pending Spawns: %d"), PendingSpawns.Num());
+    UE_LOG(LogTemp, Log, TEXT("Actor Pool: %d hits, %d misses, %d released, %d discarded, %d pooled"),
+           PoolStats.Hits, PoolStats.Misses, PoolStats.Released, PoolStats.Discarded, PoolStats.PooledActors);
 
-    const FPlanetData Planet = GetCurrentPlanetData();
-    UE_LOG(LogTemp, Log, TEXT("Planet Name: %s"), *Planet.Name);
-    UE_LOG(LogTemp, Log, TEXT("Planet Biome: %s"), *Planet.Biome);
+    if (const FPlanetData* Planet = FindCurrentPlanetData())
+    {
+        UE_LOG(LogTemp, Log, TEXT("Planet Name: %s"), *Planet->Name);
+        UE_LOG(LogTemp, Log, TEXT("Planet Biome: %s"), *Planet->Biome);
+    }
     UE_LOG(LogTemp, Log, TEXT("========================"));
 }
@@ -1,30 +1,59 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AIDM/CampaignLoaderSubsystem.h"
+#include "AIDM/CookedCampaignFormat.h"
+#include "AIDM/AIDMSymbolTable.h"
+#include "Loaders/CampaignJSONStreamReader.h"
 #include "Engine/Engine.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/Async.h"
+#include "Algo/StableSort.h"
+#include "Tasks/Task.h"
+#include <atomic>
 #include "Misc/FileHelper.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
 #include "Misc/Paths.h"
 
+/**
+ * Shared state between the game thread and the async load worker.
+ * The worker owns Plan until it posts completion back to the game thread.
+ */
+struct FCampaignAsyncLoadState
+{
+    FString JsonFilePath;
+    FString FullJsonPath;
+    FString CookedPath;
+    bool bUseCookedCampaigns = true;
+
+    std::atomic<bool> bCancelRequested { false };
+
+    FCampaignPlan Plan;
+    bool bSucceeded = false;
+};
+
 void UCampaignLoaderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
     bCampaignLoaded = false;
+    bUseCookedCampaigns = true;
     
     UE_LOG(LogTemp, Log, TEXT("CampaignLoaderSubsystem initialized"));
 }
 
 void UCampaignLoaderSubsystem::Deinitialize()
 {
+    CancelAsyncLoad();
+    
     // Clear cached data
-    CachedNPCData.Empty();
-    CachedEnemyData.Empty();
+    NPCLocationIndex.Empty();
+    NPCLocationOrder.Empty();
     bCampaignLoaded = false;
     
+    // Interned AIDM IDs are scoped to the campaign session
+    FAIDMSymbolTable::Get().Reset();
+    
     Super::Deinitialize();
 }
 
@@ -32,388 +61,410 @@ bool UCampaignLoaderSubsystem::LoadCampaign(const FString& JsonFilePath)
 {
     // Construct full path
     FString FullPath = FPaths::ProjectContentDir() + JsonFilePath;
+    FString CookedPath = GetCookedCampaignPath(JsonFilePath);
     
-    // Check if file exists
-    if (!FPaths::FileExists(FullPath))
+    // Both paths decode into a temporary so a failed load leaves the current campaign intact
+    FCampaignPlan LoadedPlan;
+    
+    // Prefer the cooked binary cache when it is present and still matches the JSON
+    if (bUseCookedCampaigns && ReadCookedCampaign(FullPath, CookedPath, LoadedPlan))
     {
-        UE_LOG(LogTemp, Error, TEXT("Campaign file not found: %s"), *FullPath);
-        return false;
+        CommitCampaign(MoveTemp(LoadedPlan));
+        UE_LOG(LogTemp, Log, TEXT("Successfully loaded cooked campaign: %s"), *CurrentCampaign.Config.StorySeed);
+        return true;
     }
     
-    // Load file content
-    FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *FullPath))
+    TArray<uint8> FileBytes;
+    if (!LoadJsonCampaign(FullPath, FileBytes, LoadedPlan))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load campaign file: %s"), *FullPath);
         return false;
     }
     
-    // Parse JSON
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    CommitCampaign(MoveTemp(LoadedPlan));
+    UE_LOG(LogTemp, Log, TEXT("Successfully loaded campaign: %s"), *CurrentCampaign.Config.StorySeed);
     
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    // Refresh the cooked cache so the next load skips JSON parsing
+    if (bUseCookedCampaigns)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON from campaign file: %s"), *FullPath);
-        return false;
+        WriteCookedCampaign(CookedPath, CurrentCampaign, FCookedCampaignFormat::MakeSourceInfo(FullPath, FileBytes));
     }
     
-    // Parse campaign data
-    if (!ParseCampaignFromJson(JsonObject))
+    return true;
+}
+
+bool UCampaignLoaderSubsystem::CookCampaign(const FString& JsonFilePath)
+{
+    FString FullPath = FPaths::ProjectContentDir() + JsonFilePath;
+    
+    TArray<uint8> FileBytes;
+    FCampaignPlan LoadedPlan;
+    if (!LoadJsonCampaign(FullPath, FileBytes, LoadedPlan))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to parse campaign data from: %s"), *FullPath);
         return false;
     }
     
-    bCampaignLoaded = true;
-    UE_LOG(LogTemp, Log, TEXT("Successfully loaded campaign: %s"), *CurrentCampaign.Config.StorySeed);
+    CommitCampaign(MoveTemp(LoadedPlan));
     
-    return true;
+    return WriteCookedCampaign(GetCookedCampaignPath(JsonFilePath), CurrentCampaign, FCookedCampaignFormat::MakeSourceInfo(FullPath, FileBytes));
 }
 
-FPlanetData UCampaignLoaderSubsystem::GetPlanetData(int32 PlanetIndex) const
+bool UCampaignLoaderSubsystem::LoadCampaignAsync(const FString& JsonFilePath)
 {
-    if (!bCampaignLoaded || PlanetIndex < 0 || PlanetIndex >= CurrentCampaign.Planets.Num())
+    if (ActiveAsyncLoad.IsValid())
     {
-        return FPlanetData();
+        UE_LOG(LogTemp, Warning, TEXT("Async campaign load already in progress, ignoring request for %s"), *JsonFilePath);
+        return false;
     }
     
-    return CurrentCampaign.Planets[PlanetIndex];
-}
-
-TArray<FNPCData> UCampaignLoaderSubsystem::GetNPCsForLocation(int32 PlanetIndex, const FString& LayoutName) const
-{
-    FString LocationKey = FString::Printf(TEXT("%d_%s"), PlanetIndex, *LayoutName);
+    TSharedRef<FCampaignAsyncLoadState, ESPMode::ThreadSafe> State = MakeShared<FCampaignAsyncLoadState, ESPMode::ThreadSafe>();
+    State->JsonFilePath = JsonFilePath;
+    State->FullJsonPath = FPaths::ProjectContentDir() + JsonFilePath;
+    State->CookedPath = GetCookedCampaignPath(JsonFilePath);
+    State->bUseCookedCampaigns = bUseCookedCampaigns;
+    ActiveAsyncLoad = State;
     
-    if (const TArray<FNPCData>* FoundNPCs = CachedNPCData.Find(LocationKey))
+    TWeakObjectPtr<UCampaignLoaderSubsystem> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [State, WeakThis]()
     {
-        return *FoundNPCs;
-    }
+        ExecuteAsyncLoad(State, WeakThis);
+        
+        AsyncTask(ENamedThreads::GameThread, [State, WeakThis]()
+        {
+            if (UCampaignLoaderSubsystem* Subsystem = WeakThis.Get())
+            {
+                Subsystem->CompleteAsyncLoad(State);
+            }
+        });
+    });
+    
+    UE_LOG(LogTemp, Log, TEXT("Started async campaign load: %s"), *JsonFilePath);
     
-    return TArray<FNPCData>();
+    return true;
 }
 
-TArray<FCampaignEnemyData> UCampaignLoaderSubsystem::GetEnemiesForPlanet(int32 PlanetIndex) const
+void UCampaignLoaderSubsystem::CancelAsyncLoad()
 {
-    if (const TArray<FCampaignEnemyData>* FoundEnemies = CachedEnemyData.Find(PlanetIndex))
+    if (ActiveAsyncLoad.IsValid())
     {
-        return *FoundEnemies;
+        ActiveAsyncLoad->bCancelRequested = true;
     }
-    
-    return TArray<FCampaignEnemyData>();
 }
 
-bool UCampaignLoaderSubsystem::ParseCampaignFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void UCampaignLoaderSubsystem::ExecuteAsyncLoad(const TSharedRef<FCampaignAsyncLoadState, ESPMode::ThreadSafe>& State, TWeakObjectPtr<UCampaignLoaderSubsystem> WeakThis)
 {
-    // Parse campaign config
-    const TSharedPtr<FJsonObject>* ConfigObject;
-    if (!JsonObject->TryGetObjectField(TEXT("config"), ConfigObject) || !ConfigObject->IsValid())
+    // Worker thread: only touch State, never the subsystem itself
+    if (State->bUseCookedCampaigns && ReadCookedCampaign(State->FullJsonPath, State->CookedPath, State->Plan))
     {
-        UE_LOG(LogTemp, Error, TEXT("Missing or invalid 'config' field in campaign JSON"));
-        return false;
+        State->bSucceeded = true;
+        return;
     }
     
-    if (!ParseCampaignConfig(*ConfigObject, CurrentCampaign.Config))
+    // Progress is marshalled to the game thread, at most once per parsed planet
+    auto ReportProgress = [State, WeakThis](int64 BytesRead, int64 TotalBytes, int32 PlanetsParsed)
     {
-        return false;
-    }
+        if (State->bCancelRequested)
+        {
+            return false;
+        }
+        
+        AsyncTask(ENamedThreads::GameThread, [State, WeakThis, BytesRead, TotalBytes, PlanetsParsed]()
+        {
+            UCampaignLoaderSubsystem* Subsystem = WeakThis.Get();
+            if (Subsystem && Subsystem->ActiveAsyncLoad == State && !State->bCancelRequested)
+            {
+                Subsystem->OnCampaignLoadProgress.Broadcast(BytesRead, TotalBytes, PlanetsParsed);
+            }
+        });
+        
+        return true;
+    };
     
-    // Parse planets
-    const TArray<TSharedPtr<FJsonValue>>* PlanetsArray;
-    if (!JsonObject->TryGetArrayField(TEXT("planets"), PlanetsArray))
+    TArray<uint8> FileBytes;
+    if (!LoadJsonCampaign(State->FullJsonPath, FileBytes, State->Plan, ReportProgress))
     {
-        UE_LOG(LogTemp, Error, TEXT("Missing 'planets' array in campaign JSON"));
-        return false;
+        return;
     }
     
-    CurrentCampaign.Planets.Empty();
-    for (const auto& PlanetValue : *PlanetsArray)
+    State->bSucceeded = true;
+    
+    // Re-cook while still off the game thread, hashing the bytes that were just parsed
+    if (State->bUseCookedCampaigns && !State->bCancelRequested)
     {
-        const TSharedPtr<FJsonObject>* PlanetObject = nullptr;
-        if (PlanetValue->TryGetObject(PlanetObject) && PlanetObject->IsValid())
-        {
-            FPlanetData Planet;
-            if (ParsePlanetData(*PlanetObject, Planet))
-            {
-                CurrentCampaign.Planets.Add(Planet);
-            }
-        }
+        WriteCookedCampaign(State->CookedPath, State->Plan, FCookedCampaignFormat::MakeSourceInfo(State->FullJsonPath, FileBytes));
     }
-    
-    // Parse final boss
-    const TSharedPtr<FJsonObject>* BossObject;
-    if (JsonObject->TryGetObjectField(TEXT("final_boss"), BossObject) && BossObject->IsValid())
+}
+
+void UCampaignLoaderSubsystem::CompleteAsyncLoad(const TSharedRef<FCampaignAsyncLoadState, ESPMode::ThreadSafe>& State)
+{
+    if (ActiveAsyncLoad != State)
     {
-        ParseBossData(*BossObject, CurrentCampaign.FinalBoss);
+        return;
     }
     
-    // Parse main quest outline
-    JsonObject->TryGetStringField(TEXT("main_quest_outline"), CurrentCampaign.MainQuestOutline);
-    
-    // Parse campaign summary
-    JsonObject->TryGetStringField(TEXT("campaign_summary"), CurrentCampaign.CampaignSummary);
+    ActiveAsyncLoad.Reset();
     
-    UE_LOG(LogTemp, Log, TEXT("Parsed campaign with %d planets"), CurrentCampaign.Planets.Num());
+    const bool bSuccess = State->bSucceeded && !State->bCancelRequested;
+    if (bSuccess)
+    {
+        // Single move: the game thread never observes a partially built campaign
+        CommitCampaign(MoveTemp(State->Plan));
+        UE_LOG(LogTemp, Log, TEXT("Successfully loaded campaign asynchronously: %s"), *CurrentCampaign.Config.StorySeed);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Log, TEXT("Async campaign load %s: %s"),
+               State->bCancelRequested ? TEXT("cancelled") : TEXT("failed"), *State->JsonFilePath);
+    }
     
-    return true;
+    OnCampaignAsyncLoadFinished.Broadcast(State->JsonFilePath, bSuccess);
 }
 
-bool UCampaignLoaderSubsystem::ParseCampaignConfig(const TSharedPtr<FJsonObject>& JsonObject, FCampaignConfig& OutConfig)
+FString UCampaignLoaderSubsystem::GetCookedCampaignPath(const FString& JsonFilePath) const
 {
-    JsonObject->TryGetNumberField(TEXT("game_length_hours"), OutConfig.GameLengthHours);
-    JsonObject->TryGetNumberField(TEXT("estimated_planets"), OutConfig.EstimatedPlanets);
-    JsonObject->TryGetStringField(TEXT("story_seed"), OutConfig.StorySeed);
-    JsonObject->TryGetStringField(TEXT("time_period"), OutConfig.TimePeriod);
-    JsonObject->TryGetStringField(TEXT("alignment_focus"), OutConfig.AlignmentFocus);
-    
-    return true;
+    return FPaths::ProjectSavedDir() / TEXT("CookedCampaigns") / FPaths::ChangeExtension(JsonFilePath, CookedCampaign::FileExtension);
 }
 
-bool UCampaignLoaderSubsystem::ParsePlanetData(const TSharedPtr<FJsonObject>& JsonObject, FPlanetData& OutPlanet)
+bool UCampaignLoaderSubsystem::LoadJsonCampaign(const FString& FullJsonPath, TArray<uint8>& OutFileBytes, FCampaignPlan& OutPlan,
+                                                const TFunction<bool(int64, int64, int32)>& Progress)
 {
-    JsonObject->TryGetStringField(TEXT("name"), OutPlanet.Name);
-    JsonObject->TryGetStringField(TEXT("biome"), OutPlanet.Biome);
-    JsonObject->TryGetStringField(TEXT("climate"), OutPlanet.Climate);
-    JsonObject->TryGetStringField(TEXT("population"), OutPlanet.Population);
-    JsonObject->TryGetStringField(TEXT("government"), OutPlanet.Government);
-    JsonObject->TryGetStringField(TEXT("main_quest"), OutPlanet.MainQuest);
-    JsonObject->TryGetStringField(TEXT("difficulty_tier"), OutPlanet.DifficultyTier);
-    JsonObject->TryGetNumberField(TEXT("planet_index"), OutPlanet.PlanetIndex);
-    JsonObject->TryGetStringField(TEXT("lore_description"), OutPlanet.LoreDescription);
-    
-    // Parse side quests array
-    const TArray<TSharedPtr<FJsonValue>>* SideQuestsArray;
-    if (JsonObject->TryGetArrayField(TEXT("side_quests"), SideQuestsArray))
-    {
-        OutPlanet.SideQuests = JsonArrayToStringArray(*SideQuestsArray);
+    // Check if file exists
+    if (!FPaths::FileExists(FullJsonPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Campaign file not found: %s"), *FullJsonPath);
+        return false;
     }
     
-    // Parse layouts array
-    const TArray<TSharedPtr<FJsonValue>>* LayoutsArray;
-    if (JsonObject->TryGetArrayField(TEXT("layouts"), LayoutsArray))
+    // Load file content (raw bytes are kept so the cooked cache can hash them)
+    if (!FFileHelper::LoadFileToArray(OutFileBytes, *FullJsonPath))
     {
-        OutPlanet.Layouts.Empty();
-        for (const auto& LayoutValue : *LayoutsArray)
-        {
-            const TSharedPtr<FJsonObject>* LayoutObject = nullptr;
-            if (LayoutValue->TryGetObject(LayoutObject) && LayoutObject->IsValid())
-            {
-                FMapLayout Layout;
-                if (ParseMapLayout(*LayoutObject, Layout))
-                {
-                    OutPlanet.Layouts.Add(Layout);
-                }
-            }
-        }
+        UE_LOG(LogTemp, Error, TEXT("Failed to load campaign file: %s"), *FullJsonPath);
+        return false;
     }
     
-    return true;
-}
-
-bool UCampaignLoaderSubsystem::ParseMapLayout(const TSharedPtr<FJsonObject>& JsonObject, FMapLayout& OutLayout)
-{
-    JsonObject->TryGetStringField(TEXT("name"), OutLayout.Name);
-    JsonObject->TryGetStringField(TEXT("layout_type"), OutLayout.LayoutType);
-    JsonObject->TryGetStringField(TEXT("description"), OutLayout.Description);
+    // Sync and async loads share the single-pass stream parser
+    FJSONValidationResult Validation;
+    const EJSONParseResult Result = FCampaignJSONStreamReader::ReadFromBytes(OutFileBytes, OutPlan, Validation, Progress);
     
-    double TimeHours;
-    if (JsonObject->TryGetNumberField(TEXT("estimated_time_hours"), TimeHours))
+    if (Result != EJSONParseResult::Success)
     {
-        OutLayout.EstimatedTimeHours = static_cast<float>(TimeHours);
+        if (Result != EJSONParseResult::Cancelled)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to parse campaign data from %s: %s"), *FullJsonPath,
+                   Validation.Errors.Num() > 0 ? *Validation.Errors[0] : TEXT("Unknown error"));
+        }
+        return false;
     }
     
-    // Parse key features array
-    const TArray<TSharedPtr<FJsonValue>>* FeaturesArray;
-    if (JsonObject->TryGetArrayField(TEXT("key_features"), FeaturesArray))
+    for (const FString& Warning : Validation.Warnings)
     {
-        OutLayout.KeyFeatures = JsonArrayToStringArray(*FeaturesArray);
+        UE_LOG(LogTemp, Warning, TEXT("Campaign %s: %s"), *FullJsonPath, *Warning);
     }
     
+    UE_LOG(LogTemp, Log, TEXT("Parsed campaign with %d planets"), OutPlan.Planets.Num());
+    
     return true;
 }
 
-bool UCampaignLoaderSubsystem::ParseBossData(const TSharedPtr<FJsonObject>& JsonObject, FBossData& OutBoss)
+bool UCampaignLoaderSubsystem::ReadCookedCampaign(const FString& FullJsonPath, const FString& CookedPath, FCampaignPlan& OutPlan)
 {
-    JsonObject->TryGetStringField(TEXT("name"), OutBoss.Name);
-    JsonObject->TryGetStringField(TEXT("title"), OutBoss.Title);
-    JsonObject->TryGetStringField(TEXT("species"), OutBoss.Species);
-    JsonObject->TryGetStringField(TEXT("motivation"), OutBoss.Motivation);
-    JsonObject->TryGetStringField(TEXT("backstory"), OutBoss.Backstory);
-    JsonObject->TryGetStringField(TEXT("arena_description"), OutBoss.ArenaDescription);
-    
-    double ChallengeRating;
-    if (JsonObject->TryGetNumberField(TEXT("challenge_rating"), ChallengeRating))
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*CookedPath))
     {
-        OutBoss.ChallengeRating = static_cast<float>(ChallengeRating);
+        return false;
     }
     
-    JsonObject->TryGetNumberField(TEXT("hit_points"), OutBoss.HitPoints);
-    JsonObject->TryGetNumberField(TEXT("armor_class"), OutBoss.ArmorClass);
+    // Map the cooked file so decoding reads straight from the page cache
+    TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*CookedPath));
+    TUniquePtr<IMappedFileRegion> MappedRegion(MappedFile ? MappedFile->MapRegion(0, MappedFile->GetFileSize()) : nullptr);
+    
+    // Platforms without mapping support fall back to a plain read
+    TArray<uint8> FallbackBytes;
+    const uint8* Data = nullptr;
+    int64 Size = 0;
     
-    // Parse string arrays
-    const TArray<TSharedPtr<FJsonValue>>* MechanicsArray;
-    if (JsonObject->TryGetArrayField(TEXT("mechanics"), MechanicsArray))
+    if (MappedRegion)
     {
-        OutBoss.Mechanics = JsonArrayToStringArray(*MechanicsArray);
+        Data = MappedRegion->GetMappedPtr();
+        Size = MappedRegion->GetMappedSize();
+    }
+    else if (FFileHelper::LoadFileToArray(FallbackBytes, *CookedPath))
+    {
+        Data = FallbackBytes.GetData();
+        Size = FallbackBytes.Num();
     }
     
-    const TArray<TSharedPtr<FJsonValue>>* AbilitiesArray;
-    if (JsonObject->TryGetArrayField(TEXT("special_abilities"), AbilitiesArray))
+    FCookedCampaignHeader Header;
+    if (!FCookedCampaignFormat::ReadHeader(Data, Size, Header))
     {
-        OutBoss.SpecialAbilities = JsonArrayToStringArray(*AbilitiesArray);
+        UE_LOG(LogTemp, Warning, TEXT("Cooked campaign %s is invalid or from an older version, using JSON"), *CookedPath);
+        return false;
     }
     
-    const TArray<TSharedPtr<FJsonValue>>* WeaknessesArray;
-    if (JsonObject->TryGetArrayField(TEXT("weaknesses"), WeaknessesArray))
+    bool bNeedsRestamp = false;
+    if (!FCookedCampaignFormat::IsUpToDate(Header, FullJsonPath, bNeedsRestamp))
     {
-        OutBoss.Weaknesses = JsonArrayToStringArray(*WeaknessesArray);
+        UE_LOG(LogTemp, Log, TEXT("Cooked campaign %s is stale, using JSON"), *CookedPath);
+        return false;
     }
     
-    const TArray<TSharedPtr<FJsonValue>>* MinionsArray;
-    if (JsonObject->TryGetArrayField(TEXT("minions"), MinionsArray))
+    OutPlan = FCampaignPlan();
+    if (!FCookedCampaignFormat::Read(Data, Size, OutPlan))
     {
-        OutBoss.Minions = JsonArrayToStringArray(*MinionsArray);
+        UE_LOG(LogTemp, Warning, TEXT("Cooked campaign %s is corrupted, using JSON"), *CookedPath);
+        OutPlan = FCampaignPlan();
+        return false;
     }
     
-    // Parse loot drop
-    const TSharedPtr<FJsonObject>* LootObject;
-    if (JsonObject->TryGetObjectField(TEXT("loot_drop"), LootObject) && LootObject->IsValid())
+    // The JSON only moved or was touched; record its new size/timestamp once the mapping is released
+    if (bNeedsRestamp)
     {
-        ParseLootItem(*LootObject, OutBoss.LootDrop);
+        MappedRegion.Reset();
+        MappedFile.Reset();
+        FCookedCampaignFormat::RestampSource(CookedPath, Header, FullJsonPath);
     }
     
+    UE_LOG(LogTemp, Log, TEXT("Read cooked campaign with %d planets from %s"), OutPlan.Planets.Num(), *CookedPath);
+    
     return true;
 }
 
-bool UCampaignLoaderSubsystem::ParseLootItem(const TSharedPtr<FJsonObject>& JsonObject, FLootItem& OutItem)
+bool UCampaignLoaderSubsystem::WriteCookedCampaign(const FString& CookedPath, const FCampaignPlan& Plan, const FCookedCampaignSourceInfo& Source)
 {
-    JsonObject->TryGetStringField(TEXT("name"), OutItem.Name);
-    JsonObject->TryGetStringField(TEXT("rarity"), OutItem.Rarity);
-    JsonObject->TryGetStringField(TEXT("item_type"), OutItem.ItemType);
-    JsonObject->TryGetStringField(TEXT("flavor_text"), OutItem.FlavorText);
-    JsonObject->TryGetStringField(TEXT("faction_theme"), OutItem.FactionTheme);
-    JsonObject->TryGetNumberField(TEXT("value_credits"), OutItem.ValueCredits);
-    JsonObject->TryGetNumberField(TEXT("level_requirement"), OutItem.LevelRequirement);
-    
-    // Parse bonuses map
-    const TSharedPtr<FJsonObject>* BonusesObject;
-    if (JsonObject->TryGetObjectField(TEXT("bonuses"), BonusesObject) && BonusesObject->IsValid())
-    {
-        OutItem.Bonuses = JsonObjectToIntMap(*BonusesObject);
+    TArray<uint8> CookedBytes;
+    FCookedCampaignFormat::Write(Plan, Source, CookedBytes);
+    
+    if (!FFileHelper::SaveArrayToFile(CookedBytes, *CookedPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to write cooked campaign: %s"), *CookedPath);
+        return false;
     }
     
+    UE_LOG(LogTemp, Log, TEXT("Wrote cooked campaign (%d bytes): %s"), CookedBytes.Num(), *CookedPath);
+    
     return true;
 }
 
-TArray<FString> UCampaignLoaderSubsystem::JsonArrayToStringArray(const TArray<TSharedPtr<FJsonValue>>& JsonArray)
+FPlanetData UCampaignLoaderSubsystem::GetPlanetData(int32 PlanetIndex) const
 {
-    TArray<FString> Result;
-    
-    for (const auto& Value : JsonArray)
-    {
-        FString StringValue;
-        if (Value->TryGetString(StringValue))
-        {
-            Result.Add(StringValue);
-        }
-    }
-    
-    return Result;
+    const FPlanetData* Planet = FindPlanetData(PlanetIndex);
+    return Planet ? *Planet : FPlanetData();
 }
 
-TMap<FString, int32> UCampaignLoaderSubsystem::JsonObjectToIntMap(const TSharedPtr<FJsonObject>& JsonObject)
+const FPlanetData* UCampaignLoaderSubsystem::FindPlanetData(int32 PlanetIndex) const
 {
-    TMap<FString, int32> Result;
-    
-    for (const auto& Pair : JsonObject->Values)
+    if (!bCampaignLoaded || !CurrentCampaign.Planets.IsValidIndex(PlanetIndex))
     {
-        double NumberValue;
-        if (Pair.Value->TryGetNumber(NumberValue))
-        {
-            Result.Add(Pair.Key, static_cast<int32>(NumberValue));
-        }
+        return nullptr;
     }
     
-    return Result;
+    return &CurrentCampaign.Planets[PlanetIndex];
 }
 
-bool UCampaignLoaderSubsystem::ParseNPCData(const TSharedPtr<FJsonObject>& JsonObject, FNPCData& OutNPC)
+TArray<FNPCData> UCampaignLoaderSubsystem::GetNPCsForLocation(int32 PlanetIndex, const FString& LayoutName) const
 {
-    JsonObject->TryGetStringField(TEXT("name"), OutNPC.Name);
-    JsonObject->TryGetStringField(TEXT("species"), OutNPC.Species);
-    JsonObject->TryGetStringField(TEXT("faction"), OutNPC.Faction);
-    JsonObject->TryGetStringField(TEXT("alignment"), OutNPC.Alignment);
-    JsonObject->TryGetStringField(TEXT("role"), OutNPC.Role);
-    JsonObject->TryGetStringField(TEXT("backstory"), OutNPC.Backstory);
-    JsonObject->TryGetStringField(TEXT("location"), OutNPC.Location);
-    JsonObject->TryGetStringField(TEXT("dialogue_style"), OutNPC.DialogueStyle);
-    JsonObject->TryGetBoolField(TEXT("likes_player"), OutNPC.bLikesPlayer);
-    JsonObject->TryGetNumberField(TEXT("reputation_standing"), OutNPC.ReputationStanding);
-
-    // Parse personality traits array
-    const TArray<TSharedPtr<FJsonValue>>* TraitsArray;
-    if (JsonObject->TryGetArrayField(TEXT("personality_traits"), TraitsArray))
-    {
-        OutNPC.PersonalityTraits = JsonArrayToStringArray(*TraitsArray);
-    }
+    const TArrayView<const int32> Indices = GetNPCIndicesForLocationView(PlanetIndex, FName(*LayoutName, FNAME_Find));
+    const TArrayView<const FNPCData> NPCs = GetNPCsForPlanetView(PlanetIndex);
 
-    // Parse quest data if present
-    const TSharedPtr<FJsonObject>* QuestObject;
-    if (JsonObject->TryGetObjectField(TEXT("quest"), QuestObject) && QuestObject->IsValid())
+    TArray<FNPCData> Result;
+    Result.Reserve(Indices.Num());
+    for (const int32 NPCIndex : Indices)
     {
-        ParseQuestData(*QuestObject, OutNPC.Quest);
+        Result.Add(NPCs[NPCIndex]);
     }
-
-    return true;
+    return Result;
 }
 
-bool UCampaignLoaderSubsystem::ParseEnemyData(const TSharedPtr<FJsonObject>& JsonObject, FCampaignEnemyData& OutEnemy)
+TArray<FCampaignEnemyData> UCampaignLoaderSubsystem::GetEnemiesForPlanet(int32 PlanetIndex) const
 {
-    JsonObject->TryGetStringField(TEXT("name"), OutEnemy.Name);
-    JsonObject->TryGetStringField(TEXT("species"), OutEnemy.Species);
-    JsonObject->TryGetStringField(TEXT("faction"), OutEnemy.Faction);
-    JsonObject->TryGetStringField(TEXT("description"), OutEnemy.Description);
-    JsonObject->TryGetNumberField(TEXT("hit_points"), OutEnemy.HitPoints);
-    JsonObject->TryGetNumberField(TEXT("armor_class"), OutEnemy.ArmorClass);
-
-    double ChallengeRating;
-    if (JsonObject->TryGetNumberField(TEXT("cr_rating"), ChallengeRating))
-    {
-        OutEnemy.ChallengeRating = static_cast<float>(ChallengeRating);
-    }
+    return TArray<FCampaignEnemyData>(GetEnemiesForPlanetView(PlanetIndex));
+}
 
-    // Parse abilities array
-    const TArray<TSharedPtr<FJsonValue>>* AbilitiesArray;
-    if (JsonObject->TryGetArrayField(TEXT("abilities"), AbilitiesArray))
+TArrayView<const int32> UCampaignLoaderSubsystem::GetNPCIndicesForLocationView(int32 PlanetIndex, FName LayoutName) const
+{
+    const FCampaignLocationRange* Range = NPCLocationIndex.Find(TPair<int32, FName>(PlanetIndex, LayoutName));
+    if (!Range)
     {
-        OutEnemy.Abilities = JsonArrayToStringArray(*AbilitiesArray);
+        return TArrayView<const int32>();
     }
+    
+    return MakeArrayView(NPCLocationOrder).Slice(Range->Start, Range->Num);
+}
 
-    // Parse loot table array
-    const TArray<TSharedPtr<FJsonValue>>* LootArray;
-    if (JsonObject->TryGetArrayField(TEXT("loot_table"), LootArray))
+TArrayView<const FNPCData> UCampaignLoaderSubsystem::GetNPCsForPlanetView(int32 PlanetIndex) const
+{
+    if (!CurrentCampaign.Planets.IsValidIndex(PlanetIndex))
     {
-        OutEnemy.LootTable = JsonArrayToStringArray(*LootArray);
+        return TArrayView<const FNPCData>();
     }
+    
+    return MakeArrayView(CurrentCampaign.Planets[PlanetIndex].NPCs);
+}
 
-    // Parse biome preference array
-    const TArray<TSharedPtr<FJsonValue>>* BiomeArray;
-    if (JsonObject->TryGetArrayField(TEXT("biome_preference"), BiomeArray))
+TArrayView<const FCampaignEnemyData> UCampaignLoaderSubsystem::GetEnemiesForPlanetView(int32 PlanetIndex) const
+{
+    if (!CurrentCampaign.Planets.IsValidIndex(PlanetIndex))
     {
-        OutEnemy.BiomePreference = JsonArrayToStringArray(*BiomeArray);
+        return TArrayView<const FCampaignEnemyData>();
     }
+    
+    return MakeArrayView(CurrentCampaign.Planets[PlanetIndex].Enemies);
+}
 
-    return true;
+void UCampaignLoaderSubsystem::CommitCampaign(FCampaignPlan&& LoadedPlan)
+{
+    CurrentCampaign = MoveTemp(LoadedPlan);
+    BuildLocationIndex();
+    bCampaignLoaded = true;
+    
+    // IDs are scoped to one campaign: drop the previous campaign's symbols so they do not
+    // accumulate across loads; components holding IDs re-intern them from OnReset()
+    FAIDMSymbolTable::Get().Reset();
 }
 
-bool UCampaignLoaderSubsystem::ParseQuestData(const TSharedPtr<FJsonObject>& JsonObject, FQuestData& OutQuest)
+void UCampaignLoaderSubsystem::BuildLocationIndex()
 {
-    JsonObject->TryGetStringField(TEXT("title"), OutQuest.Title);
-    JsonObject->TryGetStringField(TEXT("description"), OutQuest.Description);
-    JsonObject->TryGetStringField(TEXT("quest_type"), OutQuest.QuestType);
-    JsonObject->TryGetStringField(TEXT("reward_type"), OutQuest.RewardType);
-    JsonObject->TryGetStringField(TEXT("difficulty"), OutQuest.Difficulty);
-    JsonObject->TryGetNumberField(TEXT("estimated_time_minutes"), OutQuest.EstimatedTimeMinutes);
+    NPCLocationIndex.Reset();
+    NPCLocationOrder.Reset();
     
-    return true;
+    for (int32 PlanetIndex = 0; PlanetIndex < CurrentCampaign.Planets.Num(); PlanetIndex++)
+    {
+        const TArray<FNPCData>& NPCs = CurrentCampaign.Planets[PlanetIndex].NPCs;
+        
+        // Group this planet's NPC indices by layout so each location is one contiguous run;
+        // the stable sort keeps authored order within a layout
+        const int32 PlanetStart = NPCLocationOrder.Num();
+        for (int32 NPCIndex = 0; NPCIndex < NPCs.Num(); NPCIndex++)
+        {
+            NPCLocationOrder.Add(NPCIndex);
+        }
+        TArrayView<int32> Order = MakeArrayView(NPCLocationOrder).Slice(PlanetStart, NPCs.Num());
+        Algo::StableSortBy(Order, [&NPCs](int32 NPCIndex) -> const FString& { return NPCs[NPCIndex].Location; },
+            [](const FString& A, const FString& B)
+            {
+                return A.Compare(B, ESearchCase::IgnoreCase) < 0;
+            });
+        
+        for (int32 Start = 0; Start < Order.Num();)
+        {
+            const FString& Location = NPCs[Order[Start]].Location;
+            int32 End = Start + 1;
+            while (End < Order.Num() && NPCs[Order[End]].Location.Equals(Location, ESearchCase::IgnoreCase))
+            {
+                End++;
+            }
+            
+            // NPCs without a layout are not reachable by location (and NAME_None is the "not found" key)
+            if (!Location.IsEmpty())
+            {
+                FCampaignLocationRange Range;
+                Range.Start = PlanetStart + Start;
+                Range.Num = End - Start;
+                NPCLocationIndex.Add(TPair<int32, FName>(PlanetIndex, FName(*Location)), Range);
+            }
+            
+            Start = End;
+        }
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("Indexed %d NPC locations"), NPCLocationIndex.Num());
 }
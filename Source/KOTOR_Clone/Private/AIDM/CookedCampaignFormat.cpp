@@ -0,0 +1,578 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AIDM/CookedCampaignFormat.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Hash/xxhash.h"
+
+namespace
+{
+    /** FString keys default to case-insensitive matching; the string table must preserve case */
+    struct FCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, uint32, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    /**
+     * Builds the string table and payload sections of a cooked campaign
+     */
+    class FCookedCampaignWriter
+    {
+    public:
+        void WriteU32(uint32 Value) { Append(&Value, sizeof(Value)); }
+        void WriteI32(int32 Value) { Append(&Value, sizeof(Value)); }
+        void WriteF32(float Value) { Append(&Value, sizeof(Value)); }
+        void WriteBool(bool bValue) { const uint8 Byte = bValue ? 1 : 0; Append(&Byte, 1); }
+
+        void WriteString(const FString& Value)
+        {
+            // Strings are deduplicated so repeated biomes, factions, etc. are stored once
+            if (const uint32* Existing = StringIndices.Find(Value))
+            {
+                WriteU32(*Existing);
+                return;
+            }
+
+            const uint32 Index = Strings.Num();
+            StringIndices.Add(Value, Index);
+            Strings.Add(Value);
+            WriteU32(Index);
+        }
+
+        void WriteStringArray(const TArray<FString>& Values)
+        {
+            WriteU32(Values.Num());
+            for (const FString& Value : Values)
+            {
+                WriteString(Value);
+            }
+        }
+
+        void Finalize(const FCookedCampaignSourceInfo& Source, TArray<uint8>& OutBytes) const
+        {
+            // Encode the string table
+            TArray<uint32> Offsets;
+            TArray<uint8> StringBytes;
+            Offsets.Reserve(Strings.Num() + 1);
+
+            for (const FString& Value : Strings)
+            {
+                Offsets.Add(StringBytes.Num());
+                FTCHARToUTF8 Utf8(*Value);
+                StringBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            }
+            Offsets.Add(StringBytes.Num());
+
+            FCookedCampaignHeader Header;
+            Header.Magic = CookedCampaign::Magic;
+            Header.Version = CookedCampaign::Version;
+            Header.SourceHash = Source.Hash;
+            Header.SourceSize = Source.Size;
+            Header.SourceTimestampTicks = Source.TimestampTicks;
+            Header.StringCount = Strings.Num();
+            Header.StringTableOffset = sizeof(FCookedCampaignHeader);
+            Header.PayloadOffset = Header.StringTableOffset + Offsets.Num() * sizeof(uint32) + StringBytes.Num();
+            Header.PayloadSize = Payload.Num();
+
+            OutBytes.Reset(Header.PayloadOffset + Header.PayloadSize);
+            OutBytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+            OutBytes.Append(reinterpret_cast<const uint8*>(Offsets.GetData()), Offsets.Num() * sizeof(uint32));
+            OutBytes.Append(StringBytes);
+            OutBytes.Append(Payload);
+        }
+
+    private:
+        void Append(const void* Data, int32 Size)
+        {
+            Payload.Append(static_cast<const uint8*>(Data), Size);
+        }
+
+        TArray<uint8> Payload;
+        TArray<FString> Strings;
+        TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> StringIndices;
+    };
+
+    /**
+     * Bounds-checked forward reader over a mapped cooked campaign.
+     * Any out-of-range access latches bError and returns default values.
+     */
+    class FCookedCampaignReader
+    {
+    public:
+        FCookedCampaignReader(const uint8* Data, const FCookedCampaignHeader& Header)
+            : bError(false)
+        {
+            StringCount = Header.StringCount;
+            StringOffsets = reinterpret_cast<const uint32*>(Data + Header.StringTableOffset);
+            StringBytes = Data + Header.StringTableOffset + (StringCount + 1) * sizeof(uint32);
+            StringBytesSize = (Data + Header.PayloadOffset) - StringBytes;
+            Cursor = Data + Header.PayloadOffset;
+            End = Cursor + Header.PayloadSize;
+        }
+
+        uint32 ReadU32() { uint32 Value = 0; Read(&Value, sizeof(Value)); return Value; }
+        int32 ReadI32() { int32 Value = 0; Read(&Value, sizeof(Value)); return Value; }
+        float ReadF32() { float Value = 0.0f; Read(&Value, sizeof(Value)); return Value; }
+        bool ReadBool() { uint8 Byte = 0; Read(&Byte, 1); return Byte != 0; }
+
+        FString ReadString()
+        {
+            const uint32 Index = ReadU32();
+            if (bError || Index >= StringCount)
+            {
+                bError = true;
+                return FString();
+            }
+
+            const uint32 Begin = StringOffsets[Index];
+            const uint32 Finish = StringOffsets[Index + 1];
+            if (Begin > Finish || Finish > StringBytesSize)
+            {
+                bError = true;
+                return FString();
+            }
+
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(StringBytes + Begin), Finish - Begin);
+            return FString(Converted.Length(), Converted.Get());
+        }
+
+        void ReadStringArray(TArray<FString>& OutValues)
+        {
+            const uint32 Count = ReadCount(sizeof(uint32));
+            OutValues.Reset(Count);
+            for (uint32 i = 0; i < Count && !bError; i++)
+            {
+                OutValues.Add(ReadString());
+            }
+        }
+
+        /** Read an element count and reject counts the remaining payload cannot possibly hold */
+        uint32 ReadCount(int64 MinElementSize)
+        {
+            const uint32 Count = ReadU32();
+            if (static_cast<int64>(Count) * MinElementSize > End - Cursor)
+            {
+                bError = true;
+                return 0;
+            }
+            return Count;
+        }
+
+        bool HasError() const { return bError; }
+        bool IsAtEnd() const { return Cursor == End; }
+
+    private:
+        void Read(void* Out, int64 Bytes)
+        {
+            if (bError || End - Cursor < Bytes)
+            {
+                bError = true;
+                return;
+            }
+            FMemory::Memcpy(Out, Cursor, Bytes);
+            Cursor += Bytes;
+        }
+
+        const uint8* Cursor;
+        const uint8* End;
+        const uint32* StringOffsets;
+        const uint8* StringBytes;
+        int64 StringBytesSize;
+        uint32 StringCount;
+        bool bError;
+    };
+
+    // Record writers/readers. Keep each pair in the same field order.
+
+    void WriteLayout(FCookedCampaignWriter& Writer, const FMapLayout& Layout)
+    {
+        Writer.WriteString(Layout.Name);
+        Writer.WriteString(Layout.LayoutType);
+        Writer.WriteString(Layout.Description);
+        Writer.WriteF32(Layout.EstimatedTimeHours);
+        Writer.WriteStringArray(Layout.KeyFeatures);
+    }
+
+    void ReadLayout(FCookedCampaignReader& Reader, FMapLayout& OutLayout)
+    {
+        OutLayout.Name = Reader.ReadString();
+        OutLayout.LayoutType = Reader.ReadString();
+        OutLayout.Description = Reader.ReadString();
+        OutLayout.EstimatedTimeHours = Reader.ReadF32();
+        Reader.ReadStringArray(OutLayout.KeyFeatures);
+    }
+
+    void WriteQuest(FCookedCampaignWriter& Writer, const FQuestData& Quest)
+    {
+        Writer.WriteString(Quest.Title);
+        Writer.WriteString(Quest.Description);
+        Writer.WriteString(Quest.QuestType);
+        Writer.WriteString(Quest.RewardType);
+        Writer.WriteString(Quest.Difficulty);
+        Writer.WriteI32(Quest.EstimatedTimeMinutes);
+    }
+
+    void ReadQuest(FCookedCampaignReader& Reader, FQuestData& OutQuest)
+    {
+        OutQuest.Title = Reader.ReadString();
+        OutQuest.Description = Reader.ReadString();
+        OutQuest.QuestType = Reader.ReadString();
+        OutQuest.RewardType = Reader.ReadString();
+        OutQuest.Difficulty = Reader.ReadString();
+        OutQuest.EstimatedTimeMinutes = Reader.ReadI32();
+    }
+
+    void WriteNPC(FCookedCampaignWriter& Writer, const FNPCData& NPC)
+    {
+        Writer.WriteString(NPC.Name);
+        Writer.WriteString(NPC.Species);
+        Writer.WriteString(NPC.Faction);
+        Writer.WriteString(NPC.Alignment);
+        Writer.WriteBool(NPC.bLikesPlayer);
+        Writer.WriteString(NPC.Role);
+        Writer.WriteString(NPC.Backstory);
+        Writer.WriteStringArray(NPC.PersonalityTraits);
+        Writer.WriteString(NPC.Location);
+        WriteQuest(Writer, NPC.Quest);
+        Writer.WriteString(NPC.DialogueStyle);
+        Writer.WriteI32(NPC.ReputationStanding);
+    }
+
+    void ReadNPC(FCookedCampaignReader& Reader, FNPCData& OutNPC)
+    {
+        OutNPC.Name = Reader.ReadString();
+        OutNPC.Species = Reader.ReadString();
+        OutNPC.Faction = Reader.ReadString();
+        OutNPC.Alignment = Reader.ReadString();
+        OutNPC.bLikesPlayer = Reader.ReadBool();
+        OutNPC.Role = Reader.ReadString();
+        OutNPC.Backstory = Reader.ReadString();
+        Reader.ReadStringArray(OutNPC.PersonalityTraits);
+        OutNPC.Location = Reader.ReadString();
+        ReadQuest(Reader, OutNPC.Quest);
+        OutNPC.DialogueStyle = Reader.ReadString();
+        OutNPC.ReputationStanding = Reader.ReadI32();
+    }
+
+    void WriteEnemy(FCookedCampaignWriter& Writer, const FCampaignEnemyData& Enemy)
+    {
+        Writer.WriteString(Enemy.Name);
+        Writer.WriteString(Enemy.Species);
+        Writer.WriteF32(Enemy.ChallengeRating);
+        Writer.WriteI32(Enemy.HitPoints);
+        Writer.WriteI32(Enemy.ArmorClass);
+        Writer.WriteStringArray(Enemy.Abilities);
+        Writer.WriteStringArray(Enemy.LootTable);
+        Writer.WriteStringArray(Enemy.BiomePreference);
+        Writer.WriteString(Enemy.Faction);
+        Writer.WriteString(Enemy.Description);
+    }
+
+    void ReadEnemy(FCookedCampaignReader& Reader, FCampaignEnemyData& OutEnemy)
+    {
+        OutEnemy.Name = Reader.ReadString();
+        OutEnemy.Species = Reader.ReadString();
+        OutEnemy.ChallengeRating = Reader.ReadF32();
+        OutEnemy.HitPoints = Reader.ReadI32();
+        OutEnemy.ArmorClass = Reader.ReadI32();
+        Reader.ReadStringArray(OutEnemy.Abilities);
+        Reader.ReadStringArray(OutEnemy.LootTable);
+        Reader.ReadStringArray(OutEnemy.BiomePreference);
+        OutEnemy.Faction = Reader.ReadString();
+        OutEnemy.Description = Reader.ReadString();
+    }
+
+    void WritePlanet(FCookedCampaignWriter& Writer, const FPlanetData& Planet)
+    {
+        Writer.WriteString(Planet.Name);
+        Writer.WriteString(Planet.Biome);
+        Writer.WriteString(Planet.Climate);
+        Writer.WriteString(Planet.Population);
+        Writer.WriteString(Planet.Government);
+        Writer.WriteString(Planet.MainQuest);
+        Writer.WriteStringArray(Planet.SideQuests);
+        Writer.WriteString(Planet.DifficultyTier);
+        Writer.WriteI32(Planet.PlanetIndex);
+        Writer.WriteString(Planet.LoreDescription);
+
+        Writer.WriteU32(Planet.Layouts.Num());
+        for (const FMapLayout& Layout : Planet.Layouts)
+        {
+            WriteLayout(Writer, Layout);
+        }
+
+        Writer.WriteU32(Planet.NPCs.Num());
+        for (const FNPCData& NPC : Planet.NPCs)
+        {
+            WriteNPC(Writer, NPC);
+        }
+
+        Writer.WriteU32(Planet.Enemies.Num());
+        for (const FCampaignEnemyData& Enemy : Planet.Enemies)
+        {
+            WriteEnemy(Writer, Enemy);
+        }
+    }
+
+    void ReadPlanet(FCookedCampaignReader& Reader, FPlanetData& OutPlanet)
+    {
+        OutPlanet.Name = Reader.ReadString();
+        OutPlanet.Biome = Reader.ReadString();
+        OutPlanet.Climate = Reader.ReadString();
+        OutPlanet.Population = Reader.ReadString();
+        OutPlanet.Government = Reader.ReadString();
+        OutPlanet.MainQuest = Reader.ReadString();
+        Reader.ReadStringArray(OutPlanet.SideQuests);
+        OutPlanet.DifficultyTier = Reader.ReadString();
+        OutPlanet.PlanetIndex = Reader.ReadI32();
+        OutPlanet.LoreDescription = Reader.ReadString();
+
+        const uint32 LayoutCount = Reader.ReadCount(4 * sizeof(uint32));
+        OutPlanet.Layouts.SetNum(LayoutCount);
+        for (FMapLayout& Layout : OutPlanet.Layouts)
+        {
+            ReadLayout(Reader, Layout);
+        }
+
+        const uint32 NPCCount = Reader.ReadCount(10 * sizeof(uint32));
+        OutPlanet.NPCs.SetNum(NPCCount);
+        for (FNPCData& NPC : OutPlanet.NPCs)
+        {
+            ReadNPC(Reader, NPC);
+        }
+
+        const uint32 EnemyCount = Reader.ReadCount(10 * sizeof(uint32));
+        OutPlanet.Enemies.SetNum(EnemyCount);
+        for (FCampaignEnemyData& Enemy : OutPlanet.Enemies)
+        {
+            ReadEnemy(Reader, Enemy);
+        }
+    }
+
+    void WriteLoot(FCookedCampaignWriter& Writer, const FLootItem& Item)
+    {
+        Writer.WriteString(Item.Name);
+        Writer.WriteString(Item.Rarity);
+        Writer.WriteString(Item.ItemType);
+        Writer.WriteString(Item.FlavorText);
+        Writer.WriteI32(Item.ValueCredits);
+        Writer.WriteI32(Item.LevelRequirement);
+        Writer.WriteString(Item.FactionTheme);
+
+        Writer.WriteU32(Item.Bonuses.Num());
+        for (const TPair<FString, int32>& Bonus : Item.Bonuses)
+        {
+            Writer.WriteString(Bonus.Key);
+            Writer.WriteI32(Bonus.Value);
+        }
+    }
+
+    void ReadLoot(FCookedCampaignReader& Reader, FLootItem& OutItem)
+    {
+        OutItem.Name = Reader.ReadString();
+        OutItem.Rarity = Reader.ReadString();
+        OutItem.ItemType = Reader.ReadString();
+        OutItem.FlavorText = Reader.ReadString();
+        OutItem.ValueCredits = Reader.ReadI32();
+        OutItem.LevelRequirement = Reader.ReadI32();
+        OutItem.FactionTheme = Reader.ReadString();
+
+        const uint32 BonusCount = Reader.ReadCount(2 * sizeof(uint32));
+        OutItem.Bonuses.Empty(BonusCount);
+        for (uint32 i = 0; i < BonusCount && !Reader.HasError(); i++)
+        {
+            FString Key = Reader.ReadString();
+            OutItem.Bonuses.Add(MoveTemp(Key), Reader.ReadI32());
+        }
+    }
+
+    void WriteBoss(FCookedCampaignWriter& Writer, const FBossData& Boss)
+    {
+        Writer.WriteString(Boss.Name);
+        Writer.WriteString(Boss.Title);
+        Writer.WriteString(Boss.Species);
+        Writer.WriteString(Boss.Motivation);
+        Writer.WriteString(Boss.Backstory);
+        Writer.WriteStringArray(Boss.Mechanics);
+        Writer.WriteString(Boss.ArenaDescription);
+        WriteLoot(Writer, Boss.LootDrop);
+        Writer.WriteF32(Boss.ChallengeRating);
+        Writer.WriteI32(Boss.HitPoints);
+        Writer.WriteI32(Boss.ArmorClass);
+        Writer.WriteStringArray(Boss.SpecialAbilities);
+        Writer.WriteStringArray(Boss.Weaknesses);
+        Writer.WriteStringArray(Boss.Minions);
+    }
+
+    void ReadBoss(FCookedCampaignReader& Reader, FBossData& OutBoss)
+    {
+        OutBoss.Name = Reader.ReadString();
+        OutBoss.Title = Reader.ReadString();
+        OutBoss.Species = Reader.ReadString();
+        OutBoss.Motivation = Reader.ReadString();
+        OutBoss.Backstory = Reader.ReadString();
+        Reader.ReadStringArray(OutBoss.Mechanics);
+        OutBoss.ArenaDescription = Reader.ReadString();
+        ReadLoot(Reader, OutBoss.LootDrop);
+        OutBoss.ChallengeRating = Reader.ReadF32();
+        OutBoss.HitPoints = Reader.ReadI32();
+        OutBoss.ArmorClass = Reader.ReadI32();
+        Reader.ReadStringArray(OutBoss.SpecialAbilities);
+        Reader.ReadStringArray(OutBoss.Weaknesses);
+        Reader.ReadStringArray(OutBoss.Minions);
+    }
+}
+
+void FCookedCampaignFormat::Write(const FCampaignPlan& Plan, const FCookedCampaignSourceInfo& Source, TArray<uint8>& OutBytes)
+{
+    FCookedCampaignWriter Writer;
+
+    // Config
+    Writer.WriteI32(Plan.Config.GameLengthHours);
+    Writer.WriteI32(Plan.Config.EstimatedPlanets);
+    Writer.WriteString(Plan.Config.StorySeed);
+    Writer.WriteString(Plan.Config.TimePeriod);
+    Writer.WriteString(Plan.Config.AlignmentFocus);
+
+    // Planets
+    Writer.WriteU32(Plan.Planets.Num());
+    for (const FPlanetData& Planet : Plan.Planets)
+    {
+        WritePlanet(Writer, Planet);
+    }
+
+    // Final boss and summary text
+    WriteBoss(Writer, Plan.FinalBoss);
+    Writer.WriteString(Plan.MainQuestOutline);
+    Writer.WriteString(Plan.CampaignSummary);
+
+    Writer.Finalize(Source, OutBytes);
+}
+
+bool FCookedCampaignFormat::ReadHeader(const uint8* Data, int64 Size, FCookedCampaignHeader& OutHeader)
+{
+    if (!Data || Size < static_cast<int64>(sizeof(FCookedCampaignHeader)))
+    {
+        return false;
+    }
+
+    FMemory::Memcpy(&OutHeader, Data, sizeof(FCookedCampaignHeader));
+
+    if (OutHeader.Magic != CookedCampaign::Magic || OutHeader.Version != CookedCampaign::Version)
+    {
+        return false;
+    }
+
+    // Sections must be ordered and fit inside the file
+    const int64 StringTableEnd = static_cast<int64>(OutHeader.StringTableOffset) + (static_cast<int64>(OutHeader.StringCount) + 1) * sizeof(uint32);
+    return OutHeader.StringTableOffset >= sizeof(FCookedCampaignHeader) &&
+           StringTableEnd <= OutHeader.PayloadOffset &&
+           static_cast<int64>(OutHeader.PayloadOffset) + OutHeader.PayloadSize <= Size;
+}
+
+bool FCookedCampaignFormat::Read(const uint8* Data, int64 Size, FCampaignPlan& OutPlan)
+{
+    FCookedCampaignHeader Header;
+    if (!ReadHeader(Data, Size, Header))
+    {
+        return false;
+    }
+
+    FCookedCampaignReader Reader(Data, Header);
+
+    // Config
+    OutPlan.Config.GameLengthHours = Reader.ReadI32();
+    OutPlan.Config.EstimatedPlanets = Reader.ReadI32();
+    OutPlan.Config.StorySeed = Reader.ReadString();
+    OutPlan.Config.TimePeriod = Reader.ReadString();
+    OutPlan.Config.AlignmentFocus = Reader.ReadString();
+
+    // Planets
+    const uint32 PlanetCount = Reader.ReadCount(10 * sizeof(uint32));
+    OutPlan.Planets.SetNum(PlanetCount);
+    for (FPlanetData& Planet : OutPlan.Planets)
+    {
+        ReadPlanet(Reader, Planet);
+        if (Reader.HasError())
+        {
+            break;
+        }
+    }
+
+    // Final boss and summary text
+    ReadBoss(Reader, OutPlan.FinalBoss);
+    OutPlan.MainQuestOutline = Reader.ReadString();
+    OutPlan.CampaignSummary = Reader.ReadString();
+
+    return !Reader.HasError() && Reader.IsAtEnd();
+}
+
+uint64 FCookedCampaignFormat::HashSource(const uint8* Data, int64 Size)
+{
+    return FXxHash64::HashBuffer(Data, Size).Hash;
+}
+
+bool FCookedCampaignFormat::IsUpToDate(const FCookedCampaignHeader& Header, const FString& JsonFilePath, bool& bOutNeedsRestamp)
+{
+    bOutNeedsRestamp = false;
+    IFileManager& FileManager = IFileManager::Get();
+
+    const int64 SourceSize = FileManager.FileSize(*JsonFilePath);
+    if (SourceSize < 0)
+    {
+        // Cooked-only distribution, nothing to compare against
+        return true;
+    }
+
+    if (SourceSize == Header.SourceSize &&
+        FileManager.GetTimeStamp(*JsonFilePath).GetTicks() == Header.SourceTimestampTicks)
+    {
+        return true;
+    }
+
+    // Size or timestamp changed - fall back to comparing content hashes
+    TArray<uint8> SourceBytes;
+    if (!FFileHelper::LoadFileToArray(SourceBytes, *JsonFilePath))
+    {
+        return false;
+    }
+
+    if (HashSource(SourceBytes.GetData(), SourceBytes.Num()) != Header.SourceHash)
+    {
+        return false;
+    }
+
+    // Same content under a new timestamp (checkout, copy): worth re-stamping so this is the last hash
+    bOutNeedsRestamp = true;
+    return true;
+}
+
+bool FCookedCampaignFormat::RestampSource(const FString& CookedPath, const FCookedCampaignHeader& Header, const FString& JsonFilePath)
+{
+    IFileManager& FileManager = IFileManager::Get();
+
+    FCookedCampaignHeader Restamped = Header;
+    Restamped.SourceSize = FileManager.FileSize(*JsonFilePath);
+    Restamped.SourceTimestampTicks = FileManager.GetTimeStamp(*JsonFilePath).GetTicks();
+    if (Restamped.SourceSize < 0)
+    {
+        return false;
+    }
+
+    // Append mode keeps the existing payload; only the header bytes are overwritten
+    TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*CookedPath, true));
+    return FileHandle &&
+           FileHandle->Seek(0) &&
+           FileHandle->Write(reinterpret_cast<const uint8*>(&Restamped), sizeof(Restamped));
+}
+
+FCookedCampaignSourceInfo FCookedCampaignFormat::MakeSourceInfo(const FString& JsonFilePath, const TArray<uint8>& JsonBytes)
+{
+    FCookedCampaignSourceInfo Source;
+    Source.Hash = HashSource(JsonBytes.GetData(), JsonBytes.Num());
+    Source.Size = JsonBytes.Num();
+    Source.TimestampTicks = IFileManager::Get().GetTimeStamp(*JsonFilePath).GetTicks();
+    return Source;
+}
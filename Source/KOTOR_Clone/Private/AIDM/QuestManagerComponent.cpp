@@ -1,8 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AIDM/QuestManagerComponent.h"
+#include "AIDM/AIDMGameplayEventSubsystem.h"
+#include "AIDM/SaveGameContainer.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "Algo/Sort.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -13,6 +16,7 @@ UQuestManagerComponent::UQuestManagerComponent()
     PrimaryComponentTick.bCanEverTick = false;
     
     NextQuestID = 1;
+    NextStartSequence = 0;
     bDebugMode = false;
 }
 
@@ -20,18 +24,47 @@ void UQuestManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Objectives advance from kills, pickups, dialogue and layout changes pushed on the event bus
+    if (UAIDMGameplayEventSubsystem* EventBus = UAIDMGameplayEventSubsystem::Get(this))
+    {
+        for (int32 TypeIndex = 1; TypeIndex < static_cast<int32>(EAIDMGameplayEventType::Count); ++TypeIndex)
+        {
+            EventBus->OnEvent(static_cast<EAIDMGameplayEventType>(TypeIndex)).AddUObject(this, &UQuestManagerComponent::HandleGameplayEvent);
+        }
+    }
+    
+    // Quest symbols are campaign-scoped; re-intern them when a new campaign is loaded
+    FAIDMSymbolTable::Get().OnReset().AddUObject(this, &UQuestManagerComponent::HandleSymbolsReset);
+    
     UE_LOG(LogTemp, Log, TEXT("QuestManagerComponent: Initialized"));
 }
 
+void UQuestManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UAIDMGameplayEventSubsystem* EventBus = UAIDMGameplayEventSubsystem::Get(this))
+    {
+        for (int32 TypeIndex = 1; TypeIndex < static_cast<int32>(EAIDMGameplayEventType::Count); ++TypeIndex)
+        {
+            EventBus->OnEvent(static_cast<EAIDMGameplayEventType>(TypeIndex)).RemoveAll(this);
+        }
+    }
+    
+    FAIDMSymbolTable::Get().OnReset().RemoveAll(this);
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 FString UQuestManagerComponent::StartQuest(const FQuestData& QuestData, const FString& QuestGiverName, 
                                           int32 PlanetIndex, const FString& LayoutName)
 {
     // Create new active quest
     FActiveQuest NewQuest;
     NewQuest.QuestID = GenerateQuestID();
+    NewQuest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, NewQuest.QuestID);
     NewQuest.QuestData = QuestData;
     NewQuest.State = EQuestState::Active;
     NewQuest.StartTime = GetWorld()->GetTimeSeconds();
+    NewQuest.StartSequence = NextStartSequence;
     NewQuest.QuestGiverName = QuestGiverName;
     NewQuest.PlanetIndex = PlanetIndex;
     NewQuest.LayoutName = LayoutName;
@@ -39,45 +72,50 @@ FString UQuestManagerComponent::StartQuest(const FQuestData& QuestData, const FS
     // Create default objectives based on quest type
     CreateDefaultObjectives(NewQuest);
     
-    // Add to active quests
-    ActiveQuests.Add(NewQuest);
+    // Add to active quests (and the quest/objective indices)
+    const FString QuestID = NewQuest.QuestID;
+    AddActiveQuest(MoveTemp(NewQuest));
+    const FActiveQuest& StartedQuest = ActiveQuests.Last();
     
     // Broadcast events
-    OnQuestStarted.Broadcast(NewQuest);
-    OnQuestStartedEvent(NewQuest);
+    OnQuestStarted.Broadcast(StartedQuest);
+    OnQuestStartedEvent(StartedQuest);
     
     if (bDebugMode)
     {
-        LogQuestEvent(TEXT("STARTED"), NewQuest);
+        LogQuestEvent(TEXT("STARTED"), StartedQuest);
     }
     
-    return NewQuest.QuestID;
+    return QuestID;
 }
 
 bool UQuestManagerComponent::CompleteQuest(const FString& QuestID)
 {
-    FActiveQuest* Quest = FindActiveQuest(QuestID);
-    if (!Quest)
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    if (Slot == INDEX_NONE)
     {
         UE_LOG(LogTemp, Warning, TEXT("QuestManagerComponent: Quest %s not found or not active"), *QuestID);
         return false;
     }
     
+    // Move out of the active list first; the copy outlives the array shuffle
+    FActiveQuest Quest = RemoveActiveQuest(Slot);
+    
     // Update quest state
-    Quest->State = EQuestState::Completed;
-    Quest->CompletionTime = GetWorld()->GetTimeSeconds();
+    Quest.State = EQuestState::Completed;
+    Quest.CompletionTime = GetWorld()->GetTimeSeconds();
     
     // Move to completed quests
-    CompletedQuests.Add(*Quest);
-    ActiveQuests.RemoveAll([QuestID](const FActiveQuest& Q) { return Q.QuestID == QuestID; });
+    CompletedQuestIndex.Add(Quest.QuestSymbol);
+    CompletedQuests.Add(Quest);
     
     // Broadcast events
-    OnQuestCompleted.Broadcast(*Quest);
-    OnQuestCompletedEvent(*Quest);
+    OnQuestCompleted.Broadcast(Quest);
+    OnQuestCompletedEvent(Quest);
     
     if (bDebugMode)
     {
-        LogQuestEvent(TEXT("COMPLETED"), *Quest);
+        LogQuestEvent(TEXT("COMPLETED"), Quest);
     }
     
     return true;
@@ -85,27 +123,28 @@ bool UQuestManagerComponent::CompleteQuest(const FString& QuestID)
 
 bool UQuestManagerComponent::FailQuest(const FString& QuestID)
 {
-    FActiveQuest* Quest = FindActiveQuest(QuestID);
-    if (!Quest)
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    if (Slot == INDEX_NONE)
     {
         UE_LOG(LogTemp, Warning, TEXT("QuestManagerComponent: Quest %s not found or not active"), *QuestID);
         return false;
     }
     
+    FActiveQuest Quest = RemoveActiveQuest(Slot);
+    
     // Update quest state
-    Quest->State = EQuestState::Failed;
-    Quest->CompletionTime = GetWorld()->GetTimeSeconds();
+    Quest.State = EQuestState::Failed;
+    Quest.CompletionTime = GetWorld()->GetTimeSeconds();
     
     // Move to failed quests
-    FailedQuests.Add(*Quest);
-    ActiveQuests.RemoveAll([QuestID](const FActiveQuest& Q) { return Q.QuestID == QuestID; });
+    FailedQuests.Add(Quest);
     
     // Broadcast events
-    OnQuestFailed.Broadcast(*Quest);
+    OnQuestFailed.Broadcast(Quest);
     
     if (bDebugMode)
     {
-        LogQuestEvent(TEXT("FAILED"), *Quest);
+        LogQuestEvent(TEXT("FAILED"), Quest);
     }
     
     return true;
@@ -113,21 +152,107 @@ bool UQuestManagerComponent::FailQuest(const FString& QuestID)
 
 bool UQuestManagerComponent::UpdateQuestObjective(const FString& QuestID, int32 ObjectiveIndex, int32 Progress)
 {
-    FActiveQuest* Quest = FindActiveQuest(QuestID);
-    if (!Quest)
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    if (Slot == INDEX_NONE)
     {
         UE_LOG(LogTemp, Warning, TEXT("QuestManagerComponent: Quest %s not found or not active"), *QuestID);
         return false;
     }
     
-    if (ObjectiveIndex < 0 || ObjectiveIndex >= Quest->Objectives.Num())
+    if (!ActiveQuests[Slot].Objectives.IsValidIndex(ObjectiveIndex))
     {
         UE_LOG(LogTemp, Warning, TEXT("QuestManagerComponent: Invalid objective index %d for quest %s"), 
                ObjectiveIndex, *QuestID);
         return false;
     }
     
-    FQuestObjective& Objective = Quest->Objectives[ObjectiveIndex];
+    return AdvanceObjective(Slot, ObjectiveIndex, Progress);
+}
+
+bool UQuestManagerComponent::SetObjectiveTarget(const FString& QuestID, int32 ObjectiveIndex, const FString& TargetID,
+                                                EAIDMGameplayEventType TriggerEvent)
+{
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    if (Slot == INDEX_NONE || !ActiveQuests[Slot].Objectives.IsValidIndex(ObjectiveIndex))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("QuestManagerComponent: Cannot bind objective %d of quest %s"), ObjectiveIndex, *QuestID);
+        return false;
+    }
+    
+    FActiveQuest& Quest = ActiveQuests[Slot];
+    FQuestObjective& Objective = Quest.Objectives[ObjectiveIndex];
+    
+    UnindexObjective(Quest.QuestSymbol, ObjectiveIndex, Objective);
+    Objective.TargetID = TargetID;
+    Objective.TriggerEvent = TriggerEvent;
+    IndexObjective(Quest.QuestSymbol, ObjectiveIndex, Objective);
+    SaveRevision.MarkChanged();
+    
+    return true;
+}
+
+int32 UQuestManagerComponent::AdvanceObjectivesForTarget(const FString& TargetID, int32 Progress)
+{
+    // Snapshot the matches: completing an objective or quest edits the index
+    TArray<FQuestObjectiveRef> Matches;
+    for (const TMultiMap<FString, FQuestObjectiveRef>& Table : ObjectiveTargetIndex)
+    {
+        Table.MultiFind(TargetID, Matches);
+    }
+    
+    return AdvanceObjectives(Matches, Progress);
+}
+
+void UQuestManagerComponent::HandleGameplayEvent(const FAIDMGameplayEvent& Event)
+{
+    // Predicate table: objectives waiting on this event type, keyed by target. Objectives without a
+    // trigger event only advance through AdvanceObjectivesForTarget, as they did before the bus.
+    const TMultiMap<FString, FQuestObjectiveRef>& TypedTable = ObjectiveTargetIndex[static_cast<int32>(Event.Type)];
+    
+    TArray<FQuestObjectiveRef> Matches;
+    if (!Event.TargetID.IsEmpty())
+    {
+        TypedTable.MultiFind(Event.TargetID, Matches);
+    }
+    if (!Event.TargetName.IsEmpty() && Event.TargetName != Event.TargetID)
+    {
+        TypedTable.MultiFind(Event.TargetName, Matches);
+    }
+    
+    if (Matches.Num() == 0)
+    {
+        return;
+    }
+    
+    const int32 UpdatedCount = AdvanceObjectives(Matches, Event.Count);
+    
+    if (bDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("QuestManagerComponent: Event %s on %s advanced %d objectives"),
+               *UEnum::GetValueAsString(Event.Type), *Event.TargetID, UpdatedCount);
+    }
+}
+
+int32 UQuestManagerComponent::AdvanceObjectives(const TArray<FQuestObjectiveRef>& Matches, int32 Progress)
+{
+    int32 UpdatedCount = 0;
+    for (const FQuestObjectiveRef& Ref : Matches)
+    {
+        // Earlier matches may have completed (and removed) this quest
+        const int32* Slot = ActiveQuestIndex.Find(Ref.QuestSymbol);
+        if (Slot && AdvanceObjective(*Slot, Ref.ObjectiveIndex, Progress))
+        {
+            UpdatedCount++;
+        }
+    }
+    
+    return UpdatedCount;
+}
+
+bool UQuestManagerComponent::AdvanceObjective(int32 Slot, int32 ObjectiveIndex, int32 Progress)
+{
+    FActiveQuest& Quest = ActiveQuests[Slot];
+    FQuestObjective& Objective = Quest.Objectives[ObjectiveIndex];
     
     // Don't update if already completed
     if (Objective.bIsCompleted)
@@ -137,25 +262,36 @@ bool UQuestManagerComponent::UpdateQuestObjective(const FString& QuestID, int32
     
     // Update progress
     Objective.CurrentProgress = FMath::Min(Objective.CurrentProgress + Progress, Objective.RequiredProgress);
+    SaveRevision.MarkChanged();
     
     // Check if objective is now completed
     if (Objective.CurrentProgress >= Objective.RequiredProgress)
     {
         Objective.bIsCompleted = true;
         
+        UnindexObjective(Quest.QuestSymbol, ObjectiveIndex, Objective);
+        
+        if (!Objective.bIsOptional)
+        {
+            Quest.RemainingObjectives--;
+        }
+        
         if (bDebugMode)
         {
             UE_LOG(LogTemp, Log, TEXT("QuestManagerComponent: Objective %d completed for quest %s"), 
-                   ObjectiveIndex, *QuestID);
+                   ObjectiveIndex, *Quest.QuestID);
         }
     }
     
     // Broadcast objective updated event
+    const FString QuestID = Quest.QuestID;
+    const FAIDMId QuestSymbol = Quest.QuestSymbol;
     OnQuestObjectiveUpdated.Broadcast(QuestID, ObjectiveIndex);
-    OnQuestObjectiveUpdatedEvent(*Quest, ObjectiveIndex);
+    OnQuestObjectiveUpdatedEvent(Quest, ObjectiveIndex);
     
-    // Check if all objectives are completed
-    if (AreAllObjectivesCompleted(*Quest))
+    // Handlers may have started or finished quests, so re-resolve the slot before completing
+    const int32* CurrentSlot = ActiveQuestIndex.Find(QuestSymbol);
+    if (CurrentSlot && ActiveQuests[*CurrentSlot].RemainingObjectives <= 0)
     {
         CompleteQuest(QuestID);
     }
@@ -165,20 +301,16 @@ bool UQuestManagerComponent::UpdateQuestObjective(const FString& QuestID, int32
 
 FActiveQuest UQuestManagerComponent::GetActiveQuest(const FString& QuestID) const
 {
-    for (const FActiveQuest& Quest : ActiveQuests)
-    {
-        if (Quest.QuestID == QuestID)
-        {
-            return Quest;
-        }
-    }
-    
-    return FActiveQuest();
+    const FActiveQuest* Quest = FindActiveQuest(QuestID);
+    return Quest ? *Quest : FActiveQuest();
 }
 
 TArray<FActiveQuest> UQuestManagerComponent::GetActiveQuests() const
 {
-    return ActiveQuests;
+    // Slots are swap-removed, so present the copy in journal (start) order
+    TArray<FActiveQuest> Result = ActiveQuests;
+    Algo::SortBy(Result, &FActiveQuest::StartSequence);
+    return Result;
 }
 
 TArray<FActiveQuest> UQuestManagerComponent::GetCompletedQuests() const
@@ -193,15 +325,8 @@ bool UQuestManagerComponent::IsQuestActive(const FString& QuestID) const
 
 bool UQuestManagerComponent::IsQuestCompleted(const FString& QuestID) const
 {
-    for (const FActiveQuest& Quest : CompletedQuests)
-    {
-        if (Quest.QuestID == QuestID)
-        {
-            return true;
-        }
-    }
-    
-    return false;
+    const FAIDMId QuestSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Quest, QuestID);
+    return QuestSymbol.IsValid() && CompletedQuestIndex.Contains(QuestSymbol);
 }
 
 float UQuestManagerComponent::GetQuestCompletionPercentage(const FString& QuestID) const
@@ -250,7 +375,15 @@ void UQuestManagerComponent::ClearAllQuests()
     ActiveQuests.Empty();
     CompletedQuests.Empty();
     FailedQuests.Empty();
+    ActiveQuestIndex.Empty();
+    CompletedQuestIndex.Empty();
+    for (TMultiMap<FString, FQuestObjectiveRef>& Table : ObjectiveTargetIndex)
+    {
+        Table.Empty();
+    }
     NextQuestID = 1;
+    NextStartSequence = 0;
+    SaveRevision.MarkChanged();
     
     if (bDebugMode)
     {
@@ -264,6 +397,7 @@ FString UQuestManagerComponent::SaveQuestData() const
     
     // Save next quest ID
     SaveObject->SetNumberField(TEXT("next_quest_id"), NextQuestID);
+    SaveObject->SetNumberField(TEXT("next_start_sequence"), NextStartSequence);
     
     // Save active quests
     TArray<TSharedPtr<FJsonValue>> ActiveQuestsArray;
@@ -276,6 +410,7 @@ FString UQuestManagerComponent::SaveQuestData() const
         QuestObject->SetStringField(TEXT("quest_type"), Quest.QuestData.QuestType);
         QuestObject->SetNumberField(TEXT("state"), static_cast<int32>(Quest.State));
         QuestObject->SetNumberField(TEXT("start_time"), Quest.StartTime);
+        QuestObject->SetNumberField(TEXT("start_sequence"), Quest.StartSequence);
         QuestObject->SetStringField(TEXT("quest_giver"), Quest.QuestGiverName);
         QuestObject->SetNumberField(TEXT("planet_index"), Quest.PlanetIndex);
         QuestObject->SetStringField(TEXT("layout_name"), Quest.LayoutName);
@@ -290,6 +425,8 @@ FString UQuestManagerComponent::SaveQuestData() const
             ObjectiveObject->SetBoolField(TEXT("is_optional"), Objective.bIsOptional);
             ObjectiveObject->SetNumberField(TEXT("current_progress"), Objective.CurrentProgress);
             ObjectiveObject->SetNumberField(TEXT("required_progress"), Objective.RequiredProgress);
+            ObjectiveObject->SetStringField(TEXT("target_id"), Objective.TargetID);
+            ObjectiveObject->SetNumberField(TEXT("trigger_event"), static_cast<int32>(Objective.TriggerEvent));
             
             ObjectivesArray.Add(MakeShareable(new FJsonValueObject(ObjectiveObject)));
         }
@@ -341,6 +478,7 @@ bool UQuestManagerComponent::LoadQuestData(const FString& SaveData)
     
     // Load next quest ID
     JsonObject->TryGetNumberField(TEXT("next_quest_id"), NextQuestID);
+    JsonObject->TryGetNumberField(TEXT("next_start_sequence"), NextStartSequence);
     
     // Load active quests (basic implementation)
     const TArray<TSharedPtr<FJsonValue>>* ActiveQuestsArray;
@@ -353,6 +491,7 @@ bool UQuestManagerComponent::LoadQuestData(const FString& SaveData)
             {
                 FActiveQuest Quest;
                 (*QuestObject)->TryGetStringField(TEXT("quest_id"), Quest.QuestID);
+                Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
                 (*QuestObject)->TryGetStringField(TEXT("title"), Quest.QuestData.Title);
                 (*QuestObject)->TryGetStringField(TEXT("description"), Quest.QuestData.Description);
                 (*QuestObject)->TryGetStringField(TEXT("quest_type"), Quest.QuestData.QuestType);
@@ -364,6 +503,10 @@ bool UQuestManagerComponent::LoadQuestData(const FString& SaveData)
                 }
                 
                 (*QuestObject)->TryGetNumberField(TEXT("start_time"), Quest.StartTime);
+
+                // Data saved without sequences keeps its file order
+                Quest.StartSequence = NextStartSequence;
+                (*QuestObject)->TryGetNumberField(TEXT("start_sequence"), Quest.StartSequence);
                 (*QuestObject)->TryGetStringField(TEXT("quest_giver"), Quest.QuestGiverName);
                 (*QuestObject)->TryGetNumberField(TEXT("planet_index"), Quest.PlanetIndex);
                 (*QuestObject)->TryGetStringField(TEXT("layout_name"), Quest.LayoutName);
@@ -371,7 +514,28 @@ bool UQuestManagerComponent::LoadQuestData(const FString& SaveData)
                 // Create default objectives for loaded quest
                 CreateDefaultObjectives(Quest);
                 
-                ActiveQuests.Add(Quest);
+                // Restore objective targets bound at runtime (SetObjectiveTarget)
+                const TArray<TSharedPtr<FJsonValue>>* ObjectivesArray;
+                if ((*QuestObject)->TryGetArrayField(TEXT("objectives"), ObjectivesArray))
+                {
+                    for (int32 ObjectiveIndex = 0; ObjectiveIndex < ObjectivesArray->Num() && ObjectiveIndex < Quest.Objectives.Num(); ++ObjectiveIndex)
+                    {
+                        const TSharedPtr<FJsonObject>* ObjectiveObject;
+                        if ((*ObjectivesArray)[ObjectiveIndex]->TryGetObject(ObjectiveObject))
+                        {
+                            (*ObjectiveObject)->TryGetStringField(TEXT("target_id"), Quest.Objectives[ObjectiveIndex].TargetID);
+                            
+                            int32 TriggerEventValue;
+                            if ((*ObjectiveObject)->TryGetNumberField(TEXT("trigger_event"), TriggerEventValue) &&
+                                TriggerEventValue >= 0 && TriggerEventValue < static_cast<int32>(EAIDMGameplayEventType::Count))
+                            {
+                                Quest.Objectives[ObjectiveIndex].TriggerEvent = static_cast<EAIDMGameplayEventType>(TriggerEventValue);
+                            }
+                        }
+                    }
+                }
+                
+                AddActiveQuest(MoveTemp(Quest));
             }
         }
     }
@@ -384,6 +548,156 @@ bool UQuestManagerComponent::LoadQuestData(const FString& SaveData)
     return true;
 }
 
+namespace
+{
+    constexpr uint32 QuestChunkVersion = 1;
+}
+
+void UQuestManagerComponent::WriteSaveChunk(FSaveGameContainer& Container) const
+{
+    if (!SaveRevision.NeedsWrite(Container, SaveContainer::QuestChunk))
+    {
+        return;
+    }
+
+    FSaveChunkWriter Writer;
+    Writer.WriteVarI32(NextQuestID);
+    Writer.WriteVarI32(NextStartSequence);
+
+    // Unlike the JSON save, objectives are stored in full so progress survives a reload
+    Writer.WriteVarU32(ActiveQuests.Num());
+    for (const FActiveQuest& Quest : ActiveQuests)
+    {
+        Writer.WriteString(Quest.QuestID);
+        Writer.WriteString(Quest.QuestData.Title);
+        Writer.WriteString(Quest.QuestData.Description);
+        Writer.WriteString(Quest.QuestData.QuestType);
+        Writer.WriteU8(static_cast<uint8>(Quest.State));
+        Writer.WriteTimestamp(Quest.StartTime);
+        Writer.WriteVarI32(Quest.StartSequence);
+        Writer.WriteString(Quest.QuestGiverName);
+        Writer.WriteVarI32(Quest.PlanetIndex);
+        Writer.WriteString(Quest.LayoutName);
+
+        Writer.WriteVarU32(Quest.Objectives.Num());
+        for (const FQuestObjective& Objective : Quest.Objectives)
+        {
+            Writer.WriteString(Objective.Description);
+            Writer.WriteU8((Objective.bIsCompleted ? 1 : 0) | (Objective.bIsOptional ? 2 : 0));
+            Writer.WriteVarI32(Objective.CurrentProgress);
+            Writer.WriteVarI32(Objective.RequiredProgress);
+            Writer.WriteString(Objective.TargetID);
+            Writer.WriteU8(static_cast<uint8>(Objective.TriggerEvent));
+        }
+    }
+
+    Writer.WriteVarU32(CompletedQuests.Num());
+    for (const FActiveQuest& Quest : CompletedQuests)
+    {
+        Writer.WriteString(Quest.QuestID);
+        Writer.WriteString(Quest.QuestData.Title);
+        Writer.WriteTimestamp(Quest.CompletionTime);
+    }
+
+    TArray<uint8> Payload;
+    Writer.Finalize(Payload);
+    Container.SetChunk(SaveContainer::QuestChunk, QuestChunkVersion, MoveTemp(Payload));
+    SaveRevision.MarkSynced(Container);
+}
+
+bool UQuestManagerComponent::ReadSaveChunk(const FSaveGameContainer& Container)
+{
+    TArray<uint8> Payload;
+    if (!Container.GetChunk(SaveContainer::QuestChunk, QuestChunkVersion, Payload))
+    {
+        return false;
+    }
+
+    // Decode everything before touching live state so a damaged chunk leaves the journal as it was
+    FSaveChunkReader Reader(Payload);
+    const int32 SavedNextQuestID = Reader.ReadVarI32();
+    const int32 SavedNextStartSequence = Reader.ReadVarI32();
+
+    TArray<FActiveQuest> LoadedActive;
+    LoadedActive.SetNum(Reader.ReadCount());
+    for (FActiveQuest& Quest : LoadedActive)
+    {
+        Quest.QuestID = Reader.ReadString();
+        Quest.QuestData.Title = Reader.ReadString();
+        Quest.QuestData.Description = Reader.ReadString();
+        Quest.QuestData.QuestType = Reader.ReadString();
+
+        const uint8 StateValue = Reader.ReadU8();
+        Quest.State = StateValue <= static_cast<uint8>(EQuestState::TurnedIn) ? static_cast<EQuestState>(StateValue) : EQuestState::Active;
+
+        Quest.StartTime = Reader.ReadTimestamp();
+        Quest.StartSequence = Reader.ReadVarI32();
+        Quest.QuestGiverName = Reader.ReadString();
+        Quest.PlanetIndex = Reader.ReadVarI32();
+        Quest.LayoutName = Reader.ReadString();
+
+        Quest.Objectives.SetNum(Reader.ReadCount());
+        for (FQuestObjective& Objective : Quest.Objectives)
+        {
+            Objective.Description = Reader.ReadString();
+            const uint8 Flags = Reader.ReadU8();
+            Objective.bIsCompleted = (Flags & 1) != 0;
+            Objective.bIsOptional = (Flags & 2) != 0;
+            Objective.CurrentProgress = Reader.ReadVarI32();
+            Objective.RequiredProgress = Reader.ReadVarI32();
+            Objective.TargetID = Reader.ReadString();
+
+            const uint8 TriggerEventValue = Reader.ReadU8();
+            Objective.TriggerEvent = TriggerEventValue < static_cast<uint8>(EAIDMGameplayEventType::Count)
+                ? static_cast<EAIDMGameplayEventType>(TriggerEventValue)
+                : EAIDMGameplayEventType::None;
+        }
+    }
+
+    TArray<FActiveQuest> LoadedCompleted;
+    LoadedCompleted.SetNum(Reader.ReadCount());
+    for (FActiveQuest& Quest : LoadedCompleted)
+    {
+        Quest.QuestID = Reader.ReadString();
+        Quest.QuestData.Title = Reader.ReadString();
+        Quest.CompletionTime = Reader.ReadTimestamp();
+        Quest.State = EQuestState::Completed;
+    }
+
+    if (!Reader.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("QuestManagerComponent: Quest save chunk is corrupt"));
+        return false;
+    }
+
+    ClearAllQuests();
+    NextQuestID = SavedNextQuestID;
+    NextStartSequence = SavedNextStartSequence;
+
+    for (FActiveQuest& Quest : LoadedActive)
+    {
+        Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
+        AddActiveQuest(MoveTemp(Quest));
+    }
+
+    for (FActiveQuest& Quest : LoadedCompleted)
+    {
+        Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
+        CompletedQuestIndex.Add(Quest.QuestSymbol);
+        CompletedQuests.Add(MoveTemp(Quest));
+    }
+
+    // The journal now matches the chunk; an unchanged journal need not be re-encoded on the next save
+    SaveRevision.MarkSynced(Container);
+
+    if (bDebugMode)
+    {
+        UE_LOG(LogTemp, Log, TEXT("QuestManagerComponent: Loaded %d active and %d completed quests from save chunk"), ActiveQuests.Num(), CompletedQuests.Num());
+    }
+
+    return true;
+}
+
 FString UQuestManagerComponent::GenerateQuestID()
 {
     FString QuestID = FString::Printf(TEXT("QUEST_%04d"), NextQuestID);
@@ -393,28 +707,111 @@ FString UQuestManagerComponent::GenerateQuestID()
 
 FActiveQuest* UQuestManagerComponent::FindActiveQuest(const FString& QuestID)
 {
-    for (FActiveQuest& Quest : ActiveQuests)
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    return Slot != INDEX_NONE ? &ActiveQuests[Slot] : nullptr;
+}
+
+const FActiveQuest* UQuestManagerComponent::FindActiveQuest(const FString& QuestID) const
+{
+    const int32 Slot = FindActiveQuestSlot(QuestID);
+    return Slot != INDEX_NONE ? &ActiveQuests[Slot] : nullptr;
+}
+
+int32 UQuestManagerComponent::FindActiveQuestSlot(const FString& QuestID) const
+{
+    // A quest ID that was never interned cannot belong to any quest
+    const FAIDMId QuestSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Quest, QuestID);
+    if (!QuestSymbol.IsValid())
     {
-        if (Quest.QuestID == QuestID)
-        {
-            return &Quest;
-        }
+        return INDEX_NONE;
     }
 
-    return nullptr;
+    const int32* Slot = ActiveQuestIndex.Find(QuestSymbol);
+    return Slot ? *Slot : INDEX_NONE;
 }
 
-const FActiveQuest* UQuestManagerComponent::FindActiveQuest(const FString& QuestID) const
+void UQuestManagerComponent::AddActiveQuest(FActiveQuest&& Quest)
 {
-    for (const FActiveQuest& Quest : ActiveQuests)
+    Quest.RemainingObjectives = CountRemainingObjectives(Quest);
+
+    for (int32 ObjectiveIndex = 0; ObjectiveIndex < Quest.Objectives.Num(); ++ObjectiveIndex)
     {
-        if (Quest.QuestID == QuestID)
-        {
-            return &Quest;
-        }
+        IndexObjective(Quest.QuestSymbol, ObjectiveIndex, Quest.Objectives[ObjectiveIndex]);
+    }
+
+    // Keeps sequences unique however the quest arrived (started, loaded or re-added)
+    NextStartSequence = FMath::Max(NextStartSequence, Quest.StartSequence + 1);
+
+    const FAIDMId QuestSymbol = Quest.QuestSymbol;
+    ActiveQuestIndex.Add(QuestSymbol, ActiveQuests.Add(MoveTemp(Quest)));
+    SaveRevision.MarkChanged();
+}
+
+FActiveQuest UQuestManagerComponent::RemoveActiveQuest(int32 Slot)
+{
+    FActiveQuest Quest = MoveTemp(ActiveQuests[Slot]);
+    SaveRevision.MarkChanged();
+
+    for (int32 ObjectiveIndex = 0; ObjectiveIndex < Quest.Objectives.Num(); ++ObjectiveIndex)
+    {
+        UnindexObjective(Quest.QuestSymbol, ObjectiveIndex, Quest.Objectives[ObjectiveIndex]);
+    }
+
+    // Swap-remove: only the quest moved into the freed slot needs its index entry updated.
+    // Journal order is restored from StartSequence in GetActiveQuests.
+    ActiveQuests.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    ActiveQuestIndex.Remove(Quest.QuestSymbol);
+    if (ActiveQuests.IsValidIndex(Slot))
+    {
+        ActiveQuestIndex[ActiveQuests[Slot].QuestSymbol] = Slot;
     }
 
-    return nullptr;
+    return Quest;
+}
+
+void UQuestManagerComponent::HandleSymbolsReset()
+{
+    // Re-add every active quest so its slot and objective index entries use the new symbols
+    TArray<FActiveQuest> Quests = MoveTemp(ActiveQuests);
+    ActiveQuests.Reset(Quests.Num());
+    ActiveQuestIndex.Reset();
+    for (TMultiMap<FString, FQuestObjectiveRef>& Table : ObjectiveTargetIndex)
+    {
+        Table.Reset();
+    }
+    for (FActiveQuest& Quest : Quests)
+    {
+        Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
+        AddActiveQuest(MoveTemp(Quest));
+    }
+
+    CompletedQuestIndex.Reset();
+    for (FActiveQuest& Quest : CompletedQuests)
+    {
+        Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
+        CompletedQuestIndex.Add(Quest.QuestSymbol);
+    }
+
+    for (FActiveQuest& Quest : FailedQuests)
+    {
+        Quest.QuestSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Quest, Quest.QuestID);
+    }
+}
+
+void UQuestManagerComponent::IndexObjective(FAIDMId QuestSymbol, int32 ObjectiveIndex, const FQuestObjective& Objective)
+{
+    if (!Objective.TargetID.IsEmpty() && !Objective.bIsCompleted)
+    {
+        ObjectiveTargetIndex[static_cast<int32>(Objective.TriggerEvent)].Add(Objective.TargetID, FQuestObjectiveRef{QuestSymbol, ObjectiveIndex});
+    }
+}
+
+void UQuestManagerComponent::UnindexObjective(FAIDMId QuestSymbol, int32 ObjectiveIndex, const FQuestObjective& Objective)
+{
+    if (!Objective.TargetID.IsEmpty())
+    {
+        ObjectiveTargetIndex[static_cast<int32>(Objective.TriggerEvent)].RemoveSingle(Objective.TargetID, FQuestObjectiveRef{QuestSymbol, ObjectiveIndex});
+    }
 }
 
 void UQuestManagerComponent::CreateDefaultObjectives(FActiveQuest& Quest)
@@ -441,6 +838,7 @@ void UQuestManagerComponent::CreateDefaultObjectives(FActiveQuest& Quest)
         FQuestObjective Objective1;
         Objective1.Description = TEXT("Meet the person to escort");
         Objective1.RequiredProgress = 1;
+        Objective1.TargetID = Quest.QuestGiverName;
         Quest.Objectives.Add(Objective1);
 
         FQuestObjective Objective2;
@@ -465,6 +863,7 @@ void UQuestManagerComponent::CreateDefaultObjectives(FActiveQuest& Quest)
         FQuestObjective Objective;
         Objective.Description = TEXT("Successfully negotiate");
         Objective.RequiredProgress = 1;
+        Objective.TargetID = Quest.QuestGiverName;
         Quest.Objectives.Add(Objective);
     }
     else
@@ -477,17 +876,18 @@ void UQuestManagerComponent::CreateDefaultObjectives(FActiveQuest& Quest)
     }
 }
 
-bool UQuestManagerComponent::AreAllObjectivesCompleted(const FActiveQuest& Quest) const
+int32 UQuestManagerComponent::CountRemainingObjectives(const FActiveQuest& Quest) const
 {
+    int32 Remaining = 0;
     for (const FQuestObjective& Objective : Quest.Objectives)
     {
         if (!Objective.bIsOptional && !Objective.bIsCompleted)
         {
-            return false;
+            Remaining++;
         }
     }
 
-    return true;
+    return Remaining;
 }
 
 void UQuestManagerComponent::LogQuestEvent(const FString& Event, const FActiveQuest& Quest) const
@@ -0,0 +1,513 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AIDM/SaveGameContainer.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    /** Chunks smaller than this are not worth a zlib header */
+    constexpr int32 MinCompressSize = 256;
+
+    uint32 ZigZagEncode(int32 Value)
+    {
+        return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+    }
+
+    int32 ZigZagDecode(uint32 Value)
+    {
+        return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+    }
+
+    uint64 ZigZagEncode64(int64 Value)
+    {
+        return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+    }
+
+    int64 ZigZagDecode64(uint64 Value)
+    {
+        return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+    }
+
+    /** Keeps the tick count and the deltas between ticks well inside int64 */
+    constexpr double MaxTimestampSeconds = 1.0e12;
+
+    int64 TimestampToTicks(float Value)
+    {
+        // Not-a-number has no meaningful time; infinities clamp like any other out-of-range value
+        const double Seconds = FMath::IsNaN(Value) ? 0.0 : FMath::Clamp(static_cast<double>(Value), -MaxTimestampSeconds, MaxTimestampSeconds);
+        return static_cast<int64>(FMath::RoundToDouble(Seconds * SaveContainer::TimestampTicksPerSecond));
+    }
+}
+
+void FSaveChunkWriter::AppendVarU32(TArray<uint8>& Out, uint32 Value)
+{
+    while (Value >= 0x80)
+    {
+        Out.Add(static_cast<uint8>(Value | 0x80));
+        Value >>= 7;
+    }
+    Out.Add(static_cast<uint8>(Value));
+}
+
+void FSaveChunkWriter::AppendVarU64(TArray<uint8>& Out, uint64 Value)
+{
+    while (Value >= 0x80)
+    {
+        Out.Add(static_cast<uint8>(Value | 0x80));
+        Value >>= 7;
+    }
+    Out.Add(static_cast<uint8>(Value));
+}
+
+void FSaveChunkWriter::WriteVarU32(uint32 Value)
+{
+    AppendVarU32(Body, Value);
+}
+
+void FSaveChunkWriter::WriteVarI32(int32 Value)
+{
+    AppendVarU32(Body, ZigZagEncode(Value));
+}
+
+void FSaveChunkWriter::WriteTimestamp(float Value)
+{
+    // Chronological timestamps a few seconds apart cost two or three bytes each
+    const int64 Ticks = TimestampToTicks(Value);
+    AppendVarU64(Body, ZigZagEncode64(Ticks - LastTimestampTicks));
+    LastTimestampTicks = Ticks;
+}
+
+void FSaveChunkWriter::WriteString(const FString& Value)
+{
+    if (const uint32* Existing = StringIndices.Find(Value))
+    {
+        WriteVarU32(*Existing);
+        return;
+    }
+
+    const uint32 Index = Strings.Num();
+    StringIndices.Add(Value, Index);
+    Strings.Add(Value);
+    WriteVarU32(Index);
+}
+
+void FSaveChunkWriter::WriteStringArray(const TArray<FString>& Values)
+{
+    WriteVarU32(Values.Num());
+    for (const FString& Value : Values)
+    {
+        WriteString(Value);
+    }
+}
+
+void FSaveChunkWriter::WriteStringMap(const TMap<FString, FString>& Values)
+{
+    WriteVarU32(Values.Num());
+    for (const TPair<FString, FString>& Entry : Values)
+    {
+        WriteString(Entry.Key);
+        WriteString(Entry.Value);
+    }
+}
+
+void FSaveChunkWriter::Finalize(TArray<uint8>& OutPayload)
+{
+    OutPayload.Reset();
+    AppendVarU32(OutPayload, Strings.Num());
+    for (const FString& Value : Strings)
+    {
+        FTCHARToUTF8 Utf8(*Value);
+        AppendVarU32(OutPayload, Utf8.Length());
+        OutPayload.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+    OutPayload.Append(Body);
+
+    Body.Reset();
+    Strings.Reset();
+    StringIndices.Reset();
+    LastTimestampTicks = 0;
+}
+
+FSaveChunkReader::FSaveChunkReader(TConstArrayView<uint8> InPayload)
+    : Payload(InPayload)
+{
+    const int32 StringCount = ReadCount();
+    Strings.Reserve(StringCount);
+    for (int32 Index = 0; Index < StringCount && !bError; ++Index)
+    {
+        const uint32 Length = ReadVarU32();
+        if (bError || Length > static_cast<uint32>(Payload.Num() - Cursor))
+        {
+            bError = true;
+            break;
+        }
+
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Payload.GetData() + Cursor), Length);
+        Strings.Emplace(Converted.Length(), Converted.Get());
+        Cursor += Length;
+    }
+}
+
+uint8 FSaveChunkReader::ReadU8()
+{
+    if (bError || Cursor >= Payload.Num())
+    {
+        bError = true;
+        return 0;
+    }
+    return Payload[Cursor++];
+}
+
+float FSaveChunkReader::ReadF32()
+{
+    float Value = 0.0f;
+    if (bError || Payload.Num() - Cursor < static_cast<int32>(sizeof(Value)))
+    {
+        bError = true;
+        return Value;
+    }
+
+    FMemory::Memcpy(&Value, Payload.GetData() + Cursor, sizeof(Value));
+    Cursor += sizeof(Value);
+    return Value;
+}
+
+uint32 FSaveChunkReader::ReadVarU32()
+{
+    uint32 Value = 0;
+    for (int32 Shift = 0; Shift < 35; Shift += 7)
+    {
+        const uint8 Byte = ReadU8();
+        Value |= static_cast<uint32>(Byte & 0x7F) << Shift;
+        if ((Byte & 0x80) == 0)
+        {
+            return Value;
+        }
+    }
+
+    // More than five bytes cannot be a uint32
+    bError = true;
+    return 0;
+}
+
+uint64 FSaveChunkReader::ReadVarU64()
+{
+    uint64 Value = 0;
+    for (int32 Shift = 0; Shift < 70; Shift += 7)
+    {
+        const uint8 Byte = ReadU8();
+        Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+        if ((Byte & 0x80) == 0)
+        {
+            return Value;
+        }
+    }
+
+    // More than ten bytes cannot be a uint64
+    bError = true;
+    return 0;
+}
+
+int32 FSaveChunkReader::ReadVarI32()
+{
+    return ZigZagDecode(ReadVarU32());
+}
+
+float FSaveChunkReader::ReadTimestamp()
+{
+    // Wrapping add, so a corrupt delta cannot overflow
+    LastTimestampTicks = static_cast<int64>(static_cast<uint64>(LastTimestampTicks) + static_cast<uint64>(ZigZagDecode64(ReadVarU64())));
+    return static_cast<float>(static_cast<double>(LastTimestampTicks) / SaveContainer::TimestampTicksPerSecond);
+}
+
+FString FSaveChunkReader::ReadString()
+{
+    const uint32 Index = ReadVarU32();
+    if (bError || Index >= static_cast<uint32>(Strings.Num()))
+    {
+        bError = true;
+        return FString();
+    }
+    return Strings[Index];
+}
+
+void FSaveChunkReader::ReadStringArray(TArray<FString>& OutValues)
+{
+    const int32 Count = ReadCount();
+    OutValues.Reset(Count);
+    for (int32 Index = 0; Index < Count && !bError; ++Index)
+    {
+        OutValues.Add(ReadString());
+    }
+}
+
+void FSaveChunkReader::ReadStringMap(TMap<FString, FString>& OutValues)
+{
+    const int32 Count = ReadCount();
+    OutValues.Reset();
+    OutValues.Reserve(Count);
+    for (int32 Index = 0; Index < Count && !bError; ++Index)
+    {
+        FString Key = ReadString();
+        OutValues.Add(MoveTemp(Key), ReadString());
+    }
+}
+
+int32 FSaveChunkReader::ReadCount()
+{
+    const uint32 Count = ReadVarU32();
+    if (bError || Count > static_cast<uint32>(Payload.Num() - Cursor))
+    {
+        bError = true;
+        return 0;
+    }
+    return static_cast<int32>(Count);
+}
+
+void FSaveGameContainer::Reset()
+{
+    // Any FSaveChunkRevision synced with the old chunks must write again
+    static uint32 NextGeneration = 1;
+    Generation = NextGeneration++;
+
+    Chunks.Reset();
+    bChunksRemoved = false;
+}
+
+FSaveGameContainer::FChunk* FSaveGameContainer::FindChunk(uint32 ChunkId)
+{
+    return Chunks.FindByPredicate([ChunkId](const FChunk& Chunk) { return Chunk.Id == ChunkId; });
+}
+
+const FSaveGameContainer::FChunk* FSaveGameContainer::FindChunk(uint32 ChunkId) const
+{
+    return Chunks.FindByPredicate([ChunkId](const FChunk& Chunk) { return Chunk.Id == ChunkId; });
+}
+
+bool FSaveGameContainer::SetChunk(uint32 ChunkId, uint32 ChunkVersion, TArray<uint8>&& Payload)
+{
+    const uint32 Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+    FChunk* Chunk = FindChunk(ChunkId);
+    if (Chunk && Chunk->Version == ChunkVersion && Chunk->RawSize == static_cast<uint32>(Payload.Num()) && Chunk->Crc == Crc)
+    {
+        return false;
+    }
+
+    if (!Chunk)
+    {
+        Chunk = &Chunks.AddDefaulted_GetRef();
+        Chunk->Id = ChunkId;
+    }
+
+    Chunk->Version = ChunkVersion;
+    Chunk->RawSize = Payload.Num();
+    Chunk->Crc = Crc;
+    Chunk->bCompressed = false;
+    Chunk->bDirty = true;
+    Chunk->Data = MoveTemp(Payload);
+    return true;
+}
+
+void FSaveGameContainer::RemoveChunk(uint32 ChunkId)
+{
+    if (Chunks.RemoveAll([ChunkId](const FChunk& Chunk) { return Chunk.Id == ChunkId; }) > 0)
+    {
+        bChunksRemoved = true;
+    }
+}
+
+bool FSaveGameContainer::IsChunkDirty(uint32 ChunkId) const
+{
+    const FChunk* Chunk = FindChunk(ChunkId);
+    return Chunk && Chunk->bDirty;
+}
+
+bool FSaveGameContainer::IsDirty() const
+{
+    return bChunksRemoved || Chunks.ContainsByPredicate([](const FChunk& Chunk) { return Chunk.bDirty; });
+}
+
+bool FSaveGameContainer::GetChunk(uint32 ChunkId, uint32 MaxChunkVersion, TArray<uint8>& OutPayload, uint32* OutChunkVersion) const
+{
+    OutPayload.Reset();
+
+    const FChunk* Chunk = FindChunk(ChunkId);
+    if (!Chunk)
+    {
+        return false;
+    }
+
+    if (Chunk->Version > MaxChunkVersion)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SaveGameContainer: Chunk %08x has version %u, newer than supported %u"), ChunkId, Chunk->Version, MaxChunkVersion);
+        return false;
+    }
+
+    if (Chunk->bCompressed)
+    {
+        OutPayload.SetNumUninitialized(Chunk->RawSize);
+        if (!FCompression::UncompressMemory(NAME_Zlib, OutPayload.GetData(), Chunk->RawSize, Chunk->Data.GetData(), Chunk->Data.Num()))
+        {
+            UE_LOG(LogTemp, Error, TEXT("SaveGameContainer: Failed to decompress chunk %08x"), ChunkId);
+            OutPayload.Reset();
+            return false;
+        }
+    }
+    else
+    {
+        OutPayload = Chunk->Data;
+    }
+
+    // Dirty chunks were checksummed from this very buffer; only stored data can be damaged
+    if (!Chunk->bDirty && (OutPayload.Num() != static_cast<int32>(Chunk->RawSize) || FCrc::MemCrc32(OutPayload.GetData(), OutPayload.Num()) != Chunk->Crc))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SaveGameContainer: Chunk %08x failed its checksum"), ChunkId);
+        OutPayload.Reset();
+        return false;
+    }
+
+    if (OutChunkVersion)
+    {
+        *OutChunkVersion = Chunk->Version;
+    }
+    return true;
+}
+
+void FSaveGameContainer::EncodeChunk(FChunk& Chunk) const
+{
+    Chunk.bDirty = false;
+    Chunk.bCompressed = false;
+
+    if (!bCompressionEnabled || Chunk.Data.Num() < MinCompressSize)
+    {
+        return;
+    }
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Chunk.Data.Num());
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(CompressedSize);
+    if (FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Chunk.Data.GetData(), Chunk.Data.Num()) &&
+        CompressedSize < Chunk.Data.Num())
+    {
+        Compressed.SetNum(CompressedSize);
+        Chunk.Data = MoveTemp(Compressed);
+        Chunk.bCompressed = true;
+    }
+}
+
+void FSaveGameContainer::Write(TArray<uint8>& OutBytes)
+{
+    for (FChunk& Chunk : Chunks)
+    {
+        if (Chunk.bDirty)
+        {
+            EncodeChunk(Chunk);
+        }
+    }
+
+    FSaveContainerHeader Header;
+    Header.Magic = SaveContainer::Magic;
+    Header.Version = SaveContainer::Version;
+    Header.ChunkCount = Chunks.Num();
+
+    uint32 Offset = sizeof(FSaveContainerHeader) + Chunks.Num() * sizeof(FSaveChunkEntry);
+    TArray<FSaveChunkEntry, TInlineAllocator<8>> Entries;
+    for (const FChunk& Chunk : Chunks)
+    {
+        FSaveChunkEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Id = Chunk.Id;
+        Entry.ChunkVersion = Chunk.Version;
+        Entry.Flags = Chunk.bCompressed ? FSaveChunkEntry::Compressed : 0;
+        Entry.Offset = Offset;
+        Entry.StoredSize = Chunk.Data.Num();
+        Entry.RawSize = Chunk.RawSize;
+        Entry.Crc = Chunk.Crc;
+        Offset += Entry.StoredSize;
+    }
+
+    OutBytes.Reset(Offset);
+    OutBytes.Append(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+    OutBytes.Append(reinterpret_cast<const uint8*>(Entries.GetData()), Entries.Num() * sizeof(FSaveChunkEntry));
+    for (const FChunk& Chunk : Chunks)
+    {
+        OutBytes.Append(Chunk.Data);
+    }
+
+    bChunksRemoved = false;
+}
+
+bool FSaveGameContainer::Read(TConstArrayView<uint8> Bytes)
+{
+    Reset();
+
+    FSaveContainerHeader Header;
+    if (Bytes.Num() < static_cast<int32>(sizeof(Header)))
+    {
+        return false;
+    }
+    FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(Header));
+
+    if (Header.Magic != SaveContainer::Magic || Header.Version != SaveContainer::Version)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SaveGameContainer: Unsupported save (magic %08x, version %u)"), Header.Magic, Header.Version);
+        return false;
+    }
+
+    const uint64 TableEnd = sizeof(Header) + static_cast<uint64>(Header.ChunkCount) * sizeof(FSaveChunkEntry);
+    if (TableEnd > static_cast<uint64>(Bytes.Num()))
+    {
+        return false;
+    }
+
+    Chunks.Reserve(Header.ChunkCount);
+    for (uint32 Index = 0; Index < Header.ChunkCount; ++Index)
+    {
+        FSaveChunkEntry Entry;
+        FMemory::Memcpy(&Entry, Bytes.GetData() + sizeof(Header) + Index * sizeof(FSaveChunkEntry), sizeof(Entry));
+
+        if (static_cast<uint64>(Entry.Offset) + Entry.StoredSize > static_cast<uint64>(Bytes.Num()) ||
+            Entry.RawSize > static_cast<uint32>(MAX_int32) ||
+            (!(Entry.Flags & FSaveChunkEntry::Compressed) && Entry.StoredSize != Entry.RawSize))
+        {
+            UE_LOG(LogTemp, Error, TEXT("SaveGameContainer: Chunk table entry %u is out of range"), Index);
+            Reset();
+            return false;
+        }
+
+        // Chunks are decoded on demand in GetChunk; only the stored bytes are kept here
+        FChunk& Chunk = Chunks.AddDefaulted_GetRef();
+        Chunk.Id = Entry.Id;
+        Chunk.Version = Entry.ChunkVersion;
+        Chunk.RawSize = Entry.RawSize;
+        Chunk.Crc = Entry.Crc;
+        Chunk.bCompressed = (Entry.Flags & FSaveChunkEntry::Compressed) != 0;
+        Chunk.Data.Append(Bytes.GetData() + Entry.Offset, Entry.StoredSize);
+    }
+
+    return true;
+}
+
+bool FSaveGameContainer::SaveToFile(const FString& FilePath)
+{
+    TArray<uint8> Bytes;
+    Write(Bytes);
+
+    if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("SaveGameContainer: Failed to write %s"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+bool FSaveGameContainer::LoadFromFile(const FString& FilePath)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        return false;
+    }
+    return Read(Bytes);
+}
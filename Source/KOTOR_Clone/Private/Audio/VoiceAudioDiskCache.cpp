@@ -0,0 +1,321 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Audio/VoiceAudioDiskCache.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+    // Hard cap on index entries; the byte budget is normally hit long before this
+    constexpr int32 MaxIndexEntries = 65536;
+
+    constexpr int64 DefaultMaxBytes = 256ll * 1024 * 1024;
+}
+
+FVoiceAudioDiskCache& FVoiceAudioDiskCache::Get()
+{
+    static FVoiceAudioDiskCache Instance;
+    return Instance;
+}
+
+FVoiceAudioDiskCache::FVoiceAudioDiskCache()
+    : Entries(MaxIndexEntries)
+    , TotalBytes(0)
+    , MaxBytes(DefaultMaxBytes)
+    , bIndexDirty(false)
+{
+    CacheDirectory = FPaths::ProjectSavedDir() / TEXT("VoiceCache");
+    IFileManager::Get().MakeDirectory(*CacheDirectory, true);
+
+    LoadIndex();
+    RemoveOrphanedBlobs();
+}
+
+void FVoiceAudioDiskCache::SetMaxBytes(int64 InMaxBytes)
+{
+    MaxBytes = FMath::Max<int64>(InMaxBytes, 0);
+    EvictToFit(0);
+}
+
+bool FVoiceAudioDiskCache::Contains(const FString& Key) const
+{
+    return Entries.Contains(Key) && !PendingWrites.Contains(Key);
+}
+
+bool FVoiceAudioDiskCache::FindAndTouch(const FString& Key, FVoiceAudioCacheEntry& OutEntry)
+{
+    check(IsInGameThread());
+
+    if (PendingWrites.Contains(Key))
+    {
+        return false;
+    }
+
+    const FVoiceAudioCacheEntry* Entry = Entries.FindAndTouch(Key);
+    if (!Entry)
+    {
+        return false;
+    }
+
+    OutEntry = *Entry;
+    bIndexDirty = true;
+    return true;
+}
+
+void FVoiceAudioDiskCache::Store(const FString& Key, TArray<uint8> Data, int32 SampleRate, int32 NumChannels)
+{
+    check(IsInGameThread());
+
+    const int64 SizeBytes = Data.Num();
+    if (Key.IsEmpty() || SizeBytes == 0 || SizeBytes > MaxBytes || Entries.Contains(Key))
+    {
+        return;
+    }
+
+    EvictToFit(SizeBytes);
+
+    // Account for the blob now so concurrent stores cannot overshoot the budget
+    FVoiceAudioCacheEntry Entry;
+    Entry.SizeBytes = SizeBytes;
+    Entry.SampleRate = SampleRate;
+    Entry.NumChannels = NumChannels;
+    Entries.Add(Key, Entry);
+    TotalBytes += SizeBytes;
+    PendingWrites.Add(Key);
+    bIndexDirty = true;
+
+    // Write to a temp file and rename, so a crash never leaves a truncated blob under the real name
+    const FString BlobPath = GetBlobPath(Key);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Key, BlobPath, Data = MoveTemp(Data)]()
+    {
+        const FString TempPath = BlobPath + TEXT(".tmp");
+        const bool bSucceeded = FFileHelper::SaveArrayToFile(Data, *TempPath) &&
+                                IFileManager::Get().Move(*BlobPath, *TempPath, true, true);
+
+        AsyncTask(ENamedThreads::GameThread, [this, Key, bSucceeded]()
+        {
+            OnBlobWritten(Key, bSucceeded);
+        });
+    });
+}
+
+void FVoiceAudioDiskCache::Invalidate(const FString& Key)
+{
+    check(IsInGameThread());
+
+    if (Entries.Contains(Key) && !PendingWrites.Contains(Key))
+    {
+        RemoveEntry(Key);
+    }
+}
+
+void FVoiceAudioDiskCache::Clear()
+{
+    check(IsInGameThread());
+
+    // Pending writes stay accounted for; their blobs are kept when the write lands
+    TArray<FString> Keys;
+    Keys.Reserve(Entries.Num());
+    for (TLruCache<FString, FVoiceAudioCacheEntry>::TConstIterator It(Entries); It; ++It)
+    {
+        if (!PendingWrites.Contains(It.Key()))
+        {
+            Keys.Add(It.Key());
+        }
+    }
+
+    for (const FString& Key : Keys)
+    {
+        RemoveEntry(Key);
+    }
+
+    Flush();
+
+    UE_LOG(LogTemp, Log, TEXT("VoiceAudioDiskCache: Cleared %d blobs"), Keys.Num());
+}
+
+void FVoiceAudioDiskCache::Flush()
+{
+    check(IsInGameThread());
+
+    if (!bIndexDirty)
+    {
+        return;
+    }
+
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 FileMagic = VoiceAudioDiskCache::Magic;
+    uint32 FileVersion = VoiceAudioDiskCache::Version;
+    int32 EntryCount = 0;
+    Writer << FileMagic << FileVersion << EntryCount;
+
+    // Most recent first; blobs still in flight are left out until they exist on disk
+    for (TLruCache<FString, FVoiceAudioCacheEntry>::TConstIterator It(Entries); It; ++It)
+    {
+        if (PendingWrites.Contains(It.Key()))
+        {
+            continue;
+        }
+
+        FString Key = It.Key();
+        FVoiceAudioCacheEntry Entry = It.Value();
+        Writer << Key << Entry.SizeBytes << Entry.SampleRate << Entry.NumChannels;
+        ++EntryCount;
+    }
+
+    Writer.Seek(sizeof(uint32) * 2);
+    Writer << EntryCount;
+
+    if (FFileHelper::SaveArrayToFile(Bytes, *(CacheDirectory / VoiceAudioDiskCache::IndexFileName)))
+    {
+        bIndexDirty = false;
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceAudioDiskCache: Failed to write index to %s"), *CacheDirectory);
+    }
+}
+
+FString FVoiceAudioDiskCache::GetBlobPath(const FString& Key) const
+{
+    return CacheDirectory / (Key + VoiceAudioDiskCache::BlobExtension);
+}
+
+void FVoiceAudioDiskCache::LoadIndex()
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *(CacheDirectory / VoiceAudioDiskCache::IndexFileName), FILEREAD_Silent))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Bytes);
+
+    uint32 FileMagic = 0;
+    uint32 FileVersion = 0;
+    int32 EntryCount = 0;
+    Reader << FileMagic << FileVersion << EntryCount;
+
+    if (Reader.IsError() || FileMagic != VoiceAudioDiskCache::Magic || FileVersion != VoiceAudioDiskCache::Version)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceAudioDiskCache: Discarding stale index"));
+        return;
+    }
+
+    struct FIndexRecord
+    {
+        FString Key;
+        FVoiceAudioCacheEntry Entry;
+    };
+
+    TArray<FIndexRecord> Records;
+    Records.Reserve(FMath::Clamp(EntryCount, 0, MaxIndexEntries));
+
+    for (int32 Index = 0; Index < EntryCount && !Reader.IsError(); ++Index)
+    {
+        FIndexRecord& Record = Records.AddDefaulted_GetRef();
+        Reader << Record.Key << Record.Entry.SizeBytes << Record.Entry.SampleRate << Record.Entry.NumChannels;
+    }
+
+    if (Reader.IsError())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceAudioDiskCache: Index is truncated, starting empty"));
+        return;
+    }
+
+    // The file is most recent first; insert oldest first so the LRU order round-trips
+    for (int32 Index = Records.Num() - 1; Index >= 0; --Index)
+    {
+        const FIndexRecord& Record = Records[Index];
+        if (Record.Key.IsEmpty() || Record.Entry.SizeBytes <= 0 || Entries.Contains(Record.Key))
+        {
+            continue;
+        }
+
+        Entries.Add(Record.Key, Record.Entry);
+        TotalBytes += Record.Entry.SizeBytes;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("VoiceAudioDiskCache: Loaded %d entries (%lld bytes)"), Entries.Num(), TotalBytes);
+}
+
+void FVoiceAudioDiskCache::RemoveOrphanedBlobs()
+{
+    // Blobs written after the last flush (e.g. a crash) are not in the index; reclaim them
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *CacheDirectory, TEXT("*"));
+
+    for (const FString& File : Files)
+    {
+        if (File == VoiceAudioDiskCache::IndexFileName)
+        {
+            continue;
+        }
+
+        const FString Key = FPaths::GetBaseFilename(File);
+        if (!File.EndsWith(VoiceAudioDiskCache::BlobExtension) || !Entries.Contains(Key))
+        {
+            IFileManager::Get().Delete(*(CacheDirectory / File), false, false, true);
+        }
+    }
+}
+
+void FVoiceAudioDiskCache::EvictToFit(int64 IncomingBytes)
+{
+    int32 NumEvicted = 0;
+
+    while (Entries.Num() > 0 && (TotalBytes + IncomingBytes > MaxBytes || Entries.Num() >= Entries.Max()))
+    {
+        RemoveEntry(Entries.GetLeastRecentKey());
+        ++NumEvicted;
+    }
+
+    if (NumEvicted > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("VoiceAudioDiskCache: Evicted %d blobs (%lld / %lld bytes)"), NumEvicted, TotalBytes, MaxBytes);
+    }
+}
+
+void FVoiceAudioDiskCache::RemoveEntry(const FString& Key)
+{
+    const FVoiceAudioCacheEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        return;
+    }
+
+    TotalBytes -= Entry->SizeBytes;
+    Entries.Remove(Key);
+    bIndexDirty = true;
+
+    // A blob still being written is deleted by OnBlobWritten once the write lands
+    if (!PendingWrites.Contains(Key))
+    {
+        IFileManager::Get().Delete(*GetBlobPath(Key), false, false, true);
+    }
+}
+
+void FVoiceAudioDiskCache::OnBlobWritten(const FString& Key, bool bSucceeded)
+{
+    PendingWrites.Remove(Key);
+
+    if (!Entries.Contains(Key))
+    {
+        // Evicted while in flight
+        IFileManager::Get().Delete(*GetBlobPath(Key), false, false, true);
+        return;
+    }
+
+    if (!bSucceeded)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceAudioDiskCache: Failed to write blob %s"), *Key);
+        RemoveEntry(Key);
+    }
+}
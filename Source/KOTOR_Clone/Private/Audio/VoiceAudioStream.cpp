@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Audio/VoiceAudioStream.h"
+#include "Misc/ScopeLock.h"
+
+void FVoiceAudioStream::Append(const uint8* Data, int64 NumBytes)
+{
+    if (!Data || NumBytes <= 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    Received.Append(Data, NumBytes);
+}
+
+void FVoiceAudioStream::Finish()
+{
+    FScopeLock ScopeLock(&Lock);
+    bFinished = true;
+}
+
+int32 FVoiceAudioStream::Read(TArray<uint8>& OutData, int32 MaxBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    // Never split a sample; a trailing odd byte waits for its partner (or is dropped at the end)
+    const int64 Available = (Received.Num() - ReadOffset) & ~static_cast<int64>(1);
+    const int32 NumBytes = static_cast<int32>(FMath::Min<int64>(Available, MaxBytes & ~1));
+
+    OutData.SetNumUninitialized(FMath::Max(NumBytes, 0), EAllowShrinking::No);
+    if (NumBytes > 0)
+    {
+        FMemory::Memcpy(OutData.GetData(), Received.GetData() + ReadOffset, NumBytes);
+        ReadOffset += NumBytes;
+    }
+
+    return FMath::Max(NumBytes, 0);
+}
+
+bool FVoiceAudioStream::IsDrained() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return bFinished && Received.Num() - ReadOffset < 2;
+}
+
+void FVoiceAudioStream::CopyReceived(TArray<uint8>& OutData) const
+{
+    FScopeLock ScopeLock(&Lock);
+    OutData = Received;
+}
+
+int64 FVoiceAudioStream::GetNumReceived() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return Received.Num();
+}
@@ -0,0 +1,235 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Audio/VoicePCMKernels.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+void VoicePCM::GenerateSine(float* Out, int32 NumSamples, float Frequency, float SampleRate, float Amplitude, float& InOutPhase)
+{
+    const float Increment = 2.0f * PI * Frequency / SampleRate;
+    const VectorRegister4Float LaneOffsets = MakeVectorRegisterFloat(0.0f, Increment, 2.0f * Increment, 3.0f * Increment);
+    const VectorRegister4Float AmplitudeVector = VectorSetFloat1(Amplitude);
+
+    float Phase = FMath::UnwindRadians(InOutPhase);
+    int32 Index = 0;
+
+    // Four lanes per step; the phase is re-wrapped every step so VectorSin stays in its accurate range
+    for (; Index + 4 <= NumSamples; Index += 4)
+    {
+        const VectorRegister4Float Phases = VectorAdd(VectorSetFloat1(Phase), LaneOffsets);
+        VectorStore(VectorMultiply(VectorSin(Phases), AmplitudeVector), Out + Index);
+        Phase = FMath::UnwindRadians(Phase + 4.0f * Increment);
+    }
+
+    for (; Index < NumSamples; ++Index)
+    {
+        Out[Index] = Amplitude * FMath::Sin(Phase);
+        Phase = FMath::UnwindRadians(Phase + Increment);
+    }
+
+    InOutPhase = Phase;
+}
+
+void VoicePCM::ApplyGainRamp(float* Buffer, int32 NumSamples, float StartGain, float EndGain)
+{
+    if (NumSamples <= 0)
+    {
+        return;
+    }
+
+    const float Step = (EndGain - StartGain) / NumSamples;
+    VectorRegister4Float Gains = MakeVectorRegisterFloat(StartGain, StartGain + Step, StartGain + 2.0f * Step, StartGain + 3.0f * Step);
+    const VectorRegister4Float GainStep = VectorSetFloat1(4.0f * Step);
+
+    int32 Index = 0;
+    for (; Index + 4 <= NumSamples; Index += 4)
+    {
+        VectorStore(VectorMultiply(VectorLoad(Buffer + Index), Gains), Buffer + Index);
+        Gains = VectorAdd(Gains, GainStep);
+    }
+
+    for (; Index < NumSamples; ++Index)
+    {
+        Buffer[Index] *= StartGain + Step * Index;
+    }
+}
+
+void VoicePCM::MixInto(float* Dest, const float* Source, int32 NumSamples, float Gain)
+{
+    const VectorRegister4Float GainVector = VectorSetFloat1(Gain);
+
+    int32 Index = 0;
+    for (; Index + 4 <= NumSamples; Index += 4)
+    {
+        VectorStore(VectorMultiplyAdd(VectorLoad(Source + Index), GainVector, VectorLoad(Dest + Index)), Dest + Index);
+    }
+
+    for (; Index < NumSamples; ++Index)
+    {
+        Dest[Index] += Source[Index] * Gain;
+    }
+}
+
+void VoicePCM::ResampleLinear(const float* In, int32 NumIn, float* Out, int32 NumOut)
+{
+    if (NumOut <= 0)
+    {
+        return;
+    }
+
+    if (NumIn <= 1)
+    {
+        const float Value = NumIn == 1 ? In[0] : 0.0f;
+        for (int32 Index = 0; Index < NumOut; ++Index)
+        {
+            Out[Index] = Value;
+        }
+        return;
+    }
+
+    // Endpoints map onto endpoints; each output only reads its two neighbours, so iterations are independent
+    const double Ratio = NumOut > 1 ? static_cast<double>(NumIn - 1) / (NumOut - 1) : 0.0;
+    for (int32 Index = 0; Index < NumOut; ++Index)
+    {
+        const double Position = Index * Ratio;
+        const int32 Left = FMath::Min(static_cast<int32>(Position), NumIn - 2);
+        const float Alpha = static_cast<float>(Position - Left);
+        Out[Index] = In[Left] + (In[Left + 1] - In[Left]) * Alpha;
+    }
+}
+
+void VoicePCM::FloatToInt16(const float* In, int16* Out, int32 NumSamples)
+{
+    // Branch-free clamp + truncate; compiles to packed min/max/convert
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        const float Scaled = FMath::Clamp(In[Index] * 32767.0f, -32768.0f, 32767.0f);
+        Out[Index] = static_cast<int16>(Scaled);
+    }
+}
+
+void VoicePCM::Int16ToFloat(const int16* In, float* Out, int32 NumSamples)
+{
+    constexpr float Scale = 1.0f / 32768.0f;
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        Out[Index] = In[Index] * Scale;
+    }
+}
+
+void VoicePCM::RenderTone(int16* Out, int32 NumSamples, float Frequency, float SampleRate, float Amplitude, int32 FadeSamples)
+{
+    const int32 Fade = FMath::Clamp(FadeSamples, 0, NumSamples / 2);
+    const float InvFade = Fade > 0 ? 1.0f / Fade : 0.0f;
+    const int32 ReleaseStart = NumSamples - Fade;
+
+    float Scratch[BlockSize];
+    float Phase = 0.0f;
+
+    for (int32 Offset = 0; Offset < NumSamples; Offset += BlockSize)
+    {
+        const int32 Count = FMath::Min(BlockSize, NumSamples - Offset);
+        const int32 BlockEnd = Offset + Count;
+
+        GenerateSine(Scratch, Count, Frequency, SampleRate, Amplitude, Phase);
+
+        if (Fade > 0)
+        {
+            // Fade in: gain = k / Fade
+            if (Offset < Fade)
+            {
+                const int32 End = FMath::Min(BlockEnd, Fade);
+                ApplyGainRamp(Scratch, End - Offset, Offset * InvFade, End * InvFade);
+            }
+
+            // Fade out: gain = (NumSamples - k) / Fade
+            if (BlockEnd > ReleaseStart)
+            {
+                const int32 Start = FMath::Max(Offset, ReleaseStart);
+                ApplyGainRamp(Scratch + (Start - Offset), BlockEnd - Start, (NumSamples - Start) * InvFade, (NumSamples - BlockEnd) * InvFade);
+            }
+        }
+
+        FloatToInt16(Scratch, Out + Offset, Count);
+    }
+}
+
+namespace
+{
+    // The per-sample path the kernels replaced: scalar sin into an int16 array, then a byte copy
+    void RenderToneScalarReference(TArray<uint8>& OutBytes, int32 NumSamples, float Frequency, float SampleRate, float Amplitude)
+    {
+        TArray<int16> SampleData;
+        SampleData.SetNum(NumSamples);
+
+        for (int32 i = 0; i < NumSamples; i++)
+        {
+            float Time = static_cast<float>(i) / SampleRate;
+            SampleData[i] = static_cast<int16>(Amplitude * 32767.0f * FMath::Sin(2.0f * PI * Frequency * Time));
+        }
+
+        OutBytes.Reset();
+        OutBytes.Append(reinterpret_cast<const uint8*>(SampleData.GetData()), SampleData.Num() * sizeof(int16));
+    }
+
+    void RunPCMBenchmark(const TArray<FString>& Args)
+    {
+        const float AudioSeconds = Args.Num() > 0 ? FMath::Max(FCString::Atof(*Args[0]), 0.1f) : 60.0f;
+        const float SampleRate = 44100.0f;
+        const int32 NumSamples = static_cast<int32>(AudioSeconds * SampleRate);
+        const int32 NumPasses = 8;
+
+        auto MeasureSamplesPerSecond = [NumSamples, NumPasses](TFunctionRef<void()> Body)
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+            {
+                Body();
+            }
+            const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+            return static_cast<double>(NumSamples) * NumPasses / Elapsed / 1.0e6;
+        };
+
+        // Mock TTS tone: old path vs kernels writing straight into the final buffer
+        TArray<uint8> ReferenceBytes;
+        const double ScalarRate = MeasureSamplesPerSecond([&]()
+        {
+            RenderToneScalarReference(ReferenceBytes, NumSamples, 440.0f, SampleRate, 0.3f);
+        });
+
+        TArray<uint8> KernelBytes;
+        KernelBytes.SetNumUninitialized(NumSamples * sizeof(int16));
+        const double KernelRate = MeasureSamplesPerSecond([&]()
+        {
+            VoicePCM::RenderTone(reinterpret_cast<int16*>(KernelBytes.GetData()), NumSamples, 440.0f, SampleRate, 0.3f, 0);
+        });
+
+        UE_LOG(LogTemp, Display, TEXT("Voice.BenchmarkPCM: %.1fs of audio x %d passes"), AudioSeconds, NumPasses);
+        UE_LOG(LogTemp, Display, TEXT("Voice.BenchmarkPCM: tone scalar %.1f Msamples/s, kernels %.1f Msamples/s (%.2fx)"),
+               ScalarRate, KernelRate, KernelRate / FMath::Max(ScalarRate, 1e-9));
+
+        // Remaining kernels on their own
+        TArray<float> FloatA;
+        TArray<float> FloatB;
+        TArray<float> Resampled;
+        FloatA.SetNumUninitialized(NumSamples);
+        FloatB.SetNumZeroed(NumSamples);
+        Resampled.SetNumUninitialized(static_cast<int32>(NumSamples * 48000.0 / SampleRate));
+
+        const int16* KernelSamples = reinterpret_cast<const int16*>(KernelBytes.GetData());
+        int16* OutSamples = reinterpret_cast<int16*>(KernelBytes.GetData());
+
+        const double ToFloatRate = MeasureSamplesPerSecond([&]() { VoicePCM::Int16ToFloat(KernelSamples, FloatA.GetData(), NumSamples); });
+        const double MixRate = MeasureSamplesPerSecond([&]() { VoicePCM::MixInto(FloatB.GetData(), FloatA.GetData(), NumSamples, 0.5f); });
+        const double ResampleRate = MeasureSamplesPerSecond([&]() { VoicePCM::ResampleLinear(FloatA.GetData(), NumSamples, Resampled.GetData(), Resampled.Num()); });
+        const double ToInt16Rate = MeasureSamplesPerSecond([&]() { VoicePCM::FloatToInt16(FloatA.GetData(), OutSamples, NumSamples); });
+
+        UE_LOG(LogTemp, Display, TEXT("Voice.BenchmarkPCM: Int16ToFloat %.1f, MixInto %.1f, ResampleLinear %.1f, FloatToInt16 %.1f Msamples/s"),
+               ToFloatRate, MixRate, ResampleRate, ToInt16Rate);
+    }
+
+    FAutoConsoleCommand BenchmarkPCMCommand(
+        TEXT("Voice.BenchmarkPCM"),
+        TEXT("Time the voice PCM kernels against the scalar mock TTS path. Usage: Voice.BenchmarkPCM [AudioSeconds=60]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunPCMBenchmark));
+}
@@ -1,16 +1,65 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Audio/VoiceSynthesisComponent.h"
+#include "Audio/VoiceAudioDiskCache.h"
+#include "Audio/VoiceAudioStream.h"
+#include "Audio/VoicePCMKernels.h"
 #include "Components/AudioComponent.h"
 #include "Sound/SoundWave.h"
+#include "Sound/SoundWaveProcedural.h"
 #include "Engine/Engine.h"
 #include "Http.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Misc/Base64.h"
-#include "HAL/PlatformFilemanager.h"
 #include "Misc/FileHelper.h"
+#include "TimerManager.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include <atomic>
+
+namespace
+{
+    /**
+     * Receive stream for a TTS HTTP response; forwards each body chunk into an FVoiceAudioStream
+     * as it arrives (HTTP thread) and reports the first chunk once
+     */
+    class FVoiceResponseArchive : public FArchive
+    {
+    public:
+        FVoiceResponseArchive(const TSharedRef<FVoiceAudioStream, ESPMode::ThreadSafe>& InStream, TFunction<void()> InOnFirstChunk)
+            : Stream(InStream)
+            , OnFirstChunk(MoveTemp(InOnFirstChunk))
+            , bReceivedAny(false)
+        {
+            SetIsSaving(true);
+        }
+
+        virtual void Serialize(void* Data, int64 Length) override
+        {
+            if (Length <= 0)
+            {
+                return;
+            }
+
+            Stream->Append(static_cast<const uint8*>(Data), Length);
+
+            if (!bReceivedAny)
+            {
+                bReceivedAny = true;
+                OnFirstChunk();
+            }
+        }
+
+        virtual FString GetArchiveName() const override { return TEXT("FVoiceResponseArchive"); }
+
+    private:
+        TSharedRef<FVoiceAudioStream, ESPMode::ThreadSafe> Stream;
+        TFunction<void()> OnFirstChunk;
+        bool bReceivedAny;
+    };
+}
 
 UVoiceSynthesisComponent::UVoiceSynthesisComponent()
 {
@@ -23,6 +72,15 @@ UVoiceSynthesisComponent::UVoiceSynthesisComponent()
     MasterVolume = 1.0f;
     bEnableAudioCaching = true;
     MaxCacheSize = 100;
+    bEnableDiskCache = true;
+    MaxDiskCacheMB = 256;
+    MaxConcurrentRequests = 4;
+    bEnablePrefetch = true;
+    MockLatency = 0.0f;
+    bStreamPlayback = true;
+    NumInFlightJobs = 0;
+    NextJobSequence = 0;
+    bIsPumpingSynthesisQueue = false;
     bIsPlaying = false;
     CurrentRequestID = TEXT("");
     
@@ -47,6 +105,11 @@ void UVoiceSynthesisComponent::BeginPlay()
         }
     }
     
+    if (bEnableAudioCaching && bEnableDiskCache)
+    {
+        FVoiceAudioDiskCache::Get().SetMaxBytes(static_cast<int64>(MaxDiskCacheMB) * 1024 * 1024);
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("VoiceSynthesisComponent: Initialized with provider %s"), 
            *UEnum::GetValueAsString(CurrentProvider));
 }
@@ -55,6 +118,19 @@ void UVoiceSynthesisComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     StopVoicePlayback();
     ClearAudioCache();
+    
+    // Late provider responses find no job and are dropped
+    SynthesisJobs.Empty();
+    PendingPlayback.Empty();
+    StreamingWaves.Empty();
+    NumInFlightJobs = 0;
+    
+    // The disk cache outlives the component; persist its recency for the next session
+    if (bEnableDiskCache)
+    {
+        FVoiceAudioDiskCache::Get().Flush();
+    }
+    
     Super::EndPlay(EndPlayReason);
 }
 
@@ -97,40 +173,29 @@ FString UVoiceSynthesisComponent::SynthesizeSpeech(const FTTSRequest& Request)
     StoredRequest.RequestID = RequestID;
     ActiveRequests.Add(RequestID, StoredRequest);
     
+    FString CacheKey = GenerateCacheKey(Request.Text, Request.VoiceProfile);
+    
     // Check cache first
     if (bEnableAudioCaching && Request.bCacheAudio)
     {
-        FString CacheKey = GenerateCacheKey(Request.Text, Request.VoiceProfile);
         if (USoundWave* CachedAudio = GetFromCache(CacheKey))
         {
             OnVoiceSynthesisComplete.Broadcast(RequestID, CachedAudio);
             return RequestID;
         }
+        
+        // On disk: completes (and plays, if requested) like a synthesis job once the blob is read
+        if (StartDiskCacheLoad(CacheKey, StoredRequest, RequestID))
+        {
+            return RequestID;
+        }
     }
     
     // Broadcast synthesis started event
     OnVoiceSynthesisStarted(RequestID, Request.Text);
     
-    // Route to appropriate provider
-    switch (CurrentProvider)
-    {
-        case ETTSProvider::ElevenLabs:
-            SynthesizeWithElevenLabs(StoredRequest);
-            break;
-        case ETTSProvider::AzureSpeech:
-            SynthesizeWithAzureSpeech(StoredRequest);
-            break;
-        case ETTSProvider::OpenTTS:
-            SynthesizeWithOpenTTS(StoredRequest);
-            break;
-        case ETTSProvider::LocalTTS:
-            SynthesizeWithLocalTTS(StoredRequest);
-            break;
-        case ETTSProvider::MockTTS:
-        default:
-            SynthesizeWithMockTTS(StoredRequest);
-            break;
-    }
+    // Hand off to the scheduler; identical lines already queued or in flight are shared
+    EnqueueSynthesis(CacheKey, StoredRequest, RequestID);
     
     return RequestID;
 }
@@ -145,9 +210,27 @@ void UVoiceSynthesisComponent::PlaySynthesizedAudio(const FString& RequestID, UA
     }
     
     const FTTSRequest& Request = ActiveRequests[RequestID];
+    FString CacheKey = GenerateCacheKey(Request.Text, Request.VoiceProfile);
+    
+    // Still being synthesized - jump the queue and play as soon as the audio arrives
+    if (FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey))
+    {
+        if (Job->WaitingRequestIDs.Contains(RequestID))
+        {
+            // Already streaming - start on what has arrived so far
+            if (USoundWaveProcedural* StreamingWave = GetOrCreateStreamingWave(CacheKey))
+            {
+                StartPlayback(RequestID, StreamingWave, AudioComponent);
+                return;
+            }
+            
+            Job->Priority = ETTSRequestPriority::Immediate;
+            PendingPlayback.Add(RequestID, AudioComponent);
+            return;
+        }
+    }
     
     // Get cached audio
-    FString CacheKey = GenerateCacheKey(Request.Text, Request.VoiceProfile);
     USoundWave* SoundWave = GetFromCache(CacheKey);
     
     if (!SoundWave)
@@ -156,20 +239,28 @@ void UVoiceSynthesisComponent::PlaySynthesizedAudio(const FString& RequestID, UA
         return;
     }
     
+    StartPlayback(RequestID, SoundWave, AudioComponent);
+}
+
+void UVoiceSynthesisComponent::StartPlayback(const FString& RequestID, USoundWave* SoundWave, UAudioComponent* AudioComponent)
+{
     // Use provided audio component or default
     UAudioComponent* TargetAudioComponent = AudioComponent ? AudioComponent : DefaultAudioComponent;
     
-    if (TargetAudioComponent)
+    if (TargetAudioComponent && SoundWave)
     {
         // Stop current playback
         StopVoicePlayback();
         
         // Set up new playback
         TargetAudioComponent->SetSound(SoundWave);
+        TargetAudioComponent->OnAudioFinishedNative.RemoveAll(this);
+        TargetAudioComponent->OnAudioFinishedNative.AddUObject(this, &UVoiceSynthesisComponent::OnAudioPlaybackFinished);
         TargetAudioComponent->Play();
         
         bIsPlaying = true;
         CurrentRequestID = RequestID;
+        PlaybackAudioComponent = TargetAudioComponent;
         
         OnVoicePlaybackStarted.Broadcast(RequestID);
         
@@ -179,17 +270,45 @@ void UVoiceSynthesisComponent::PlaySynthesizedAudio(const FString& RequestID, UA
 
 void UVoiceSynthesisComponent::StopVoicePlayback()
 {
-    if (DefaultAudioComponent && bIsPlaying)
+    if (!bIsPlaying)
     {
-        DefaultAudioComponent->Stop();
-        
-        if (!CurrentRequestID.IsEmpty())
-        {
-            OnVoicePlaybackFinished.Broadcast(CurrentRequestID);
-        }
-        
-        bIsPlaying = false;
-        CurrentRequestID = TEXT("");
+        return;
+    }
+    
+    const FString FinishedRequestID = CurrentRequestID;
+    UAudioComponent* AudioComponent = PlaybackAudioComponent.Get();
+    
+    // Clear state first; Stop() fires OnAudioFinishedNative, which must not report the line twice
+    bIsPlaying = false;
+    CurrentRequestID = TEXT("");
+    PlaybackAudioComponent.Reset();
+    
+    if (AudioComponent)
+    {
+        AudioComponent->Stop();
+    }
+    
+    if (!FinishedRequestID.IsEmpty())
+    {
+        OnVoicePlaybackFinished.Broadcast(FinishedRequestID);
+    }
+}
+
+void UVoiceSynthesisComponent::OnAudioPlaybackFinished(UAudioComponent* AudioComponent)
+{
+    if (!bIsPlaying || AudioComponent != PlaybackAudioComponent.Get())
+    {
+        return;
+    }
+    
+    const FString FinishedRequestID = CurrentRequestID;
+    bIsPlaying = false;
+    CurrentRequestID = TEXT("");
+    PlaybackAudioComponent.Reset();
+    
+    if (!FinishedRequestID.IsEmpty())
+    {
+        OnVoicePlaybackFinished.Broadcast(FinishedRequestID);
     }
 }
 
@@ -239,6 +358,27 @@ FVoiceProfile UVoiceSynthesisComponent::GetVoiceProfileForNPC(const FNPCData& NP
 
 FString UVoiceSynthesisComponent::SpeakNPCDialogue(const FNPCData& NPCData, const FString& DialogueText, 
                                                   UAudioComponent* AudioComponent)
+{
+    // Create TTS request
+    FTTSRequest Request;
+    Request.Text = ResolveNPCDialogueText(NPCData, DialogueText);
+    Request.VoiceProfile = GetVoiceProfileForNPC(NPCData);
+    Request.bCacheAudio = true;
+    Request.Priority = ETTSRequestPriority::Immediate;
+    
+    // Synthesize speech
+    FString RequestID = SynthesizeSpeech(Request);
+    
+    // Plays now on a cache hit, otherwise as soon as synthesis completes
+    if (ActiveRequests.Contains(RequestID))
+    {
+        PlaySynthesizedAudio(RequestID, AudioComponent);
+    }
+    
+    return RequestID;
+}
+
+FString UVoiceSynthesisComponent::ResolveNPCDialogueText(const FNPCData& NPCData, const FString& DialogueText)
 {
     // Process text for synthesis
     FString ProcessedText = ProcessTextForSynthesis(DialogueText, NPCData);
@@ -247,41 +387,382 @@ FString UVoiceSynthesisComponent::SpeakNPCDialogue(const FNPCData& NPCData, cons
         ProcessedText = DialogueText;
     }
     
-    // Get voice profile for NPC
-    FVoiceProfile VoiceProfile = GetVoiceProfileForNPC(NPCData);
+    return ProcessedText;
+}
+
+bool UVoiceSynthesisComponent::PrefetchSpeech(const FString& Text, const FVoiceProfile& VoiceProfile)
+{
+    if (!bEnablePrefetch || !bEnableAudioCaching || Text.IsEmpty())
+    {
+        return false;
+    }
+    
+    FString CacheKey = GenerateCacheKey(Text, VoiceProfile);
+    if (AudioCache.Contains(CacheKey) || SynthesisJobs.Contains(CacheKey))
+    {
+        return false;
+    }
     
-    // Create TTS request
     FTTSRequest Request;
-    Request.Text = ProcessedText;
+    Request.Text = Text;
     Request.VoiceProfile = VoiceProfile;
     Request.bCacheAudio = true;
+    Request.Priority = ETTSRequestPriority::Prefetch;
     
-    // Synthesize speech
-    FString RequestID = SynthesizeSpeech(Request);
+    // Lines already on disk only need to be warmed into memory
+    if (StartDiskCacheLoad(CacheKey, Request, FString()))
+    {
+        return true;
+    }
+    
+    SchedulerStats.Prefetched++;
+    EnqueueSynthesis(CacheKey, Request, FString());
+    return true;
+}
+
+void UVoiceSynthesisComponent::PrefetchNPCDialogue(const FNPCData& NPCData, const TArray<FString>& Lines)
+{
+    if (!bEnablePrefetch || Lines.Num() == 0)
+    {
+        return;
+    }
     
-    // If using mock TTS, play immediately
-    if (CurrentProvider == ETTSProvider::MockTTS)
+    FVoiceProfile VoiceProfile = GetVoiceProfileForNPC(NPCData);
+    for (const FString& Line : Lines)
     {
-        // Small delay to simulate processing
-        FTimerHandle TimerHandle;
-        GetWorld()->GetTimerManager().SetTimer(TimerHandle, [this, RequestID, AudioComponent]()
+        if (!Line.IsEmpty())
+        {
+            PrefetchSpeech(ResolveNPCDialogueText(NPCData, Line), VoiceProfile);
+        }
+    }
+}
+
+void UVoiceSynthesisComponent::CancelPrefetches()
+{
+    int32 NumCancelled = 0;
+    for (auto It = SynthesisJobs.CreateIterator(); It; ++It)
+    {
+        if (!It->Value.bInFlight && It->Value.WaitingRequestIDs.Num() == 0)
         {
-            PlaySynthesizedAudio(RequestID, AudioComponent);
-        }, 0.5f, false);
+            It.RemoveCurrent();
+            NumCancelled++;
+        }
     }
     
-    return RequestID;
+    SchedulerStats.CancelledPrefetches += NumCancelled;
+}
+
+void UVoiceSynthesisComponent::RegisterBanterEngine(UCompanionBanterEngine* BanterEngine)
+{
+    if (BanterEngine)
+    {
+        RegisteredBanterEngine = BanterEngine;
+        BanterEngine->OnBanterStarted.AddUniqueDynamic(this, &UVoiceSynthesisComponent::HandleBanterStarted);
+    }
+}
+
+void UVoiceSynthesisComponent::HandleBanterStarted(const FBanterConversation& Conversation)
+{
+    // Lines after the first are paced apart, so they are usually cached before they are spoken
+    TMap<FString, FNPCData> ResolvedSpeakers;
+    for (int32 i = 0; i < Conversation.DialogueLines.Num(); i++)
+    {
+        const FString SpeakerName = Conversation.Speakers.IsValidIndex(i) ? Conversation.Speakers[i] : TEXT("");
+        
+        const FNPCData* Speaker = ResolvedSpeakers.Find(SpeakerName);
+        if (!Speaker)
+        {
+            Speaker = &ResolvedSpeakers.Add(SpeakerName, ResolveBanterSpeaker(SpeakerName));
+        }
+        
+        PrefetchNPCDialogue(*Speaker, { Conversation.DialogueLines[i] });
+    }
+}
+
+FNPCData UVoiceSynthesisComponent::ResolveBanterSpeaker(const FString& SpeakerName) const
+{
+    FNPCData Speaker;
+    Speaker.Name = SpeakerName;
+    
+    // Banter speakers are companions; use their species, role and personality so the voice matches
+    const UCompanionBanterEngine* BanterEngine = RegisteredBanterEngine.Get();
+    const UCompanionManagerComponent* CompanionManager = BanterEngine ? BanterEngine->GetCompanionManager() : nullptr;
+    if (!CompanionManager || !CompanionManager->IsCompanionRecruited(SpeakerName))
+    {
+        return Speaker;
+    }
+    
+    const FActiveCompanion Companion = CompanionManager->GetActiveCompanion(SpeakerName);
+    Speaker.Species = Companion.CompanionData.Species;
+    Speaker.Alignment = Companion.CompanionData.Alignment;
+    Speaker.Role = StaticEnum<ECompanionRole>()->GetNameStringByValue(static_cast<int64>(Companion.CompanionData.Role));
+    Speaker.Backstory = Companion.CompanionData.Backstory;
+    Speaker.PersonalityTraits = Companion.CompanionData.PersonalityTraits;
+    
+    return Speaker;
+}
+
+FTTSSchedulerStats UVoiceSynthesisComponent::GetSchedulerStats() const
+{
+    FTTSSchedulerStats Stats = SchedulerStats;
+    Stats.InFlight = NumInFlightJobs;
+    Stats.Queued = SynthesisJobs.Num() - NumInFlightJobs;
+    return Stats;
+}
+
+void UVoiceSynthesisComponent::EnqueueSynthesis(const FString& CacheKey, const FTTSRequest& Request, const FString& WaitingRequestID)
+{
+    if (FTTSSynthesisJob* ExistingJob = SynthesisJobs.Find(CacheKey))
+    {
+        if (!WaitingRequestID.IsEmpty())
+        {
+            ExistingJob->WaitingRequestIDs.Add(WaitingRequestID);
+        }
+        ExistingJob->Priority = FMath::Max(ExistingJob->Priority, Request.Priority);
+        ExistingJob->Request.bCacheAudio |= Request.bCacheAudio;
+        
+        SchedulerStats.Coalesced++;
+        return;
+    }
+    
+    FTTSSynthesisJob& Job = SynthesisJobs.Add(CacheKey);
+    Job.Request = Request;
+    Job.Request.RequestID = CacheKey; // Providers report back by cache key
+    Job.Priority = Request.Priority;
+    Job.Sequence = NextJobSequence++;
+    
+    if (!WaitingRequestID.IsEmpty())
+    {
+        Job.WaitingRequestIDs.Add(WaitingRequestID);
+    }
+    
+    PumpSynthesisQueue();
+}
+
+void UVoiceSynthesisComponent::PumpSynthesisQueue()
+{
+    // MockTTS completes synchronously and re-enters through CompleteSynthesisJob; the outer loop carries on
+    if (bIsPumpingSynthesisQueue)
+    {
+        return;
+    }
+    TGuardValue<bool> PumpGuard(bIsPumpingSynthesisQueue, true);
+    
+    while (NumInFlightJobs < FMath::Max(MaxConcurrentRequests, 1))
+    {
+        // Highest priority first, oldest first within a priority
+        FTTSSynthesisJob* NextJob = nullptr;
+        for (TPair<FString, FTTSSynthesisJob>& Pair : SynthesisJobs)
+        {
+            FTTSSynthesisJob& Job = Pair.Value;
+            if (Job.bInFlight)
+            {
+                continue;
+            }
+            
+            if (!NextJob || Job.Priority > NextJob->Priority ||
+                (Job.Priority == NextJob->Priority && Job.Sequence < NextJob->Sequence))
+            {
+                NextJob = &Job;
+            }
+        }
+        
+        if (!NextJob)
+        {
+            break;
+        }
+        
+        NextJob->bInFlight = true;
+        NumInFlightJobs++;
+        SchedulerStats.Dispatched++;
+        
+        // Copy - a synchronous provider removes the job before returning
+        const FTTSRequest ProviderRequest = NextJob->Request;
+        DispatchToProvider(ProviderRequest);
+    }
+}
+
+void UVoiceSynthesisComponent::DispatchToProvider(const FTTSRequest& ProviderRequest)
+{
+    // Route to appropriate provider
+    switch (CurrentProvider)
+    {
+        case ETTSProvider::ElevenLabs:
+            SynthesizeWithElevenLabs(ProviderRequest);
+            break;
+        case ETTSProvider::AzureSpeech:
+            SynthesizeWithAzureSpeech(ProviderRequest);
+            break;
+        case ETTSProvider::OpenTTS:
+            SynthesizeWithOpenTTS(ProviderRequest);
+            break;
+        case ETTSProvider::LocalTTS:
+            SynthesizeWithLocalTTS(ProviderRequest);
+            break;
+        case ETTSProvider::MockTTS:
+        default:
+            SynthesizeWithMockTTS(ProviderRequest);
+            break;
+    }
+}
+
+void UVoiceSynthesisComponent::CompleteSynthesisJob(const FString& CacheKey, USoundWave* SoundWave)
+{
+    FTTSSynthesisJob Job;
+    if (!SynthesisJobs.RemoveAndCopyValue(CacheKey, Job))
+    {
+        return;
+    }
+    
+    if (Job.bInFlight && !Job.bLoadingFromDisk)
+    {
+        NumInFlightJobs--;
+    }
+    
+    // A wave already playing the stream keeps going; it stops once the stream drains
+    if (Job.Stream.IsValid())
+    {
+        Job.Stream->Finish();
+    }
+    StreamingWaves.Remove(CacheKey);
+    
+    for (const FString& RequestID : Job.WaitingRequestIDs)
+    {
+        OnVoiceSynthesisComplete.Broadcast(RequestID, SoundWave);
+        
+        TWeakObjectPtr<UAudioComponent> AudioComponent;
+        if (PendingPlayback.RemoveAndCopyValue(RequestID, AudioComponent))
+        {
+            StartPlayback(RequestID, SoundWave, AudioComponent.Get());
+        }
+    }
+    
+    PumpSynthesisQueue();
+}
+
+void UVoiceSynthesisComponent::FailSynthesisJob(const FString& CacheKey, const FString& ErrorMessage)
+{
+    FTTSSynthesisJob Job;
+    if (!SynthesisJobs.RemoveAndCopyValue(CacheKey, Job))
+    {
+        return;
+    }
+    
+    if (Job.bInFlight && !Job.bLoadingFromDisk)
+    {
+        NumInFlightJobs--;
+    }
+    
+    // A wave already playing the stream keeps going; it stops once the stream drains
+    if (Job.Stream.IsValid())
+    {
+        Job.Stream->Finish();
+    }
+    StreamingWaves.Remove(CacheKey);
+    
+    if (Job.WaitingRequestIDs.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceSynthesisComponent: Prefetch failed: %s"), *ErrorMessage);
+    }
+    
+    for (const FString& RequestID : Job.WaitingRequestIDs)
+    {
+        PendingPlayback.Remove(RequestID);
+        ActiveRequests.Remove(RequestID);
+        OnVoiceSynthesisError.Broadcast(RequestID, ErrorMessage);
+    }
+    
+    PumpSynthesisQueue();
+}
+
+bool UVoiceSynthesisComponent::StartDiskCacheLoad(const FString& CacheKey, const FTTSRequest& Request, const FString& WaitingRequestID)
+{
+    // An existing job (synthesis or disk load) is shared through EnqueueSynthesis instead
+    FVoiceAudioCacheEntry Entry;
+    if (!bEnableDiskCache || SynthesisJobs.Contains(CacheKey) || !FVoiceAudioDiskCache::Get().FindAndTouch(CacheKey, Entry))
+    {
+        return false;
+    }
+    
+    // In flight from the start so the scheduler never dispatches it to a provider
+    FTTSSynthesisJob& Job = SynthesisJobs.Add(CacheKey);
+    Job.Request = Request;
+    Job.Request.RequestID = CacheKey;
+    Job.Priority = Request.Priority;
+    Job.Sequence = NextJobSequence++;
+    Job.bInFlight = true;
+    Job.bLoadingFromDisk = true;
+    
+    if (!WaitingRequestID.IsEmpty())
+    {
+        Job.WaitingRequestIDs.Add(WaitingRequestID);
+    }
+    
+    const FString BlobPath = FVoiceAudioDiskCache::Get().GetBlobPath(CacheKey);
+    TWeakObjectPtr<UVoiceSynthesisComponent> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, CacheKey, BlobPath, Entry]()
+    {
+        TArray<uint8> AudioData;
+        if (!FFileHelper::LoadFileToArray(AudioData, *BlobPath, FILEREAD_Silent) || AudioData.Num() != Entry.SizeBytes)
+        {
+            AudioData.Empty();
+        }
+        
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, CacheKey, AudioData = MoveTemp(AudioData), Entry]() mutable
+        {
+            if (UVoiceSynthesisComponent* This = WeakThis.Get())
+            {
+                This->HandleDiskCacheLoaded(CacheKey, MoveTemp(AudioData), Entry.SampleRate, Entry.NumChannels);
+            }
+        });
+    });
+    
+    return true;
+}
+
+void UVoiceSynthesisComponent::HandleDiskCacheLoaded(const FString& CacheKey, TArray<uint8> AudioData, int32 SampleRate, int32 NumChannels)
+{
+    // The job is gone if the component shut down while the blob was being read
+    FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey);
+    if (!Job || !Job->bLoadingFromDisk)
+    {
+        return;
+    }
+    
+    USoundWave* SoundWave = AudioData.Num() > 0 ? CreateSoundWaveFromData(AudioData, SampleRate, NumChannels) : nullptr;
+    if (!SoundWave)
+    {
+        // Missing or truncated blob: forget it and synthesize the line instead
+        UE_LOG(LogTemp, Warning, TEXT("VoiceSynthesisComponent: Cached audio %s is missing or truncated"), *CacheKey);
+        FVoiceAudioDiskCache::Get().Invalidate(CacheKey);
+        
+        Job->bLoadingFromDisk = false;
+        Job->bInFlight = false;
+        PumpSynthesisQueue();
+        return;
+    }
+    
+    // A regular wave rewinds and finishes like any other sound; later hits skip the disk
+    AddToMemoryCache(CacheKey, SoundWave);
+    CompleteSynthesisJob(CacheKey, SoundWave);
 }
 
 bool UVoiceSynthesisComponent::IsAudioCached(const FString& Text, const FVoiceProfile& VoiceProfile) const
 {
     FString CacheKey = GenerateCacheKey(Text, VoiceProfile);
-    return AudioCache.Contains(CacheKey);
+    return AudioCache.Contains(CacheKey) || (bEnableDiskCache && FVoiceAudioDiskCache::Get().Contains(CacheKey));
 }
 
-void UVoiceSynthesisComponent::ClearAudioCache()
+void UVoiceSynthesisComponent::ClearAudioCache(bool bIncludeDiskCache)
 {
     AudioCache.Empty();
+    AudioCacheOrder.Empty();
+    
+    if (bIncludeDiskCache)
+    {
+        FVoiceAudioDiskCache::Get().Clear();
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("VoiceSynthesisComponent: Audio cache cleared"));
 }
 
@@ -291,49 +772,52 @@ TArray<FVoiceProfile> UVoiceSynthesisComponent::GetAvailableVoiceProfiles() cons
 }
 
 void UVoiceSynthesisComponent::SynthesizeWithMockTTS(const FTTSRequest& Request)
+{
+    // Simulated round trip, so queueing and coalescing can be exercised without a backend
+    if (MockLatency > 0.0f && GetWorld())
+    {
+        FTimerHandle TimerHandle;
+        FTimerDelegate TimerDelegate = FTimerDelegate::CreateUObject(this, &UVoiceSynthesisComponent::CompleteMockTTS, Request);
+        GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, MockLatency, false);
+        return;
+    }
+    
+    CompleteMockTTS(Request);
+}
+
+void UVoiceSynthesisComponent::CompleteMockTTS(const FTTSRequest& Request)
 {
     // Mock TTS for testing - creates a simple beep sound
     UE_LOG(LogTemp, Log, TEXT("VoiceSynthesisComponent: Mock TTS synthesis for: %s"), *Request.Text);
     
-    // Create a simple sine wave sound for testing
+    const int32 SampleRate = 44100;
+    const int32 SampleCount = SampleRate * 2; // 2 seconds at 44.1kHz
+    const int32 NumBytes = SampleCount * sizeof(int16);
+    
     USoundWave* MockSoundWave = NewObject<USoundWave>();
     if (MockSoundWave)
     {
-        // Set basic properties
-        MockSoundWave->SetSampleRate(44100);
+        MockSoundWave->SetSampleRate(SampleRate);
         MockSoundWave->NumChannels = 1;
-        MockSoundWave->Duration = 2.0f; // 2 second duration
-        
-        // Generate simple sine wave data
-        int32 SampleCount = 44100 * 2; // 2 seconds at 44.1kHz
-        TArray<int16> SampleData;
-        SampleData.SetNum(SampleCount);
-        
-        for (int32 i = 0; i < SampleCount; i++)
-        {
-            float Time = static_cast<float>(i) / 44100.0f;
-            float Frequency = 440.0f; // A4 note
-            float Amplitude = 0.3f;
-            SampleData[i] = static_cast<int16>(Amplitude * 32767.0f * FMath::Sin(2.0f * PI * Frequency * Time));
-        }
+        MockSoundWave->Duration = 2.0f;
         
-        // Set the raw PCM data
-        MockSoundWave->RawPCMData = reinterpret_cast<uint8*>(SampleData.GetData());
-        MockSoundWave->RawPCMDataSize = SampleData.Num() * sizeof(int16);
+        // Render the tone (A4) straight into the sound wave's PCM buffer, with a 10ms fade at each end
+        MockSoundWave->RawPCMData = static_cast<uint8*>(FMemory::Malloc(NumBytes));
+        MockSoundWave->RawPCMDataSize = NumBytes;
+        VoicePCM::RenderTone(reinterpret_cast<int16*>(MockSoundWave->RawPCMData), SampleCount, 440.0f, SampleRate, 0.3f, SampleRate / 100);
         
         // Cache the audio
         if (bEnableAudioCaching && Request.bCacheAudio)
         {
-            FString CacheKey = GenerateCacheKey(Request.Text, Request.VoiceProfile);
-            AddToCache(CacheKey, MockSoundWave);
+            AddToCache(Request.RequestID, MockSoundWave, TArray<uint8>(MockSoundWave->RawPCMData, NumBytes), SampleRate, 1);
         }
         
         // Broadcast completion
-        OnVoiceSynthesisComplete.Broadcast(Request.RequestID, MockSoundWave);
+        CompleteSynthesisJob(Request.RequestID, MockSoundWave);
     }
     else
     {
-        OnVoiceSynthesisError.Broadcast(Request.RequestID, TEXT("Failed to create mock sound wave"));
+        FailSynthesisJob(Request.RequestID, TEXT("Failed to create mock sound wave"));
     }
 }
 
@@ -342,20 +826,25 @@ void UVoiceSynthesisComponent::SynthesizeWithElevenLabs(const FTTSRequest& Reque
     // ElevenLabs API implementation
     if (APIKey.IsEmpty())
     {
-        OnVoiceSynthesisError.Broadcast(Request.RequestID, TEXT("ElevenLabs API key not set"));
+        FailSynthesisJob(Request.RequestID, TEXT("ElevenLabs API key not set"));
         return;
     }
     
     // Create HTTP request
     TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
     
-    // Set URL
+    // Set URL (raw 16-bit PCM so chunks can be queued for playback without decoding)
     FString URL = APIEndpoint + Request.VoiceProfile.VoiceID;
+    if (bStreamPlayback)
+    {
+        URL += TEXT("/stream");
+    }
+    URL += TEXT("?output_format=pcm_44100");
     HttpRequest->SetURL(URL);
     HttpRequest->SetVerb(TEXT("POST"));
     
     // Set headers
-    HttpRequest->SetHeader(TEXT("Accept"), TEXT("audio/mpeg"));
+    HttpRequest->SetHeader(TEXT("Accept"), TEXT("audio/pcm"));
     HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("xi-api-key"), APIKey);
     
@@ -377,6 +866,11 @@ void UVoiceSynthesisComponent::SynthesizeWithElevenLabs(const FTTSRequest& Reque
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindUObject(this, &UVoiceSynthesisComponent::HandleHTTPResponse, Request.RequestID);
     
+    if (bStreamPlayback)
+    {
+        AttachResponseStream(HttpRequest, Request.RequestID);
+    }
+    
     // Send request
     HttpRequest->ProcessRequest();
     
@@ -387,19 +881,47 @@ void UVoiceSynthesisComponent::SynthesizeWithElevenLabs(const FTTSRequest& Reque
 void UVoiceSynthesisComponent::SynthesizeWithAzureSpeech(const FTTSRequest& Request)
 {
     UE_LOG(LogTemp, Warning, TEXT("VoiceSynthesisComponent: Azure Speech not implemented yet"));
-    OnVoiceSynthesisError.Broadcast(Request.RequestID, TEXT("Azure Speech not implemented"));
+    FailSynthesisJob(Request.RequestID, TEXT("Azure Speech not implemented"));
 }
 
 void UVoiceSynthesisComponent::SynthesizeWithOpenTTS(const FTTSRequest& Request)
 {
     UE_LOG(LogTemp, Warning, TEXT("VoiceSynthesisComponent: OpenTTS not implemented yet"));
-    OnVoiceSynthesisError.Broadcast(Request.RequestID, TEXT("OpenTTS not implemented"));
+    FailSynthesisJob(Request.RequestID, TEXT("OpenTTS not implemented"));
 }
 
 void UVoiceSynthesisComponent::SynthesizeWithLocalTTS(const FTTSRequest& Request)
 {
-    UE_LOG(LogTemp, Warning, TEXT("VoiceSynthesisComponent: Local TTS not implemented yet"));
-    OnVoiceSynthesisError.Broadcast(Request.RequestID, TEXT("Local TTS not implemented"));
+    // Local TTS server: JSON in, raw 16-bit mono PCM at 44.1kHz out
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    
+    HttpRequest->SetURL(APIEndpoint.IsEmpty() ? TEXT("http://localhost:8080/tts") : APIEndpoint);
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetHeader(TEXT("Accept"), TEXT("audio/pcm"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    
+    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    JsonObject->SetStringField(TEXT("text"), Request.Text);
+    JsonObject->SetStringField(TEXT("voice"), Request.VoiceProfile.VoiceID);
+    JsonObject->SetNumberField(TEXT("pitch"), Request.VoiceProfile.Pitch);
+    JsonObject->SetNumberField(TEXT("speed"), Request.VoiceProfile.Speed);
+    JsonObject->SetNumberField(TEXT("sample_rate"), 44100);
+    
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    
+    HttpRequest->SetContentAsString(OutputString);
+    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UVoiceSynthesisComponent::HandleHTTPResponse, Request.RequestID);
+    
+    if (bStreamPlayback)
+    {
+        AttachResponseStream(HttpRequest, Request.RequestID);
+    }
+    
+    HttpRequest->ProcessRequest();
+    
+    UE_LOG(LogTemp, Log, TEXT("VoiceSynthesisComponent: Local TTS request sent for: %s"), *Request.Text);
 }
 
 FString UVoiceSynthesisComponent::GenerateRequestID()
@@ -407,62 +929,97 @@ FString UVoiceSynthesisComponent::GenerateRequestID()
     return FGuid::NewGuid().ToString();
 }
 
-FString UVoiceSynthesisComponent::GenerateCacheKey(const FString& Text, const FVoiceProfile& VoiceProfile)
+FString UVoiceSynthesisComponent::GenerateCacheKey(const FString& Text, const FVoiceProfile& VoiceProfile) const
 {
     FString CombinedString = Text + VoiceProfile.VoiceID + FString::Printf(TEXT("%.2f"), VoiceProfile.Pitch);
     return FMD5::HashAnsiString(*CombinedString);
 }
 
-void UVoiceSynthesisComponent::AddToCache(const FString& CacheKey, USoundWave* SoundWave)
+void UVoiceSynthesisComponent::AddToCache(const FString& CacheKey, USoundWave* SoundWave, TArray<uint8> AudioData,
+                                          int32 SampleRate, int32 NumChannels)
 {
-    if (AudioCache.Num() >= MaxCacheSize)
+    AddToMemoryCache(CacheKey, SoundWave);
+    
+    if (bEnableDiskCache)
     {
-        CleanupCache();
+        FVoiceAudioDiskCache::Get().Store(CacheKey, MoveTemp(AudioData), SampleRate, NumChannels);
     }
-    
-    AudioCache.Add(CacheKey, SoundWave);
 }
 
-USoundWave* UVoiceSynthesisComponent::GetFromCache(const FString& CacheKey)
+void UVoiceSynthesisComponent::AddToMemoryCache(const FString& CacheKey, USoundWave* SoundWave)
 {
     if (AudioCache.Contains(CacheKey))
     {
-        return AudioCache[CacheKey];
+        AudioCache[CacheKey] = SoundWave;
+        TouchCacheEntry(CacheKey);
+    }
+    else
+    {
+        if (AudioCache.Num() >= MaxCacheSize)
+        {
+            CleanupCache();
+        }
+        
+        AudioCache.Add(CacheKey, SoundWave);
+        AudioCacheOrder.Add(CacheKey);
+    }
+}
+
+USoundWave* UVoiceSynthesisComponent::GetFromCache(const FString& CacheKey)
+{
+    if (USoundWave** CachedAudio = AudioCache.Find(CacheKey))
+    {
+        TouchCacheEntry(CacheKey);
+        return *CachedAudio;
     }
+    
+    // Disk hits are loaded asynchronously through StartDiskCacheLoad
     return nullptr;
 }
 
+void UVoiceSynthesisComponent::TouchCacheEntry(const FString& CacheKey)
+{
+    AudioCacheOrder.RemoveSingle(CacheKey);
+    AudioCacheOrder.Add(CacheKey);
+}
+
 void UVoiceSynthesisComponent::CleanupCache()
 {
-    // Simple cleanup - remove oldest entries
-    if (AudioCache.Num() > MaxCacheSize * 0.8f)
+    // Evict least recently used entries down to 80% (they stay on disk)
+    const int32 TargetSize = FMath::Max(static_cast<int32>(MaxCacheSize * 0.8f), 0);
+    const int32 ToRemove = FMath::Min(AudioCacheOrder.Num() - TargetSize, AudioCacheOrder.Num());
+    
+    if (ToRemove > 0)
     {
-        int32 ToRemove = AudioCache.Num() - static_cast<int32>(MaxCacheSize * 0.8f);
-        
-        TArray<FString> Keys;
-        AudioCache.GetKeys(Keys);
-        
-        for (int32 i = 0; i < ToRemove && i < Keys.Num(); i++)
+        for (int32 i = 0; i < ToRemove; i++)
         {
-            AudioCache.Remove(Keys[i]);
+            AudioCache.Remove(AudioCacheOrder[i]);
         }
+        AudioCacheOrder.RemoveAt(0, ToRemove);
     }
 }
 
 void UVoiceSynthesisComponent::HandleHTTPResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, 
-                                                 bool bWasSuccessful, FString RequestID)
+                                                 bool bWasSuccessful, FString CacheKey)
 {
-    if (!ActiveRequests.Contains(RequestID))
+    const FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey);
+    if (!Job)
     {
         return;
     }
     
-    const FTTSRequest& TTSRequest = ActiveRequests[RequestID];
-    
     if (bWasSuccessful && Response.IsValid() && Response->GetResponseCode() == 200)
     {
-        // Get audio data
-        TArray<uint8> AudioData = Response->GetContent();
+        // Get audio data (a streamed body went into the job's stream instead of the response)
+        TArray<uint8> AudioData;
+        if (Job->Stream.IsValid())
+        {
+            Job->Stream->CopyReceived(AudioData);
+        }
+        else
+        {
+            AudioData = Response->GetContent();
+        }
         
         // Create sound wave from data
         USoundWave* SoundWave = CreateSoundWaveFromData(AudioData);
@@ -470,31 +1027,160 @@ void UVoiceSynthesisComponent::HandleHTTPResponse(FHttpRequestPtr Request, FHttp
         if (SoundWave)
         {
             // Cache the audio
-            if (bEnableAudioCaching && TTSRequest.bCacheAudio)
+            if (bEnableAudioCaching && Job->Request.bCacheAudio)
             {
-                FString CacheKey = GenerateCacheKey(TTSRequest.Text, TTSRequest.VoiceProfile);
-                AddToCache(CacheKey, SoundWave);
+                AddToCache(CacheKey, SoundWave, MoveTemp(AudioData));
             }
             
-            OnVoiceSynthesisComplete.Broadcast(RequestID, SoundWave);
+            CompleteSynthesisJob(CacheKey, SoundWave);
         }
         else
         {
-            OnVoiceSynthesisError.Broadcast(RequestID, TEXT("Failed to create sound wave from response"));
+            FailSynthesisJob(CacheKey, TEXT("Failed to create sound wave from response"));
         }
     }
     else
     {
         FString ErrorMessage = FString::Printf(TEXT("HTTP request failed: %d"), 
                                              Response.IsValid() ? Response->GetResponseCode() : 0);
-        OnVoiceSynthesisError.Broadcast(RequestID, ErrorMessage);
+        FailSynthesisJob(CacheKey, ErrorMessage);
     }
+}
+
+void UVoiceSynthesisComponent::AttachResponseStream(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const FString& CacheKey)
+{
+    FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey);
+    if (!Job)
+    {
+        return;
+    }
+    
+    TSharedRef<FVoiceAudioStream, ESPMode::ThreadSafe> Stream = MakeShared<FVoiceAudioStream, ESPMode::ThreadSafe>();
+    Job->Stream = Stream;
+    Job->HttpRequest = HttpRequest;
     
-    // Clean up request
-    ActiveRequests.Remove(RequestID);
+    TWeakObjectPtr<UVoiceSynthesisComponent> WeakThis(this);
+    HttpRequest->SetResponseBodyReceiveStream(MakeShared<FVoiceResponseArchive>(Stream, [WeakThis, CacheKey]()
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, CacheKey]()
+        {
+            if (UVoiceSynthesisComponent* This = WeakThis.Get())
+            {
+                This->HandleStreamStarted(CacheKey);
+            }
+        });
+    }));
+}
+
+void UVoiceSynthesisComponent::HandleStreamStarted(const FString& CacheKey)
+{
+    const FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey);
+    if (!Job)
+    {
+        return;
+    }
+    
+    // Start every line that is waiting to play on the first chunk
+    TArray<TPair<FString, TWeakObjectPtr<UAudioComponent>>> StartNow;
+    for (const FString& RequestID : Job->WaitingRequestIDs)
+    {
+        TWeakObjectPtr<UAudioComponent> AudioComponent;
+        if (PendingPlayback.RemoveAndCopyValue(RequestID, AudioComponent))
+        {
+            StartNow.Emplace(RequestID, AudioComponent);
+        }
+    }
+    
+    if (StartNow.Num() == 0)
+    {
+        return;
+    }
+    
+    USoundWaveProcedural* StreamingWave = GetOrCreateStreamingWave(CacheKey);
+    for (const TPair<FString, TWeakObjectPtr<UAudioComponent>>& Pending : StartNow)
+    {
+        if (StreamingWave)
+        {
+            StartPlayback(Pending.Key, StreamingWave, Pending.Value.Get());
+        }
+        else
+        {
+            // Not audio (e.g. an error body); wait for the full response
+            PendingPlayback.Add(Pending.Key, Pending.Value);
+        }
+    }
+}
+
+USoundWaveProcedural* UVoiceSynthesisComponent::GetOrCreateStreamingWave(const FString& CacheKey)
+{
+    if (USoundWaveProcedural** ExistingWave = StreamingWaves.Find(CacheKey))
+    {
+        return *ExistingWave;
+    }
+    
+    const FTTSSynthesisJob* Job = SynthesisJobs.Find(CacheKey);
+    if (!Job || !Job->Stream.IsValid() || Job->Stream->GetNumReceived() == 0)
+    {
+        return nullptr;
+    }
+    
+    FHttpResponsePtr Response = Job->HttpRequest.IsValid() ? Job->HttpRequest->GetResponse() : nullptr;
+    if (!Response.IsValid() || Response->GetResponseCode() != 200)
+    {
+        return nullptr;
+    }
+    
+    USoundWaveProcedural* SoundWave = NewObject<USoundWaveProcedural>();
+    SoundWave->SetSampleRate(44100);
+    SoundWave->NumChannels = 1;
+    SoundWave->Duration = INDEFINITELY_LOOPING_DURATION; // Unknown until the last chunk
+    SoundWave->SoundGroup = SOUNDGROUP_Voice;
+    SoundWave->bLooping = false;
+    
+    // Pull whatever has arrived when the mixer runs dry (audio render thread). Once the
+    // download is done and everything has played, tell the game thread so playback can finish.
+    TSharedRef<FVoiceAudioStream, ESPMode::ThreadSafe> Stream = Job->Stream.ToSharedRef();
+    TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bDrainReported = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    TWeakObjectPtr<UVoiceSynthesisComponent> WeakThis(this);
+    TWeakObjectPtr<USoundWave> WeakWave(SoundWave);
+    
+    SoundWave->OnSoundWaveProceduralUnderflow = FOnSoundWaveProceduralUnderflow::CreateLambda(
+        [Stream, bDrainReported, WeakThis, WeakWave](USoundWaveProcedural* Wave, int32 SamplesRequired)
+        {
+            TArray<uint8> Chunk;
+            if (Stream->Read(Chunk, SamplesRequired * sizeof(int16)) > 0)
+            {
+                Wave->QueueAudio(Chunk.GetData(), Chunk.Num());
+                return;
+            }
+            
+            if (Stream->IsDrained() && Wave->GetAvailableAudioByteCount() == 0 && !bDrainReported->exchange(true))
+            {
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakWave]()
+                {
+                    if (UVoiceSynthesisComponent* This = WeakThis.Get())
+                    {
+                        This->HandleProceduralWaveDrained(WeakWave.Get());
+                    }
+                });
+            }
+        });
+    
+    StreamingWaves.Add(CacheKey, SoundWave);
+    return SoundWave;
+}
+
+void UVoiceSynthesisComponent::HandleProceduralWaveDrained(const USoundWave* SoundWave)
+{
+    // Procedural waves never end on their own; stop the line once its audio has all played
+    UAudioComponent* AudioComponent = PlaybackAudioComponent.Get();
+    if (bIsPlaying && SoundWave && AudioComponent && AudioComponent->Sound == SoundWave)
+    {
+        StopVoicePlayback();
+    }
 }
 
-USoundWave* UVoiceSynthesisComponent::CreateSoundWaveFromData(const TArray<uint8>& AudioData)
+USoundWave* UVoiceSynthesisComponent::CreateSoundWaveFromData(const TArray<uint8>& AudioData, int32 SampleRate, int32 NumChannels)
 {
     // This is a simplified implementation
     // In a real implementation, you'd need to properly parse the audio format
@@ -502,9 +1188,9 @@ USoundWave* UVoiceSynthesisComponent::CreateSoundWaveFromData(const TArray<uint8
     if (SoundWave && AudioData.Num() > 0)
     {
         // Set basic properties (these would need to be determined from the audio format)
-        SoundWave->SetSampleRate(44100);
-        SoundWave->NumChannels = 1;
-        SoundWave->Duration = static_cast<float>(AudioData.Num()) / (44100.0f * 2.0f); // Rough estimate
+        SoundWave->SetSampleRate(SampleRate);
+        SoundWave->NumChannels = NumChannels;
+        SoundWave->Duration = static_cast<float>(AudioData.Num()) / (SampleRate * NumChannels * 2.0f); // Rough estimate
         
         // Copy audio data
         SoundWave->RawPCMData = static_cast<uint8*>(FMemory::Malloc(AudioData.Num()));
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Companions/CompanionManagerComponent.h"
+#include "AIDM/SaveGameContainer.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
@@ -26,9 +27,19 @@ void UCompanionManagerComponent::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Companion symbols are campaign-scoped; re-intern them when a new campaign is loaded
+    FAIDMSymbolTable::Get().OnReset().AddUObject(this, &UCompanionManagerComponent::HandleSymbolsReset);
+    
     UE_LOG(LogTemp, Log, TEXT("CompanionManagerComponent: Initialized"));
 }
 
+void UCompanionManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    FAIDMSymbolTable::Get().OnReset().RemoveAll(this);
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 void UCompanionManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -84,11 +95,13 @@ bool UCompanionManagerComponent::RecruitCompanion(const FString& CompanionName)
     // Create active companion
     FActiveCompanion NewActiveCompanion;
     NewActiveCompanion.CompanionData = *FoundCompanion;
+    NewActiveCompanion.CompanionSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Companion, FoundCompanion->Name);
     NewActiveCompanion.bIsRecruited = true;
     NewActiveCompanion.Loyalty = ECompanionLoyalty::Friendly; // Start as friendly
     NewActiveCompanion.LoyaltyPoints = 50; // Neutral starting loyalty
     
-    ActiveCompanions.Add(NewActiveCompanion);
+    ActiveCompanionSlots.Add(NewActiveCompanion.CompanionSymbol, ActiveCompanions.Add(NewActiveCompanion));
+    SaveRevision.MarkChanged();
     
     // Broadcast recruitment event
     OnCompanionRecruited.Broadcast(NewActiveCompanion);
@@ -129,6 +142,7 @@ bool UCompanionManagerComponent::AddCompanionToParty(const FString& CompanionNam
     {
         Companion->bIsInParty = true;
         Companion->CurrentOrder = ECompanionOrder::Follow;
+        SaveRevision.MarkChanged();
         
         // Spawn companion pawn
         SpawnCompanionPawn(*Companion);
@@ -146,6 +160,7 @@ bool UCompanionManagerComponent::RemoveCompanionFromParty(const FString& Compani
     if (Companion && Companion->bIsInParty)
     {
         Companion->bIsInParty = false;
+        SaveRevision.MarkChanged();
         
         // Despawn companion pawn
         DespawnCompanionPawn(*Companion);
@@ -163,6 +178,7 @@ void UCompanionManagerComponent::GiveCompanionOrder(const FString& CompanionName
     if (Companion && Companion->bIsInParty)
     {
         Companion->CurrentOrder = Order;
+        SaveRevision.MarkChanged();
         
         // Broadcast order event
         OnCompanionOrderGiven.Broadcast(*Companion, Order);
@@ -196,6 +212,7 @@ void UCompanionManagerComponent::AdjustCompanionLoyalty(const FString& Companion
     
     // Clamp loyalty points
     Companion->LoyaltyPoints = FMath::Clamp(Companion->LoyaltyPoints, -100, 100);
+    SaveRevision.MarkChanged();
     
     // Update loyalty level
     ECompanionLoyalty NewLoyalty = CalculateLoyaltyLevel(Companion->LoyaltyPoints);
@@ -420,33 +437,168 @@ bool UCompanionManagerComponent::LoadCompanionData(const FString& SaveData)
         }
     }
     
+    SaveRevision.MarkChanged();
+    
     UE_LOG(LogTemp, Log, TEXT("CompanionManagerComponent: Loaded companion data"));
     return true;
 }
 
-// Private helper methods
-FActiveCompanion* UCompanionManagerComponent::FindActiveCompanion(const FString& CompanionName)
+namespace
 {
-    for (FActiveCompanion& Companion : ActiveCompanions)
+    constexpr uint32 CompanionChunkVersion = 1;
+
+    struct FSavedCompanion
+    {
+        FString Name;
+        bool bIsRecruited = false;
+        bool bIsInParty = false;
+        int32 LoyaltyPoints = 0;
+        ECompanionLoyalty Loyalty = ECompanionLoyalty::Neutral;
+        ECompanionOrder CurrentOrder = ECompanionOrder::Follow;
+        TArray<TPair<FString, float>> RelationshipHistory;
+    };
+}
+
+void UCompanionManagerComponent::WriteSaveChunk(FSaveGameContainer& Container) const
+{
+    if (!SaveRevision.NeedsWrite(Container, SaveContainer::CompanionChunk))
+    {
+        return;
+    }
+
+    FSaveChunkWriter Writer;
+    Writer.WriteVarU32(ActiveCompanions.Num());
+    for (const FActiveCompanion& Companion : ActiveCompanions)
     {
-        if (Companion.CompanionData.Name == CompanionName)
+        Writer.WriteString(Companion.CompanionData.Name);
+        Writer.WriteU8((Companion.bIsRecruited ? 1 : 0) | (Companion.bIsInParty ? 2 : 0));
+        Writer.WriteVarI32(Companion.LoyaltyPoints);
+        Writer.WriteU8(static_cast<uint8>(Companion.Loyalty));
+        Writer.WriteU8(static_cast<uint8>(Companion.CurrentOrder));
+
+        Writer.WriteVarU32(Companion.RelationshipHistory.Num());
+        for (const TPair<FString, float>& Entry : Companion.RelationshipHistory)
         {
-            return &Companion;
+            Writer.WriteString(Entry.Key);
+            Writer.WriteF32(Entry.Value);
         }
     }
-    return nullptr;
+
+    TArray<uint8> Payload;
+    Writer.Finalize(Payload);
+    Container.SetChunk(SaveContainer::CompanionChunk, CompanionChunkVersion, MoveTemp(Payload));
+    SaveRevision.MarkSynced(Container);
 }
 
-const FActiveCompanion* UCompanionManagerComponent::FindActiveCompanion(const FString& CompanionName) const
+bool UCompanionManagerComponent::ReadSaveChunk(const FSaveGameContainer& Container)
 {
-    for (const FActiveCompanion& Companion : ActiveCompanions)
+    TArray<uint8> Payload;
+    if (!Container.GetChunk(SaveContainer::CompanionChunk, CompanionChunkVersion, Payload))
+    {
+        return false;
+    }
+
+    // Decode everything first; recruiting and spawning only happen for a chunk that read cleanly
+    FSaveChunkReader Reader(Payload);
+    TArray<FSavedCompanion> Saved;
+    Saved.SetNum(Reader.ReadCount());
+    for (FSavedCompanion& Companion : Saved)
+    {
+        Companion.Name = Reader.ReadString();
+        const uint8 Flags = Reader.ReadU8();
+        Companion.bIsRecruited = (Flags & 1) != 0;
+        Companion.bIsInParty = (Flags & 2) != 0;
+        Companion.LoyaltyPoints = Reader.ReadVarI32();
+
+        const uint8 LoyaltyValue = Reader.ReadU8();
+        Companion.Loyalty = LoyaltyValue <= static_cast<uint8>(ECompanionLoyalty::Devoted) ? static_cast<ECompanionLoyalty>(LoyaltyValue) : ECompanionLoyalty::Neutral;
+        const uint8 OrderValue = Reader.ReadU8();
+        Companion.CurrentOrder = OrderValue <= static_cast<uint8>(ECompanionOrder::Free) ? static_cast<ECompanionOrder>(OrderValue) : ECompanionOrder::Follow;
+
+        Companion.RelationshipHistory.SetNum(Reader.ReadCount());
+        for (TPair<FString, float>& Entry : Companion.RelationshipHistory)
+        {
+            Entry.Key = Reader.ReadString();
+            Entry.Value = Reader.ReadF32();
+        }
+    }
+
+    if (!Reader.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("CompanionManagerComponent: Companion save chunk is corrupt"));
+        return false;
+    }
+
+    const bool bRestoredIntoEmptyRoster = ActiveCompanions.Num() == 0;
+
+    for (const FSavedCompanion& Entry : Saved)
     {
-        if (Companion.CompanionData.Name == CompanionName)
+        // Find companion in available companions and recruit if needed
+        if (!IsCompanionRecruited(Entry.Name))
+        {
+            RecruitCompanion(Entry.Name);
+        }
+
+        FActiveCompanion* Companion = FindActiveCompanion(Entry.Name);
+        if (!Companion)
+        {
+            continue;
+        }
+
+        Companion->bIsRecruited = Entry.bIsRecruited;
+        Companion->bIsInParty = Entry.bIsInParty;
+        Companion->LoyaltyPoints = Entry.LoyaltyPoints;
+        Companion->Loyalty = Entry.Loyalty;
+        Companion->CurrentOrder = Entry.CurrentOrder;
+        for (const TPair<FString, float>& History : Entry.RelationshipHistory)
         {
-            return &Companion;
+            Companion->RelationshipHistory.Add(History.Key, History.Value);
         }
+
+        if (Companion->bIsInParty)
+        {
+            SpawnCompanionPawn(*Companion);
+        }
+    }
+
+    // Loading merges into companions recruited before it; only a restore into an empty roster matches the chunk
+    if (bRestoredIntoEmptyRoster)
+    {
+        SaveRevision.MarkSynced(Container);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CompanionManagerComponent: Loaded %d companions from save chunk"), Saved.Num());
+    return true;
+}
+
+// Private helper methods
+FActiveCompanion* UCompanionManagerComponent::FindActiveCompanion(const FString& CompanionName)
+{
+    return const_cast<FActiveCompanion*>(static_cast<const UCompanionManagerComponent*>(this)->FindActiveCompanion(CompanionName));
+}
+
+const FActiveCompanion* UCompanionManagerComponent::FindActiveCompanion(const FString& CompanionName) const
+{
+    // Names are interned on recruitment, so an unknown name cannot be an active companion
+    const FAIDMId CompanionSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Companion, CompanionName);
+    if (!CompanionSymbol.IsValid())
+    {
+        return nullptr;
+    }
+
+    const int32* Slot = ActiveCompanionSlots.Find(CompanionSymbol);
+    return Slot ? &ActiveCompanions[*Slot] : nullptr;
+}
+
+void UCompanionManagerComponent::HandleSymbolsReset()
+{
+    ActiveCompanionSlots.Reset();
+    for (int32 Slot = 0; Slot < ActiveCompanions.Num(); ++Slot)
+    {
+        FActiveCompanion& Companion = ActiveCompanions[Slot];
+        Companion.CompanionSymbol = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Companion, Companion.CompanionData.Name);
+        ActiveCompanionSlots.Add(Companion.CompanionSymbol, Slot);
     }
-    return nullptr;
 }
 
 void UCompanionManagerComponent::LoadCompanionsFromCampaign()
@@ -383,10 +383,12 @@ void UAIDMDebugWidget::UpdateLayoutSelector()
     
     LayoutSelector->ClearOptions();
     
-    FPlanetData CurrentPlanet = AIDirectorRef->GetCurrentPlanetData();
-    for (const FMapLayout& Layout : CurrentPlanet.Layouts)
+    if (const FPlanetData* CurrentPlanet = AIDirectorRef->FindCurrentPlanetData())
     {
-        LayoutSelector->AddOption(Layout.Name);
+        for (const FMapLayout& Layout : CurrentPlanet->Layouts)
+        {
+            LayoutSelector->AddOption(Layout.Name);
+        }
     }
 }
 
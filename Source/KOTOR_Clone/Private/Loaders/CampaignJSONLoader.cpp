@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Loaders/CampaignJSONLoader.h"
+#include "Loaders/CampaignJSONStreamReader.h"
+#include "Misc/Paths.h"
+
+EJSONParseResult UCampaignJSONLoader::LoadCampaignFromFile(const FString& FilePath, bool bValidateData)
+{
+    OnCampaignLoadStarted.Broadcast(FilePath, FPaths::GetBaseFilename(FilePath));
+    OnCampaignLoadStartedEvent(FilePath, FPaths::GetBaseFilename(FilePath));
+
+    // Single pass: the file is tokenized from disk and validated while FCampaignPlan is filled
+    FCampaignPlan CampaignData;
+    EJSONParseResult Result = FCampaignJSONStreamReader::ReadFromFile(FilePath, CampaignData, LastValidationResult);
+
+    return FinishCampaignLoad(FilePath, Result, CampaignData, bValidateData);
+}
+
+EJSONParseResult UCampaignJSONLoader::LoadCampaignFromString(const FString& JSONString, bool bValidateData)
+{
+    OnCampaignLoadStarted.Broadcast(TEXT(""), TEXT(""));
+    OnCampaignLoadStartedEvent(TEXT(""), TEXT(""));
+
+    FCampaignPlan CampaignData;
+    EJSONParseResult Result = FCampaignJSONStreamReader::ReadFromString(JSONString, CampaignData, LastValidationResult);
+
+    return FinishCampaignLoad(TEXT("<string>"), Result, CampaignData, bValidateData);
+}
+
+FJSONValidationResult UCampaignJSONLoader::ValidateJSONCampaign(const FString& JSONString)
+{
+    FCampaignPlan DiscardedCampaign;
+    FJSONValidationResult ValidationResult;
+    FCampaignJSONStreamReader::ReadFromString(JSONString, DiscardedCampaign, ValidationResult);
+
+    return ValidationResult;
+}
+
+EJSONParseResult UCampaignJSONLoader::FinishCampaignLoad(const FString& SourceName, EJSONParseResult Result, FCampaignPlan& CampaignData, bool bValidateData)
+{
+    for (const FString& Warning : LastValidationResult.Warnings)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CampaignJSONLoader: %s: %s"), *SourceName, *Warning);
+    }
+
+    // Missing data only blocks the load when validation was requested
+    if (Result == EJSONParseResult::MissingRequiredData && !bValidateData)
+    {
+        Result = EJSONParseResult::Success;
+    }
+
+    if (Result != EJSONParseResult::Success)
+    {
+        const FString ErrorMessage = LastValidationResult.Errors.Num() > 0 ? LastValidationResult.Errors[0] : TEXT("Unknown error");
+        UE_LOG(LogTemp, Error, TEXT("CampaignJSONLoader: Failed to load %s: %s"), *SourceName, *ErrorMessage);
+
+        OnCampaignLoadFailed.Broadcast(SourceName, ErrorMessage);
+        return Result;
+    }
+
+    LastLoadedCampaign = MoveTemp(CampaignData);
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignJSONLoader: Loaded %s (%s)"), *SourceName, *LastValidationResult.ValidationSummary);
+
+    OnCampaignLoadCompleted.Broadcast(LastLoadedCampaign, Result);
+    OnCampaignLoadCompletedEvent(LastLoadedCampaign, Result);
+
+    return Result;
+}
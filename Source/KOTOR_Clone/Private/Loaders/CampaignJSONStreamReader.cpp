@@ -0,0 +1,586 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Loaders/CampaignJSONStreamReader.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/JsonReader.h"
+
+namespace
+{
+    /**
+     * Recursive-descent parser over the TJsonReader token stream.
+     * Each Parse* method is entered just after its ObjectStart/ArrayStart token and
+     * returns after consuming the matching end token.
+     */
+    template <typename CharType>
+    class TCampaignStreamParser
+    {
+    public:
+        TCampaignStreamParser(TJsonReader<CharType>& InReader, FCampaignPlan& InPlan, FJSONValidationResult& InValidation,
+                              FArchive* InSourceArchive, const FCampaignJSONStreamReader::FProgressCallback& InProgress)
+            : Reader(InReader)
+            , Plan(InPlan)
+            , Validation(InValidation)
+            , SourceArchive(InSourceArchive)
+            , Progress(InProgress)
+            , bFatal(false)
+            , bCancelled(false)
+        {
+        }
+
+        EJSONParseResult Parse()
+        {
+            EJsonNotation Notation;
+            if (!Next(Notation) || Notation != EJsonNotation::ObjectStart)
+            {
+                AddError(TEXT("Campaign root must be a JSON object"));
+                return EJSONParseResult::InvalidJSON;
+            }
+
+            bool bHasConfig = false;
+            bool bHasPlanets = false;
+
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("config"))
+                {
+                    if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                    {
+                        bHasConfig = true;
+                        ParseConfig(Plan.Config);
+                    }
+                }
+                else if (Field == TEXT("planets"))
+                {
+                    if (Expect(Notation, EJsonNotation::ArrayStart, Field))
+                    {
+                        bHasPlanets = true;
+                        ParsePlanets();
+                    }
+                }
+                else if (Field == TEXT("final_boss"))
+                {
+                    if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                    {
+                        ParseBoss(Plan.FinalBoss);
+                    }
+                }
+                else if (Field == TEXT("main_quest_outline"))
+                {
+                    ReadString(Notation, Field, Plan.MainQuestOutline);
+                }
+                else if (Field == TEXT("campaign_summary"))
+                {
+                    ReadString(Notation, Field, Plan.CampaignSummary);
+                }
+                else
+                {
+                    Skip(Notation);
+                }
+
+                if (bFatal)
+                {
+                    break;
+                }
+            }
+
+            if (bCancelled)
+            {
+                AddError(TEXT("Campaign load was cancelled"));
+                return EJSONParseResult::Cancelled;
+            }
+
+            if (bFatal || Notation != EJsonNotation::ObjectEnd)
+            {
+                AddError(FString::Printf(TEXT("Invalid JSON: %s"), *Reader.GetErrorMessage()));
+                return EJSONParseResult::InvalidJSON;
+            }
+
+            if (!bHasConfig)
+            {
+                AddError(TEXT("Missing required field 'config'"));
+            }
+
+            if (!bHasPlanets)
+            {
+                AddError(TEXT("Missing required field 'planets'"));
+            }
+            else if (Plan.Planets.Num() == 0)
+            {
+                AddError(TEXT("Campaign has no planets"));
+            }
+
+            return Validation.Errors.Num() > 0 ? EJSONParseResult::MissingRequiredData : EJSONParseResult::Success;
+        }
+
+    private:
+        bool Next(EJsonNotation& OutNotation)
+        {
+            if (!Reader.ReadNext(OutNotation) || OutNotation == EJsonNotation::Error)
+            {
+                bFatal = true;
+                return false;
+            }
+            return true;
+        }
+
+        void Skip(EJsonNotation Notation)
+        {
+            if (Notation == EJsonNotation::ObjectStart)
+            {
+                bFatal |= !Reader.SkipObject();
+            }
+            else if (Notation == EJsonNotation::ArrayStart)
+            {
+                bFatal |= !Reader.SkipArray();
+            }
+        }
+
+        /** Check a field has the expected container type; mismatches are skipped with a warning */
+        bool Expect(EJsonNotation Notation, EJsonNotation Expected, const FString& Field)
+        {
+            if (Notation == Expected)
+            {
+                return true;
+            }
+
+            AddWarning(FString::Printf(TEXT("Field '%s' has an unexpected type and was ignored"), *Field));
+            Skip(Notation);
+            return false;
+        }
+
+        void ReadString(EJsonNotation Notation, const FString& Field, FString& OutValue)
+        {
+            if (Notation == EJsonNotation::String)
+            {
+                OutValue = Reader.GetValueAsString();
+            }
+            else if (Notation != EJsonNotation::Null)
+            {
+                Expect(Notation, EJsonNotation::String, Field);
+            }
+        }
+
+        void ReadNumber(EJsonNotation Notation, const FString& Field, double& OutValue)
+        {
+            if (Notation == EJsonNotation::Number)
+            {
+                OutValue = Reader.GetValueAsNumber();
+            }
+            else if (Notation != EJsonNotation::Null)
+            {
+                Expect(Notation, EJsonNotation::Number, Field);
+            }
+        }
+
+        void ReadInt(EJsonNotation Notation, const FString& Field, int32& OutValue)
+        {
+            double Value = OutValue;
+            ReadNumber(Notation, Field, Value);
+            OutValue = static_cast<int32>(Value);
+        }
+
+        void ReadFloat(EJsonNotation Notation, const FString& Field, float& OutValue)
+        {
+            double Value = OutValue;
+            ReadNumber(Notation, Field, Value);
+            OutValue = static_cast<float>(Value);
+        }
+
+        void ReadBool(EJsonNotation Notation, const FString& Field, bool& bOutValue)
+        {
+            if (Notation == EJsonNotation::Boolean)
+            {
+                bOutValue = Reader.GetValueAsBoolean();
+            }
+            else if (Notation != EJsonNotation::Null)
+            {
+                Expect(Notation, EJsonNotation::Boolean, Field);
+            }
+        }
+
+        void ReadStringArray(EJsonNotation Notation, const FString& Field, TArray<FString>& OutValues)
+        {
+            if (!Expect(Notation, EJsonNotation::ArrayStart, Field))
+            {
+                return;
+            }
+
+            OutValues.Reset();
+            while (Next(Notation) && Notation != EJsonNotation::ArrayEnd)
+            {
+                if (Notation == EJsonNotation::String)
+                {
+                    OutValues.Add(Reader.GetValueAsString());
+                }
+                else
+                {
+                    Skip(Notation);
+                }
+            }
+        }
+
+        void ParseConfig(FCampaignConfig& OutConfig)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("game_length_hours")) { ReadInt(Notation, Field, OutConfig.GameLengthHours); }
+                else if (Field == TEXT("estimated_planets")) { ReadInt(Notation, Field, OutConfig.EstimatedPlanets); }
+                else if (Field == TEXT("story_seed")) { ReadString(Notation, Field, OutConfig.StorySeed); }
+                else if (Field == TEXT("time_period")) { ReadString(Notation, Field, OutConfig.TimePeriod); }
+                else if (Field == TEXT("alignment_focus")) { ReadString(Notation, Field, OutConfig.AlignmentFocus); }
+                else { Skip(Notation); }
+            }
+
+            if (OutConfig.StorySeed.IsEmpty())
+            {
+                AddWarning(TEXT("Config is missing 'story_seed'"));
+            }
+        }
+
+        void ParsePlanets()
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ArrayEnd)
+            {
+                if (!Expect(Notation, EJsonNotation::ObjectStart, FString::Printf(TEXT("planets[%d]"), Plan.Planets.Num())))
+                {
+                    continue;
+                }
+
+                // Parse into a local so only one planet is ever in flight
+                FPlanetData Planet;
+                ParsePlanet(Planet);
+
+                if (bFatal)
+                {
+                    return;
+                }
+
+                if (Planet.Name.IsEmpty())
+                {
+                    AddWarning(FString::Printf(TEXT("Planet %d is missing a name"), Plan.Planets.Num()));
+                }
+
+                if (Planet.Layouts.Num() == 0)
+                {
+                    AddWarning(FString::Printf(TEXT("Planet '%s' has no layouts"), *Planet.Name));
+                }
+
+                Plan.Planets.Add(MoveTemp(Planet));
+
+                if (Progress && !ReportProgress())
+                {
+                    bCancelled = true;
+                    bFatal = true;
+                    return;
+                }
+            }
+        }
+
+        void ParsePlanet(FPlanetData& OutPlanet)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutPlanet.Name); }
+                else if (Field == TEXT("biome")) { ReadString(Notation, Field, OutPlanet.Biome); }
+                else if (Field == TEXT("climate")) { ReadString(Notation, Field, OutPlanet.Climate); }
+                else if (Field == TEXT("population")) { ReadString(Notation, Field, OutPlanet.Population); }
+                else if (Field == TEXT("government")) { ReadString(Notation, Field, OutPlanet.Government); }
+                else if (Field == TEXT("main_quest")) { ReadString(Notation, Field, OutPlanet.MainQuest); }
+                else if (Field == TEXT("difficulty_tier")) { ReadString(Notation, Field, OutPlanet.DifficultyTier); }
+                else if (Field == TEXT("planet_index")) { ReadInt(Notation, Field, OutPlanet.PlanetIndex); }
+                else if (Field == TEXT("lore_description")) { ReadString(Notation, Field, OutPlanet.LoreDescription); }
+                else if (Field == TEXT("side_quests")) { ReadStringArray(Notation, Field, OutPlanet.SideQuests); }
+                else if (Field == TEXT("layouts"))
+                {
+                    if (!Expect(Notation, EJsonNotation::ArrayStart, Field))
+                    {
+                        continue;
+                    }
+
+                    while (Next(Notation) && Notation != EJsonNotation::ArrayEnd)
+                    {
+                        if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                        {
+                            ParseLayout(OutPlanet.Layouts.AddDefaulted_GetRef());
+                        }
+                    }
+                }
+                else if (Field == TEXT("npcs"))
+                {
+                    if (!Expect(Notation, EJsonNotation::ArrayStart, Field))
+                    {
+                        continue;
+                    }
+
+                    while (Next(Notation) && Notation != EJsonNotation::ArrayEnd)
+                    {
+                        if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                        {
+                            ParseNPC(OutPlanet.NPCs.AddDefaulted_GetRef());
+                        }
+                    }
+                }
+                else if (Field == TEXT("enemies"))
+                {
+                    if (!Expect(Notation, EJsonNotation::ArrayStart, Field))
+                    {
+                        continue;
+                    }
+
+                    while (Next(Notation) && Notation != EJsonNotation::ArrayEnd)
+                    {
+                        if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                        {
+                            ParseEnemy(OutPlanet.Enemies.AddDefaulted_GetRef());
+                        }
+                    }
+                }
+                else { Skip(Notation); }
+            }
+        }
+
+        void ParseLayout(FMapLayout& OutLayout)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutLayout.Name); }
+                else if (Field == TEXT("layout_type")) { ReadString(Notation, Field, OutLayout.LayoutType); }
+                else if (Field == TEXT("description")) { ReadString(Notation, Field, OutLayout.Description); }
+                else if (Field == TEXT("estimated_time_hours")) { ReadFloat(Notation, Field, OutLayout.EstimatedTimeHours); }
+                else if (Field == TEXT("key_features")) { ReadStringArray(Notation, Field, OutLayout.KeyFeatures); }
+                else { Skip(Notation); }
+            }
+        }
+
+        void ParseNPC(FNPCData& OutNPC)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutNPC.Name); }
+                else if (Field == TEXT("species")) { ReadString(Notation, Field, OutNPC.Species); }
+                else if (Field == TEXT("faction")) { ReadString(Notation, Field, OutNPC.Faction); }
+                else if (Field == TEXT("alignment")) { ReadString(Notation, Field, OutNPC.Alignment); }
+                else if (Field == TEXT("role")) { ReadString(Notation, Field, OutNPC.Role); }
+                else if (Field == TEXT("backstory")) { ReadString(Notation, Field, OutNPC.Backstory); }
+                else if (Field == TEXT("location")) { ReadString(Notation, Field, OutNPC.Location); }
+                else if (Field == TEXT("dialogue_style")) { ReadString(Notation, Field, OutNPC.DialogueStyle); }
+                else if (Field == TEXT("likes_player")) { ReadBool(Notation, Field, OutNPC.bLikesPlayer); }
+                else if (Field == TEXT("reputation_standing")) { ReadInt(Notation, Field, OutNPC.ReputationStanding); }
+                else if (Field == TEXT("personality_traits")) { ReadStringArray(Notation, Field, OutNPC.PersonalityTraits); }
+                else if (Field == TEXT("quest"))
+                {
+                    if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                    {
+                        ParseQuest(OutNPC.Quest);
+                    }
+                }
+                else { Skip(Notation); }
+            }
+
+            if (OutNPC.Location.IsEmpty())
+            {
+                AddWarning(FString::Printf(TEXT("NPC '%s' has no location and will not be spawned"), *OutNPC.Name));
+            }
+        }
+
+        void ParseQuest(FQuestData& OutQuest)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("title")) { ReadString(Notation, Field, OutQuest.Title); }
+                else if (Field == TEXT("description")) { ReadString(Notation, Field, OutQuest.Description); }
+                else if (Field == TEXT("quest_type")) { ReadString(Notation, Field, OutQuest.QuestType); }
+                else if (Field == TEXT("reward_type")) { ReadString(Notation, Field, OutQuest.RewardType); }
+                else if (Field == TEXT("difficulty")) { ReadString(Notation, Field, OutQuest.Difficulty); }
+                else if (Field == TEXT("estimated_time_minutes")) { ReadInt(Notation, Field, OutQuest.EstimatedTimeMinutes); }
+                else { Skip(Notation); }
+            }
+        }
+
+        void ParseEnemy(FCampaignEnemyData& OutEnemy)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutEnemy.Name); }
+                else if (Field == TEXT("species")) { ReadString(Notation, Field, OutEnemy.Species); }
+                else if (Field == TEXT("faction")) { ReadString(Notation, Field, OutEnemy.Faction); }
+                else if (Field == TEXT("description")) { ReadString(Notation, Field, OutEnemy.Description); }
+                else if (Field == TEXT("hit_points")) { ReadInt(Notation, Field, OutEnemy.HitPoints); }
+                else if (Field == TEXT("armor_class")) { ReadInt(Notation, Field, OutEnemy.ArmorClass); }
+                else if (Field == TEXT("cr_rating")) { ReadFloat(Notation, Field, OutEnemy.ChallengeRating); }
+                else if (Field == TEXT("abilities")) { ReadStringArray(Notation, Field, OutEnemy.Abilities); }
+                else if (Field == TEXT("loot_table")) { ReadStringArray(Notation, Field, OutEnemy.LootTable); }
+                else if (Field == TEXT("biome_preference")) { ReadStringArray(Notation, Field, OutEnemy.BiomePreference); }
+                else { Skip(Notation); }
+            }
+        }
+
+        void ParseBoss(FBossData& OutBoss)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutBoss.Name); }
+                else if (Field == TEXT("title")) { ReadString(Notation, Field, OutBoss.Title); }
+                else if (Field == TEXT("species")) { ReadString(Notation, Field, OutBoss.Species); }
+                else if (Field == TEXT("motivation")) { ReadString(Notation, Field, OutBoss.Motivation); }
+                else if (Field == TEXT("backstory")) { ReadString(Notation, Field, OutBoss.Backstory); }
+                else if (Field == TEXT("arena_description")) { ReadString(Notation, Field, OutBoss.ArenaDescription); }
+                else if (Field == TEXT("challenge_rating")) { ReadFloat(Notation, Field, OutBoss.ChallengeRating); }
+                else if (Field == TEXT("hit_points")) { ReadInt(Notation, Field, OutBoss.HitPoints); }
+                else if (Field == TEXT("armor_class")) { ReadInt(Notation, Field, OutBoss.ArmorClass); }
+                else if (Field == TEXT("mechanics")) { ReadStringArray(Notation, Field, OutBoss.Mechanics); }
+                else if (Field == TEXT("special_abilities")) { ReadStringArray(Notation, Field, OutBoss.SpecialAbilities); }
+                else if (Field == TEXT("weaknesses")) { ReadStringArray(Notation, Field, OutBoss.Weaknesses); }
+                else if (Field == TEXT("minions")) { ReadStringArray(Notation, Field, OutBoss.Minions); }
+                else if (Field == TEXT("loot_drop"))
+                {
+                    if (Expect(Notation, EJsonNotation::ObjectStart, Field))
+                    {
+                        ParseLoot(OutBoss.LootDrop);
+                    }
+                }
+                else { Skip(Notation); }
+            }
+
+            if (OutBoss.Name.IsEmpty())
+            {
+                AddWarning(TEXT("Final boss is missing a name"));
+            }
+        }
+
+        void ParseLoot(FLootItem& OutItem)
+        {
+            EJsonNotation Notation;
+            while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+            {
+                const FString Field = Reader.GetIdentifier();
+
+                if (Field == TEXT("name")) { ReadString(Notation, Field, OutItem.Name); }
+                else if (Field == TEXT("rarity")) { ReadString(Notation, Field, OutItem.Rarity); }
+                else if (Field == TEXT("item_type")) { ReadString(Notation, Field, OutItem.ItemType); }
+                else if (Field == TEXT("flavor_text")) { ReadString(Notation, Field, OutItem.FlavorText); }
+                else if (Field == TEXT("faction_theme")) { ReadString(Notation, Field, OutItem.FactionTheme); }
+                else if (Field == TEXT("value_credits")) { ReadInt(Notation, Field, OutItem.ValueCredits); }
+                else if (Field == TEXT("level_requirement")) { ReadInt(Notation, Field, OutItem.LevelRequirement); }
+                else if (Field == TEXT("bonuses"))
+                {
+                    if (!Expect(Notation, EJsonNotation::ObjectStart, Field))
+                    {
+                        continue;
+                    }
+
+                    while (Next(Notation) && Notation != EJsonNotation::ObjectEnd)
+                    {
+                        if (Notation == EJsonNotation::Number)
+                        {
+                            OutItem.Bonuses.Add(Reader.GetIdentifier(), static_cast<int32>(Reader.GetValueAsNumber()));
+                        }
+                        else
+                        {
+                            Skip(Notation);
+                        }
+                    }
+                }
+                else { Skip(Notation); }
+            }
+        }
+
+        bool ReportProgress() const
+        {
+            const int64 BytesRead = SourceArchive ? SourceArchive->Tell() : 0;
+            const int64 TotalBytes = SourceArchive ? SourceArchive->TotalSize() : 0;
+            return Progress(BytesRead, TotalBytes, Plan.Planets.Num());
+        }
+
+        void AddError(const FString& Message)
+        {
+            Validation.Errors.Add(Message);
+        }
+
+        void AddWarning(const FString& Message)
+        {
+            Validation.Warnings.Add(Message);
+        }
+
+        TJsonReader<CharType>& Reader;
+        FCampaignPlan& Plan;
+        FJSONValidationResult& Validation;
+        FArchive* SourceArchive;
+        const FCampaignJSONStreamReader::FProgressCallback& Progress;
+        bool bFatal;
+        bool bCancelled;
+    };
+
+    template <typename CharType>
+    EJSONParseResult RunStreamParser(TJsonReader<CharType>& Reader, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation,
+                                     FArchive* SourceArchive, const FCampaignJSONStreamReader::FProgressCallback& Progress)
+    {
+        OutPlan = FCampaignPlan();
+        OutValidation = FJSONValidationResult();
+
+        TCampaignStreamParser<CharType> Parser(Reader, OutPlan, OutValidation, SourceArchive, Progress);
+        const EJSONParseResult Result = Parser.Parse();
+
+        OutValidation.bIsValid = (Result == EJSONParseResult::Success);
+        OutValidation.ValidationSummary = FString::Printf(TEXT("%d planets, %d errors, %d warnings"),
+            OutPlan.Planets.Num(), OutValidation.Errors.Num(), OutValidation.Warnings.Num());
+
+        return Result;
+    }
+}
+
+EJSONParseResult FCampaignJSONStreamReader::ReadFromFile(const FString& FilePath, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation,
+                                                          const FProgressCallback& Progress)
+{
+    TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!FileReader)
+    {
+        OutValidation = FJSONValidationResult();
+        OutValidation.Errors.Add(FString::Printf(TEXT("Campaign file not found: %s"), *FilePath));
+        return EJSONParseResult::FileNotFound;
+    }
+
+    // Campaign files are UTF-8; the reader pulls from the archive as it tokenizes
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::Create(FileReader.Get());
+    return RunStreamParser(*Reader, OutPlan, OutValidation, FileReader.Get(), Progress);
+}
+
+EJSONParseResult FCampaignJSONStreamReader::ReadFromBytes(TConstArrayView<uint8> FileBytes, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation,
+                                                           const FProgressCallback& Progress)
+{
+    // Same UTF-8 token stream as ReadFromFile, so progress still reports bytes consumed
+    FMemoryReaderView MemoryReader(FileBytes);
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::Create(&MemoryReader);
+    return RunStreamParser(*Reader, OutPlan, OutValidation, &MemoryReader, Progress);
+}
+
+EJSONParseResult FCampaignJSONStreamReader::ReadFromString(const FString& JSONString, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation)
+{
+    TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(JSONString);
+    return RunStreamParser(*Reader, OutPlan, OutValidation, nullptr, FProgressCallback());
+}
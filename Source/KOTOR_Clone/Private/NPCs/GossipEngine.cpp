@@ -0,0 +1,353 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCs/GossipEngine.h"
+#include "NPCs/NPCMemoryMatrixComponent.h"
+#include "NPCs/NPCMemoryStore.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    // Each retelling is one step less reliable, bottoming out at Rumor
+    EMemoryReliability Degrade(EMemoryReliability Reliability)
+    {
+        return static_cast<EMemoryReliability>(FMath::Min(static_cast<uint8>(Reliability) + 1, static_cast<uint8>(EMemoryReliability::Rumor)));
+    }
+}
+
+void FGossipEngine::Reset()
+{
+    NodeNPCs.Reset();
+    NodeByNPC.Reset();
+    Adjacency.Reset();
+    Pending.Reset();
+    Heard.Reset();
+    ListenersByRumor.Reset();
+    NextSequence = 0;
+}
+
+int32 FGossipEngine::AddNode(FAIDMId NPC)
+{
+    if (!NPC.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = NodeByNPC.Find(NPC))
+    {
+        return *Existing;
+    }
+
+    const int32 Node = NodeNPCs.Add(NPC);
+    NodeByNPC.Add(NPC, Node);
+    Adjacency.AddDefaulted();
+    return Node;
+}
+
+int32 FGossipEngine::FindNode(FAIDMId NPC) const
+{
+    const int32* Node = NodeByNPC.Find(NPC);
+    return Node ? *Node : INDEX_NONE;
+}
+
+void FGossipEngine::SetEdge(int32 FromNode, int32 ToNode, int32 Relationship, float TrustLevel, float GossipProbability)
+{
+    if (!Adjacency.IsValidIndex(FromNode) || !Adjacency.IsValidIndex(ToNode) || FromNode == ToNode)
+    {
+        return;
+    }
+
+    FGossipEdge* Edge = Adjacency[FromNode].FindByPredicate([ToNode](const FGossipEdge& Candidate)
+    {
+        return Candidate.Target == ToNode;
+    });
+
+    if (!Edge)
+    {
+        Edge = &Adjacency[FromNode].AddDefaulted_GetRef();
+        Edge->Target = ToNode;
+    }
+
+    Edge->Relationship = Relationship;
+    Edge->TrustLevel = FMath::Clamp(TrustLevel, 0.0f, 1.0f);
+    Edge->GossipProbability = FMath::Clamp(GossipProbability, 0.0f, 1.0f);
+}
+
+void FGossipEngine::SetMutualEdge(int32 NodeA, int32 NodeB, int32 Relationship, float TrustLevel, float GossipProbability)
+{
+    SetEdge(NodeA, NodeB, Relationship, TrustLevel, GossipProbability);
+    SetEdge(NodeB, NodeA, Relationship, TrustLevel, GossipProbability);
+}
+
+TConstArrayView<FGossipEdge> FGossipEngine::GetEdges(int32 Node) const
+{
+    return Adjacency.IsValidIndex(Node) ? TConstArrayView<FGossipEdge>(Adjacency[Node]) : TConstArrayView<FGossipEdge>();
+}
+
+bool FGossipEngine::SeedRumor(int32 Node, int32 Rumor, EMemoryReliability Reliability, float Time)
+{
+    if (!Adjacency.IsValidIndex(Node))
+    {
+        return false;
+    }
+
+    if (!AddHeard(Node, Rumor))
+    {
+        return false;
+    }
+
+    ScheduleRetellings(Node, Rumor, Reliability, 0, Time);
+    return true;
+}
+
+int32 FGossipEngine::Process(float CurrentTime, int32 MaxDeliveries, TFunctionRef<void(const FGossipDelivery&)> OnDelivered)
+{
+    int32 NumDelivered = 0;
+
+    while (NumDelivered < MaxDeliveries && Pending.Num() > 0 && Pending.HeapTop().Time <= CurrentTime)
+    {
+        FPendingGossip Item;
+        Pending.HeapPop(Item, EAllowShrinking::No);
+
+        // Several neighbours may have rolled the same retelling; only the first one lands
+        if (!AddHeard(Item.TargetNode, Item.Rumor))
+        {
+            continue;
+        }
+
+        FGossipDelivery Delivery;
+        Delivery.Rumor = Item.Rumor;
+        Delivery.SourceNode = Item.SourceNode;
+        Delivery.TargetNode = Item.TargetNode;
+        Delivery.Relationship = Item.Relationship;
+        Delivery.Time = Item.Time;
+        Delivery.Reliability = Item.Reliability;
+        Delivery.Hops = Item.Hops;
+        OnDelivered(Delivery);
+        ++NumDelivered;
+
+        // The callback may have retired the rumor (HasHeard is false again); then it stops here
+        if (Item.Hops < Settings.MaxHops && HasHeard(Item.TargetNode, Item.Rumor))
+        {
+            ScheduleRetellings(Item.TargetNode, Item.Rumor, Item.Reliability, Item.Hops, Item.Time);
+        }
+    }
+
+    return NumDelivered;
+}
+
+void FGossipEngine::RetireRumors(TConstArrayView<int32> Rumors)
+{
+    if (Rumors.Num() == 0)
+    {
+        return;
+    }
+
+    TSet<int32> Retired;
+    Retired.Reserve(Rumors.Num());
+    for (const int32 Rumor : Rumors)
+    {
+        Retired.Add(Rumor);
+
+        TArray<int32, TInlineAllocator<4>> Listeners;
+        if (ListenersByRumor.RemoveAndCopyValue(Rumor, Listeners))
+        {
+            for (const int32 Node : Listeners)
+            {
+                Heard.Remove(MakeKey(Node, Rumor));
+            }
+        }
+    }
+
+    // One pass over the queue for the whole batch
+    const int32 NumRemoved = Pending.RemoveAll([&Retired](const FPendingGossip& Item)
+    {
+        return Retired.Contains(Item.Rumor);
+    });
+    if (NumRemoved > 0)
+    {
+        Pending.Heapify();
+    }
+}
+
+void FGossipEngine::GetPending(TArray<FGossipDelivery>& OutPending) const
+{
+    OutPending.Reset(Pending.Num());
+    for (const FPendingGossip& Item : Pending)
+    {
+        FGossipDelivery& Delivery = OutPending.AddDefaulted_GetRef();
+        Delivery.Rumor = Item.Rumor;
+        Delivery.SourceNode = Item.SourceNode;
+        Delivery.TargetNode = Item.TargetNode;
+        Delivery.Relationship = Item.Relationship;
+        Delivery.Time = Item.Time;
+        Delivery.Reliability = Item.Reliability;
+        Delivery.Hops = Item.Hops;
+    }
+}
+
+void FGossipEngine::RestorePending(const FGossipDelivery& Delivery)
+{
+    if (!Adjacency.IsValidIndex(Delivery.SourceNode) || !Adjacency.IsValidIndex(Delivery.TargetNode))
+    {
+        return;
+    }
+
+    FPendingGossip Item;
+    Item.Time = Delivery.Time;
+    Item.Sequence = NextSequence++;
+    Item.Rumor = Delivery.Rumor;
+    Item.SourceNode = Delivery.SourceNode;
+    Item.TargetNode = Delivery.TargetNode;
+    Item.Relationship = Delivery.Relationship;
+    Item.Reliability = Delivery.Reliability;
+    Item.Hops = Delivery.Hops;
+    Pending.HeapPush(Item);
+}
+
+FGossipPropagation FGossipEngine::ToPropagation(const FGossipDelivery& Delivery, const FString& MemoryID) const
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+
+    FGossipPropagation Propagation;
+    Propagation.OriginalMemoryID = MemoryID;
+    Propagation.SourceNPC = Symbols.ToString(EAIDMSymbolKind::NPC, NodeNPCs[Delivery.SourceNode]);
+    Propagation.TargetNPC = Symbols.ToString(EAIDMSymbolKind::NPC, NodeNPCs[Delivery.TargetNode]);
+    Propagation.PropagationTime = Delivery.Time;
+    Propagation.ReliabilityDecay = 1.0f - FNPCMemoryStore::GetReliabilityWeight(Delivery.Reliability);
+    Propagation.bCompleted = true;
+    return Propagation;
+}
+
+bool FGossipEngine::AddHeard(int32 Node, int32 Rumor)
+{
+    bool bAlreadyHeard = false;
+    Heard.Add(MakeKey(Node, Rumor), &bAlreadyHeard);
+    if (!bAlreadyHeard)
+    {
+        ListenersByRumor.FindOrAdd(Rumor).Add(Node);
+    }
+    return !bAlreadyHeard;
+}
+
+void FGossipEngine::ScheduleRetellings(int32 Node, int32 Rumor, EMemoryReliability Reliability, uint8 Hops, float Time)
+{
+    const float ReliabilityWeight = FNPCMemoryStore::GetReliabilityWeight(Reliability);
+    const EMemoryReliability Retold = Degrade(Reliability);
+
+    for (const FGossipEdge& Edge : Adjacency[Node])
+    {
+        if (HasHeard(Edge.Target, Rumor))
+        {
+            continue;
+        }
+
+        // One stream per roll, so the outcome depends only on the seed and the roll's position in the run
+        const uint32 Sequence = NextSequence++;
+        FRandomStream Stream(static_cast<int32>(HashCombineFast(Settings.Seed, Sequence)));
+
+        // Trusted friends and solid facts get passed on more often
+        const float Chance = Edge.GossipProbability * (0.5f + 0.5f * Edge.TrustLevel) * ReliabilityWeight;
+        if (Stream.FRand() >= Chance)
+        {
+            continue;
+        }
+
+        FPendingGossip Item;
+        Item.Time = Time + FMath::Lerp(Settings.MaxDelay, Settings.MinDelay, Edge.TrustLevel) * Stream.FRandRange(0.5f, 1.5f);
+        Item.Sequence = Sequence;
+        Item.Rumor = Rumor;
+        Item.SourceNode = Node;
+        Item.TargetNode = Edge.Target;
+        Item.Relationship = Edge.Relationship;
+        Item.Reliability = Retold;
+        Item.Hops = static_cast<uint8>(Hops + 1);
+        Pending.HeapPush(Item);
+    }
+}
+
+namespace
+{
+    struct FGossipBenchmarkRun
+    {
+        int32 Deliveries = 0;
+        int32 Frames = 0;
+        double Seconds = 0.0;
+        uint32 Checksum = 0;
+    };
+
+    FGossipBenchmarkRun RunGossipBenchmark(int32 NumNPCs, int32 FriendsPerNPC, int32 FrameBudget, uint32 Seed)
+    {
+        FGossipEngine Engine;
+        FGossipEngineSettings Settings;
+        Settings.Seed = Seed;
+        Engine.SetSettings(Settings);
+
+        // Synthetic IDs: the benchmark must not flood the campaign symbol table
+        for (int32 Index = 0; Index < NumNPCs; ++Index)
+        {
+            Engine.AddNode(FAIDMId(Index));
+        }
+
+        FRandomStream GraphStream(static_cast<int32>(Seed));
+        for (int32 Node = 0; Node < NumNPCs; ++Node)
+        {
+            for (int32 Friend = 0; Friend < FriendsPerNPC / 2; ++Friend)
+            {
+                // Separate statements: argument evaluation order is unspecified
+                const int32 Other = GraphStream.RandRange(0, NumNPCs - 1);
+                const float TrustLevel = GraphStream.FRand();
+                const float GossipProbability = GraphStream.FRandRange(0.2f, 0.8f);
+                Engine.SetMutualEdge(Node, Other, INDEX_NONE, TrustLevel, GossipProbability);
+            }
+        }
+
+        // One percent of the town witnesses something
+        for (int32 Rumor = 0; Rumor < FMath::Max(NumNPCs / 100, 1); ++Rumor)
+        {
+            Engine.SeedRumor(GraphStream.RandRange(0, NumNPCs - 1), Rumor, EMemoryReliability::Certain, 0.0f);
+        }
+
+        FGossipBenchmarkRun Run;
+        float SimTime = 0.0f;
+        const double StartTime = FPlatformTime::Seconds();
+        while (Engine.NumPending() > 0)
+        {
+            // One simulated second per frame
+            SimTime += 1.0f;
+            Run.Deliveries += Engine.Process(SimTime, FrameBudget, [&Run](const FGossipDelivery& Delivery)
+            {
+                Run.Checksum = HashCombineFast(Run.Checksum, HashCombineFast(static_cast<uint32>(Delivery.Rumor), static_cast<uint32>(Delivery.TargetNode)));
+            });
+            ++Run.Frames;
+        }
+        Run.Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+        return Run;
+    }
+
+    void BenchmarkGossip(const TArray<FString>& Args)
+    {
+        const int32 FrameBudget = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+        const int32 FriendsPerNPC = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 2) : 8;
+        constexpr uint32 Seed = 0x6055;
+
+        // The replay splits the work across frames differently; the outcome must not depend on that
+        const int32 ReplayBudget = FMath::Max(FrameBudget / 7, 1);
+
+        for (const int32 NumNPCs : { 1000, 10000, 100000 })
+        {
+            const FGossipBenchmarkRun Run = RunGossipBenchmark(NumNPCs, FriendsPerNPC, FrameBudget, Seed);
+            const FGossipBenchmarkRun Replay = RunGossipBenchmark(NumNPCs, FriendsPerNPC, ReplayBudget, Seed);
+
+            UE_LOG(LogTemp, Display, TEXT("NPC.BenchmarkGossip: %d NPCs, %d propagations over %d frames, %.0f propagations/s, replay at budget %d over %d frames %s"),
+                   NumNPCs, Run.Deliveries, Run.Frames, Run.Deliveries / Run.Seconds, ReplayBudget, Replay.Frames,
+                   Run.Checksum == Replay.Checksum && Run.Deliveries == Replay.Deliveries ? TEXT("MATCH") : TEXT("MISMATCH"));
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkGossipCommand(
+        TEXT("NPC.BenchmarkGossip"),
+        TEXT("Spread rumors through synthetic towns of 1k, 10k and 100k NPCs and report propagations/s. Usage: NPC.BenchmarkGossip [FrameBudget=1000] [FriendsPerNPC=8]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkGossip));
+}
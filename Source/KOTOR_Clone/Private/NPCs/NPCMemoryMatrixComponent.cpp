@@ -0,0 +1,819 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCs/NPCMemoryMatrixComponent.h"
+#include "AIDM/CampaignLoaderSubsystem.h"
+#include "AIDM/SaveGameContainer.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/Guid.h"
+#include "TimerManager.h"
+
+namespace
+{
+    // Seconds between sweeps of expired memories; each sweep only touches the buckets that are due
+    constexpr float MemoryDecayInterval = 10.0f;
+
+    // Memories listed in a dialogue context, newest first
+    constexpr int32 MaxContextMemories = 5;
+
+    constexpr uint32 NPCMemoryChunkVersion = 1;
+
+    struct FSavedNPCMemory
+    {
+        FString NPCID;
+        FNPCMemoryEntry Entry;
+    };
+
+    struct FSavedGossip
+    {
+        FString MemoryID;
+        FString SourceNPC;
+        FString TargetNPC;
+        int32 Relationship = INDEX_NONE;
+        float Time = 0.0f;
+        EMemoryReliability Reliability = EMemoryReliability::Rumor;
+        uint8 Hops = 0;
+    };
+
+    // Friends and family pass things on; enemies rarely talk
+    float GossipProbabilityFor(const FString& RelationshipType)
+    {
+        if (RelationshipType == TEXT("friend") || RelationshipType == TEXT("family")) return 0.6f;
+        if (RelationshipType == TEXT("colleague")) return 0.4f;
+        if (RelationshipType == TEXT("enemy") || RelationshipType == TEXT("rival")) return 0.1f;
+        return 0.3f;
+    }
+
+    const TCHAR* DescribeOpinion(float Opinion)
+    {
+        if (Opinion <= -0.6f) return TEXT("hates");
+        if (Opinion <= -0.2f) return TEXT("distrusts");
+        if (Opinion < 0.2f) return TEXT("is indifferent to");
+        if (Opinion < 0.6f) return TEXT("likes");
+        return TEXT("admires");
+    }
+}
+
+UNPCMemoryMatrixComponent::UNPCMemoryMatrixComponent()
+{
+    // Gossip and decay run on timers with a fixed work budget, not per frame
+    PrimaryComponentTick.bCanEverTick = false;
+
+    bGossipPropagationEnabled = true;
+    GossipPropagationInterval = 1.0f;
+    MaxGossipDeliveriesPerTick = 64;
+    GossipSeed = 0;
+    MemoryDecayRate = 0.01f;
+    MaxMemoriesPerNPC = 50;
+
+    NarrativeMemoryRef = nullptr;
+    FactionSystemRef = nullptr;
+}
+
+void UNPCMemoryMatrixComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    FAIDMSymbolTable::Get().OnReset().AddUObject(this, &UNPCMemoryMatrixComponent::HandleSymbolsReset);
+
+    RebuildGossipGraph();
+    RestartTimers();
+
+    UE_LOG(LogTemp, Log, TEXT("NPCMemoryMatrixComponent: Initialized"));
+}
+
+void UNPCMemoryMatrixComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(GossipTimer);
+        World->GetTimerManager().ClearTimer(MemoryDecayTimer);
+    }
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UNPCMemoryMatrixComponent::OnNarrativeMemoryAdded);
+    }
+
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->OnPlayerReputationChanged.RemoveDynamic(this, &UNPCMemoryMatrixComponent::OnPlayerReputationChanged);
+    }
+
+    FAIDMSymbolTable::Get().OnReset().RemoveAll(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UNPCMemoryMatrixComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void UNPCMemoryMatrixComponent::InitializeMemoryMatrix(UNarrativeMemoryComponent* NarrativeMemory,
+                                                       UFactionDiplomacySystem* FactionSystem)
+{
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UNPCMemoryMatrixComponent::OnNarrativeMemoryAdded);
+    }
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->OnPlayerReputationChanged.RemoveDynamic(this, &UNPCMemoryMatrixComponent::OnPlayerReputationChanged);
+    }
+
+    NarrativeMemoryRef = NarrativeMemory;
+    FactionSystemRef = FactionSystem;
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.AddDynamic(this, &UNPCMemoryMatrixComponent::OnNarrativeMemoryAdded);
+    }
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->OnPlayerReputationChanged.AddDynamic(this, &UNPCMemoryMatrixComponent::OnPlayerReputationChanged);
+    }
+
+    RebuildGossipGraph();
+    RestartTimers();
+}
+
+void UNPCMemoryMatrixComponent::AddNPCMemory(const FString& NPCID, const FNPCMemoryEntry& Memory)
+{
+    const FAIDMId Owner = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::NPC, NPCID);
+    if (!Owner.IsValid())
+    {
+        return;
+    }
+
+    FNPCMemoryEntry Entry = Memory;
+    if (Entry.MemoryID.IsEmpty())
+    {
+        Entry.MemoryID = GenerateMemoryID();
+    }
+    if (Entry.Timestamp <= 0.0f)
+    {
+        Entry.Timestamp = GetMemoryTime();
+    }
+
+    const int32 Handle = MemoryStore.Add(Owner, Entry);
+    Entry.MemorySymbol = MemoryStore.Get(Handle).Memory;
+    SaveRevision.MarkChanged();
+
+    // First-hand knowledge starts a rumor; hearsay only spreads along the rumor it came from
+    const int32 Node = GossipEngine.AddNode(Owner);
+    if (bGossipPropagationEnabled && Entry.MemoryType != ENPCMemoryType::Gossip)
+    {
+        GossipEngine.SeedRumor(Node, Entry.MemorySymbol.Index, Entry.Reliability, Entry.Timestamp);
+    }
+    else
+    {
+        GossipEngine.MarkHeard(Node, Entry.MemorySymbol.Index);
+    }
+
+    // After seeding, so a memory trimmed straight away also retires its rumor
+    TrimOldMemories(NPCID);
+
+    OnNPCMemoryAdded.Broadcast(NPCID, Entry);
+    OnNPCMemoryAddedEvent(NPCID, Entry);
+
+    const FString Reaction = GenerateCustomNPCReaction(NPCID, Entry);
+    if (!Reaction.IsEmpty())
+    {
+        OnNPCReactionTriggered.Broadcast(NPCID, Reaction);
+    }
+}
+
+void UNPCMemoryMatrixComponent::RecordPlayerInteraction(const FString& NPCID, const FString& InteractionType,
+                                                        const FString& Context, float EmotionalWeight)
+{
+    const FAIDMId Owner = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID);
+
+    FNPCMemoryEntry Entry;
+    Entry.MemoryType = MemoryStore.GetMemoriesAbout(Owner, FNPCMemoryStore::PlayerSubject).Num() == 0
+        ? ENPCMemoryType::FirstImpression
+        : ENPCMemoryType::DirectInteraction;
+    Entry.Subject = FNPCMemoryStore::PlayerSubject;
+    Entry.Event = InteractionType;
+    Entry.Context = Context;
+    Entry.Reliability = EMemoryReliability::Certain;
+    Entry.EmotionalWeight = FMath::Clamp(EmotionalWeight, -1.0f, 1.0f);
+    Entry.Timestamp = GetMemoryTime();
+    Entry.DecayRate = MemoryDecayRate;
+
+    AddNPCMemory(NPCID, Entry);
+}
+
+bool UNPCMemoryMatrixComponent::PropagateGossip(const FString& SourceNPC, const FString& TargetNPC, const FString& MemoryID)
+{
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FAIDMId SourceSymbol = Symbols.Find(EAIDMSymbolKind::NPC, SourceNPC);
+    const FAIDMId MemorySymbol = Symbols.Find(EAIDMSymbolKind::Memory, MemoryID);
+    const int32 SourceHandle = FindNPCMemory(SourceSymbol, MemorySymbol);
+    if (SourceHandle == INDEX_NONE || SourceNPC == TargetNPC)
+    {
+        return false;
+    }
+
+    const int32 SourceNode = GossipEngine.AddNode(SourceSymbol);
+    const int32 TargetNode = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, TargetNPC));
+    const float Now = GetMemoryTime();
+    const EMemoryReliability Retold = static_cast<EMemoryReliability>(FMath::Min(
+        static_cast<int32>(FNPCMemoryStore::GetEffectiveReliability(MemoryStore.Get(SourceHandle), Now)) + 1,
+        static_cast<int32>(EMemoryReliability::Rumor)));
+
+    // Marks the target as having heard it and lets them pass it on in turn
+    if (!GossipEngine.SeedRumor(TargetNode, MemorySymbol.Index, Retold, Now))
+    {
+        return false;
+    }
+    SaveRevision.MarkChanged();
+
+    FGossipDelivery Delivery;
+    Delivery.Rumor = MemorySymbol.Index;
+    Delivery.SourceNode = SourceNode;
+    Delivery.TargetNode = TargetNode;
+    Delivery.Time = Now;
+    Delivery.Reliability = Retold;
+    Delivery.Hops = 1;
+    if (const FSocialRelationship* Relationship = FindSocialRelationship(SourceNPC, TargetNPC))
+    {
+        Delivery.Relationship = static_cast<int32>(Relationship - SocialRelationships.GetData());
+    }
+
+    OnGossipDelivered(Delivery);
+    return true;
+}
+
+void UNPCMemoryMatrixComponent::AddSocialRelationship(const FString& NPCID, const FString& RelatedNPCID,
+                                                      const FString& RelationshipType, float TrustLevel)
+{
+    if (NPCID.IsEmpty() || RelatedNPCID.IsEmpty() || NPCID == RelatedNPCID)
+    {
+        return;
+    }
+
+    FSocialRelationship* Relationship = FindSocialRelationship(NPCID, RelatedNPCID);
+    if (!Relationship)
+    {
+        Relationship = &SocialRelationships.AddDefaulted_GetRef();
+        Relationship->NPCID = NPCID;
+        Relationship->RelatedNPCID = RelatedNPCID;
+    }
+
+    Relationship->RelationshipType = RelationshipType;
+    Relationship->TrustLevel = FMath::Clamp(TrustLevel, 0.0f, 1.0f);
+    Relationship->GossipProbability = GossipProbabilityFor(RelationshipType);
+    Relationship->LastInteraction = GetMemoryTime();
+
+    // Incremental: only this pair's edges change
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const int32 NodeA = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, NPCID));
+    const int32 NodeB = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, RelatedNPCID));
+    GossipEngine.SetMutualEdge(NodeA, NodeB, static_cast<int32>(Relationship - SocialRelationships.GetData()),
+                               Relationship->TrustLevel, Relationship->GossipProbability);
+}
+
+TArray<FNPCMemoryEntry> UNPCMemoryMatrixComponent::GetNPCMemoriesAbout(const FString& NPCID, const FString& Subject) const
+{
+    const FAIDMId Owner = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID);
+    const TConstArrayView<int32> Handles = MemoryStore.GetMemoriesAbout(Owner, Subject);
+    const float Now = GetMemoryTime();
+
+    TArray<FNPCMemoryEntry> Result;
+    Result.Reserve(Handles.Num());
+    for (const int32 Handle : Handles)
+    {
+        Result.Add(MemoryStore.ToEntry(Handle, Now));
+    }
+    return Result;
+}
+
+FNPCMemoryEntry UNPCMemoryMatrixComponent::GetNPCFirstImpression(const FString& NPCID) const
+{
+    const FAIDMId Owner = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID);
+    const TConstArrayView<int32> Handles = MemoryStore.GetMemoriesAbout(Owner, FNPCMemoryStore::PlayerSubject);
+
+    // The earliest first impression wins; if it was trimmed or never recorded, the oldest surviving memory of the player stands in
+    int32 Oldest = INDEX_NONE;
+    int32 OldestImpression = INDEX_NONE;
+    for (const int32 Handle : Handles)
+    {
+        const FNPCMemoryRecord& Record = MemoryStore.Get(Handle);
+        if (Oldest == INDEX_NONE || Record.Sequence < MemoryStore.Get(Oldest).Sequence)
+        {
+            Oldest = Handle;
+        }
+        if (Record.Type == ENPCMemoryType::FirstImpression
+            && (OldestImpression == INDEX_NONE || Record.Sequence < MemoryStore.Get(OldestImpression).Sequence))
+        {
+            OldestImpression = Handle;
+        }
+    }
+
+    const int32 Chosen = OldestImpression != INDEX_NONE ? OldestImpression : Oldest;
+    return Chosen != INDEX_NONE ? MemoryStore.ToEntry(Chosen, GetMemoryTime()) : FNPCMemoryEntry();
+}
+
+float UNPCMemoryMatrixComponent::GetNPCOpinionOfPlayer(const FString& NPCID) const
+{
+    return MemoryStore.GetOpinionOfPlayer(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID), GetMemoryTime());
+}
+
+TArray<FSocialRelationship> UNPCMemoryMatrixComponent::GetNPCSocialRelationships(const FString& NPCID) const
+{
+    return SocialRelationships.FilterByPredicate([&NPCID](const FSocialRelationship& Relationship)
+    {
+        return Relationship.NPCID == NPCID || Relationship.RelatedNPCID == NPCID;
+    });
+}
+
+bool UNPCMemoryMatrixComponent::DoesNPCKnowAbout(const FString& NPCID, const FString& Event) const
+{
+    return MemoryStore.KnowsAbout(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID), Event);
+}
+
+FString UNPCMemoryMatrixComponent::GenerateDialogueContext(const FString& NPCID) const
+{
+    TArray<int32> Handles;
+    MemoryStore.GetMemoriesOldestFirst(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID), Handles);
+    const float Opinion = GetNPCOpinionOfPlayer(NPCID);
+
+    FString Context = FString::Printf(TEXT("%s %s the player (opinion %.2f)."), *NPCID, DescribeOpinion(Opinion), Opinion);
+
+    const FNPCMemoryEntry FirstImpression = GetNPCFirstImpression(NPCID);
+    if (!FirstImpression.Event.IsEmpty())
+    {
+        Context += FString::Printf(TEXT("\nFirst impression: %s"), *FirstImpression.Event);
+        if (!FirstImpression.Context.IsEmpty())
+        {
+            Context += FString::Printf(TEXT(" (%s)"), *FirstImpression.Context);
+        }
+    }
+
+    if (Handles.Num() > 0)
+    {
+        Context += TEXT("\nRecent memories:");
+        const float Now = GetMemoryTime();
+        const int32 First = FMath::Max(Handles.Num() - MaxContextMemories, 0);
+        for (int32 Index = Handles.Num() - 1; Index >= First; --Index)
+        {
+            const FNPCMemoryEntry Entry = MemoryStore.ToEntry(Handles[Index], Now);
+            const UEnum* ReliabilityEnum = StaticEnum<EMemoryReliability>();
+            const FString Reliability = ReliabilityEnum ? ReliabilityEnum->GetDisplayNameTextByValue(static_cast<int64>(Entry.Reliability)).ToString() : FString();
+
+            Context += FString::Printf(TEXT("\n- %s: %s [%s]"), *Entry.Subject, *Entry.Event, *Reliability);
+            if (Entry.MemoryType == ENPCMemoryType::Gossip && !Entry.Source.IsEmpty())
+            {
+                Context += FString::Printf(TEXT(" (heard from %s)"), *Entry.Source);
+            }
+        }
+    }
+
+    const TArray<FSocialRelationship> Relationships = GetNPCSocialRelationships(NPCID);
+    if (Relationships.Num() > 0)
+    {
+        Context += TEXT("\nKnows:");
+        for (const FSocialRelationship& Relationship : Relationships)
+        {
+            const FString& Other = Relationship.NPCID == NPCID ? Relationship.RelatedNPCID : Relationship.NPCID;
+            Context += FString::Printf(TEXT(" %s (%s)"), *Other, *Relationship.RelationshipType);
+        }
+    }
+
+    return Context;
+}
+
+void UNPCMemoryMatrixComponent::TriggerAutomaticGossipPropagation()
+{
+    ProcessPendingGossip();
+}
+
+void UNPCMemoryMatrixComponent::SetGossipPropagationEnabled(bool bEnabled)
+{
+    bGossipPropagationEnabled = bEnabled;
+    RestartTimers();
+}
+
+void UNPCMemoryMatrixComponent::WriteSaveChunk(FSaveGameContainer& Container) const
+{
+    if (!SaveRevision.NeedsWrite(Container, SaveContainer::NPCMemoryChunk))
+    {
+        return;
+    }
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+
+    // Owners by name, so an unchanged store encodes to the same bytes and the chunk stays clean
+    TArray<FAIDMId> Owners;
+    MemoryStore.GetOwners(Owners);
+    TArray<TPair<FString, FAIDMId>> NamedOwners;
+    NamedOwners.Reserve(Owners.Num());
+    for (const FAIDMId Owner : Owners)
+    {
+        NamedOwners.Emplace(Symbols.ToString(EAIDMSymbolKind::NPC, Owner), Owner);
+    }
+    NamedOwners.Sort([](const TPair<FString, FAIDMId>& A, const TPair<FString, FAIDMId>& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    FSaveChunkWriter Writer;
+    TArray<int32> Handles;
+    Writer.WriteVarU32(NamedOwners.Num());
+    for (const TPair<FString, FAIDMId>& Owner : NamedOwners)
+    {
+        Writer.WriteString(Owner.Key);
+
+        // Oldest first, so reloading reproduces the insertion order trimming relies on
+        MemoryStore.GetMemoriesOldestFirst(Owner.Value, Handles);
+        Writer.WriteVarU32(Handles.Num());
+        for (const int32 Handle : Handles)
+        {
+            // ToEntry decays reliability; the record keeps the value the memory was formed with
+            const FNPCMemoryRecord& Record = MemoryStore.Get(Handle);
+            const FNPCMemoryEntry Entry = MemoryStore.ToEntry(Handle, Record.Timestamp);
+            Writer.WriteString(Entry.MemoryID);
+            Writer.WriteU8(static_cast<uint8>(Entry.MemoryType));
+            Writer.WriteString(Entry.Subject);
+            Writer.WriteString(Entry.Event);
+            Writer.WriteString(Entry.Context);
+            Writer.WriteU8(static_cast<uint8>(Record.Reliability));
+            Writer.WriteF32(Entry.EmotionalWeight);
+            Writer.WriteF32(Entry.Timestamp);
+            Writer.WriteString(Entry.Source);
+            Writer.WriteStringArray(Entry.Witnesses);
+            Writer.WriteBool(Entry.bSharedWithOthers);
+            Writer.WriteF32(Entry.DecayRate);
+        }
+    }
+
+    // Who has heard what is implied by the memories themselves, so only the queue is written
+    TArray<FGossipDelivery> Pending;
+    GossipEngine.GetPending(Pending);
+
+    Writer.WriteVarU32(Pending.Num());
+    for (const FGossipDelivery& Delivery : Pending)
+    {
+        Writer.WriteString(Symbols.ToString(EAIDMSymbolKind::Memory, FAIDMId(Delivery.Rumor)));
+        Writer.WriteString(Symbols.ToString(EAIDMSymbolKind::NPC, GossipEngine.GetNPC(Delivery.SourceNode)));
+        Writer.WriteString(Symbols.ToString(EAIDMSymbolKind::NPC, GossipEngine.GetNPC(Delivery.TargetNode)));
+        Writer.WriteVarI32(Delivery.Relationship);
+        Writer.WriteF32(Delivery.Time);
+        Writer.WriteU8(static_cast<uint8>(Delivery.Reliability));
+        Writer.WriteU8(Delivery.Hops);
+    }
+
+    TArray<uint8> Payload;
+    Writer.Finalize(Payload);
+    Container.SetChunk(SaveContainer::NPCMemoryChunk, NPCMemoryChunkVersion, MoveTemp(Payload));
+    SaveRevision.MarkSynced(Container);
+}
+
+bool UNPCMemoryMatrixComponent::ReadSaveChunk(const FSaveGameContainer& Container)
+{
+    TArray<uint8> Payload;
+    if (!Container.GetChunk(SaveContainer::NPCMemoryChunk, NPCMemoryChunkVersion, Payload))
+    {
+        return false;
+    }
+
+    auto ReadReliability = [](FSaveChunkReader& Reader)
+    {
+        const uint8 Value = Reader.ReadU8();
+        return Value <= static_cast<uint8>(EMemoryReliability::Rumor) ? static_cast<EMemoryReliability>(Value) : EMemoryReliability::Rumor;
+    };
+
+    // Decode everything first; the store is only replaced by a chunk that read cleanly
+    FSaveChunkReader Reader(Payload);
+    TArray<FSavedNPCMemory> SavedMemories;
+    const int32 NumOwners = Reader.ReadCount();
+    for (int32 OwnerIndex = 0; OwnerIndex < NumOwners && !Reader.HasError(); ++OwnerIndex)
+    {
+        const FString NPCID = Reader.ReadString();
+        const int32 NumMemories = Reader.ReadCount();
+        for (int32 MemoryIndex = 0; MemoryIndex < NumMemories && !Reader.HasError(); ++MemoryIndex)
+        {
+            FSavedNPCMemory& Saved = SavedMemories.AddDefaulted_GetRef();
+            Saved.NPCID = NPCID;
+
+            FNPCMemoryEntry& Entry = Saved.Entry;
+            Entry.MemoryID = Reader.ReadString();
+            const uint8 TypeValue = Reader.ReadU8();
+            Entry.MemoryType = TypeValue <= static_cast<uint8>(ENPCMemoryType::Professional) ? static_cast<ENPCMemoryType>(TypeValue) : ENPCMemoryType::DirectInteraction;
+            Entry.Subject = Reader.ReadString();
+            Entry.Event = Reader.ReadString();
+            Entry.Context = Reader.ReadString();
+            Entry.Reliability = ReadReliability(Reader);
+            Entry.EmotionalWeight = Reader.ReadF32();
+            Entry.Timestamp = Reader.ReadF32();
+            Entry.Source = Reader.ReadString();
+            Reader.ReadStringArray(Entry.Witnesses);
+            Entry.bSharedWithOthers = Reader.ReadBool();
+            Entry.DecayRate = Reader.ReadF32();
+        }
+    }
+
+    TArray<FSavedGossip> SavedGossip;
+    SavedGossip.SetNum(Reader.ReadCount());
+    for (FSavedGossip& Gossip : SavedGossip)
+    {
+        Gossip.MemoryID = Reader.ReadString();
+        Gossip.SourceNPC = Reader.ReadString();
+        Gossip.TargetNPC = Reader.ReadString();
+        Gossip.Relationship = Reader.ReadVarI32();
+        Gossip.Time = Reader.ReadF32();
+        Gossip.Reliability = ReadReliability(Reader);
+        Gossip.Hops = Reader.ReadU8();
+    }
+
+    if (!Reader.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("NPCMemoryMatrixComponent: NPC memory save chunk is corrupt"));
+        return false;
+    }
+
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    MemoryStore.Reset();
+    RebuildGossipGraph();
+
+    // Everyone holding a memory already knows its rumor and must not hear it again
+    for (const FSavedNPCMemory& Saved : SavedMemories)
+    {
+        const FAIDMId Owner = Symbols.Intern(EAIDMSymbolKind::NPC, Saved.NPCID);
+        const int32 Handle = MemoryStore.Add(Owner, Saved.Entry);
+        GossipEngine.MarkHeard(GossipEngine.AddNode(Owner), MemoryStore.Get(Handle).Memory.Index);
+    }
+
+    for (const FSavedGossip& Gossip : SavedGossip)
+    {
+        const FAIDMId MemorySymbol = Symbols.Find(EAIDMSymbolKind::Memory, Gossip.MemoryID);
+        if (!MemorySymbol.IsValid())
+        {
+            continue;
+        }
+
+        FGossipDelivery Delivery;
+        Delivery.Rumor = MemorySymbol.Index;
+        Delivery.SourceNode = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, Gossip.SourceNPC));
+        Delivery.TargetNode = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, Gossip.TargetNPC));
+        Delivery.Relationship = SocialRelationships.IsValidIndex(Gossip.Relationship) ? Gossip.Relationship : INDEX_NONE;
+        Delivery.Time = Gossip.Time;
+        Delivery.Reliability = Gossip.Reliability;
+        Delivery.Hops = Gossip.Hops;
+        GossipEngine.RestorePending(Delivery);
+    }
+
+    // The store now matches the chunk, so an unchanged store is not re-encoded on the next save
+    SaveRevision.MarkSynced(Container);
+
+    UE_LOG(LogTemp, Log, TEXT("NPCMemoryMatrixComponent: Loaded %d memories, %d pending retellings"),
+           MemoryStore.Num(), GossipEngine.NumPending());
+    return true;
+}
+
+FString UNPCMemoryMatrixComponent::GenerateMemoryID()
+{
+    return FString::Printf(TEXT("npcmem_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+float UNPCMemoryMatrixComponent::GetMemoryTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void UNPCMemoryMatrixComponent::RestartTimers()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = World->GetTimerManager();
+    TimerManager.ClearTimer(GossipTimer);
+    if (bGossipPropagationEnabled && GossipPropagationInterval > 0.0f)
+    {
+        TimerManager.SetTimer(GossipTimer, this, &UNPCMemoryMatrixComponent::ProcessPendingGossip, GossipPropagationInterval, true);
+    }
+
+    if (!TimerManager.IsTimerActive(MemoryDecayTimer))
+    {
+        TimerManager.SetTimer(MemoryDecayTimer, this, &UNPCMemoryMatrixComponent::ProcessMemoryDecay, MemoryDecayInterval, true);
+    }
+}
+
+void UNPCMemoryMatrixComponent::HandleSymbolsReset()
+{
+    // The store only holds symbols, which are stale now; a new campaign starts with fresh memories.
+    // Saved games restore theirs through ReadSaveChunk after the campaign has loaded.
+    MemoryStore.Reset();
+    RebuildGossipGraph();
+    SaveRevision.MarkChanged();
+}
+
+void UNPCMemoryMatrixComponent::ProcessMemoryDecay()
+{
+    const int32 NumForgotten = MemoryStore.ExpireMemories(GetMemoryTime());
+    if (NumForgotten > 0)
+    {
+        RetireForgottenRumors();
+        SaveRevision.MarkChanged();
+        UE_LOG(LogTemp, Verbose, TEXT("NPCMemoryMatrixComponent: %d memories faded"), NumForgotten);
+    }
+}
+
+void UNPCMemoryMatrixComponent::ProcessPendingGossip()
+{
+    if (!bGossipPropagationEnabled)
+    {
+        return;
+    }
+
+    // Retellings that were already heard are popped without a delivery, which still changes the saved queue
+    const int32 PendingBefore = GossipEngine.NumPending();
+    const int32 NumDelivered = GossipEngine.Process(GetMemoryTime(), FMath::Max(MaxGossipDeliveriesPerTick, 1), [this](const FGossipDelivery& Delivery)
+    {
+        OnGossipDelivered(Delivery);
+    });
+    if (NumDelivered > 0 || GossipEngine.NumPending() != PendingBefore)
+    {
+        SaveRevision.MarkChanged();
+    }
+}
+
+TConstArrayView<int32> UNPCMemoryMatrixComponent::FindNPCMemories(const FString& NPCID) const
+{
+    return FindNPCMemories(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID));
+}
+
+TConstArrayView<int32> UNPCMemoryMatrixComponent::FindNPCMemories(FAIDMId NPCSymbol) const
+{
+    return MemoryStore.GetMemories(NPCSymbol);
+}
+
+int32 UNPCMemoryMatrixComponent::FindNPCMemory(FAIDMId NPCSymbol, FAIDMId MemorySymbol) const
+{
+    if (!MemorySymbol.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    // Bounded by MaxMemoriesPerNPC
+    for (const int32 Handle : MemoryStore.GetMemories(NPCSymbol))
+    {
+        if (MemoryStore.Get(Handle).Memory == MemorySymbol)
+        {
+            return Handle;
+        }
+    }
+    return INDEX_NONE;
+}
+
+FSocialRelationship* UNPCMemoryMatrixComponent::FindSocialRelationship(const FString& NPCID, const FString& RelatedNPCID)
+{
+    // Relationships are mutual, so either order matches
+    return SocialRelationships.FindByPredicate([&NPCID, &RelatedNPCID](const FSocialRelationship& Relationship)
+    {
+        return (Relationship.NPCID == NPCID && Relationship.RelatedNPCID == RelatedNPCID)
+            || (Relationship.NPCID == RelatedNPCID && Relationship.RelatedNPCID == NPCID);
+    });
+}
+
+void UNPCMemoryMatrixComponent::RebuildGossipGraph()
+{
+    GossipEngine.Reset();
+
+    FGossipEngineSettings Settings = GossipEngine.GetSettings();
+    Settings.Seed = static_cast<uint32>(GossipSeed);
+    GossipEngine.SetSettings(Settings);
+
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (int32 Index = 0; Index < SocialRelationships.Num(); ++Index)
+    {
+        const FSocialRelationship& Relationship = SocialRelationships[Index];
+        const int32 NodeA = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, Relationship.NPCID));
+        const int32 NodeB = GossipEngine.AddNode(Symbols.Intern(EAIDMSymbolKind::NPC, Relationship.RelatedNPCID));
+        GossipEngine.SetMutualEdge(NodeA, NodeB, Index, Relationship.TrustLevel, Relationship.GossipProbability);
+    }
+}
+
+void UNPCMemoryMatrixComponent::OnGossipDelivered(const FGossipDelivery& Delivery)
+{
+    // The teller retells their own copy; if it faded or was trimmed on the way, the retelling is lost
+    const FAIDMId SourceSymbol = GossipEngine.GetNPC(Delivery.SourceNode);
+    const int32 SourceHandle = FindNPCMemory(SourceSymbol, FAIDMId(Delivery.Rumor));
+    if (SourceHandle == INDEX_NONE)
+    {
+        return;
+    }
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FString SourceNPC = Symbols.ToString(EAIDMSymbolKind::NPC, SourceSymbol);
+    const FString TargetNPC = Symbols.ToString(EAIDMSymbolKind::NPC, GossipEngine.GetNPC(Delivery.TargetNode));
+
+    // Hearsay keeps the original's MemoryID, so everyone who knows the story shares it
+    FNPCMemoryEntry Entry = MemoryStore.ToEntry(SourceHandle, Delivery.Time);
+    Entry.MemoryType = ENPCMemoryType::Gossip;
+    Entry.Reliability = Delivery.Reliability;
+    Entry.Source = SourceNPC;
+    Entry.Timestamp = Delivery.Time;
+    Entry.Witnesses.Reset();
+    Entry.bSharedWithOthers = false;
+
+    MemoryStore.MarkShared(SourceHandle);
+
+    if (SocialRelationships.IsValidIndex(Delivery.Relationship))
+    {
+        FSocialRelationship& Relationship = SocialRelationships[Delivery.Relationship];
+        Relationship.SharedMemories.AddUnique(Entry.MemoryID);
+        Relationship.LastInteraction = Delivery.Time;
+    }
+
+    const FGossipPropagation Propagation = GossipEngine.ToPropagation(Delivery, Entry.MemoryID);
+    AddNPCMemory(TargetNPC, Entry);
+
+    OnGossipPropagated.Broadcast(Propagation);
+    OnGossipPropagatedEvent(Propagation);
+}
+
+void UNPCMemoryMatrixComponent::TrimOldMemories(const FString& NPCID)
+{
+    if (MemoryStore.TrimOwner(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::NPC, NPCID), MaxMemoriesPerNPC) > 0)
+    {
+        RetireForgottenRumors();
+    }
+}
+
+void UNPCMemoryMatrixComponent::RetireForgottenRumors()
+{
+    TArray<FAIDMId> Forgotten;
+    MemoryStore.TakeForgottenMemories(Forgotten);
+
+    TArray<int32> Rumors;
+    Rumors.Reserve(Forgotten.Num());
+    for (const FAIDMId Memory : Forgotten)
+    {
+        Rumors.Add(Memory.Index);
+    }
+    GossipEngine.RetireRumors(Rumors);
+}
+
+void UNPCMemoryMatrixComponent::OnNarrativeMemoryAdded(const FNarrativeMemory& Memory)
+{
+    // Everyone present saw what the player did; each of them starts their own rumor
+    for (const FString& Participant : Memory.ParticipantNPCs)
+    {
+        FNPCMemoryEntry Entry;
+        Entry.MemoryType = ENPCMemoryType::Witnessed;
+        Entry.Subject = FNPCMemoryStore::PlayerSubject;
+        Entry.Event = Memory.Title;
+        Entry.Context = Memory.Description;
+        Entry.Reliability = EMemoryReliability::Certain;
+        Entry.EmotionalWeight = FMath::Clamp(Memory.AlignmentImpact, -1.0f, 1.0f);
+        Entry.Timestamp = GetMemoryTime();
+        Entry.DecayRate = MemoryDecayRate;
+        for (const FString& Other : Memory.ParticipantNPCs)
+        {
+            if (Other != Participant)
+            {
+                Entry.Witnesses.Add(Other);
+            }
+        }
+
+        AddNPCMemory(Participant, Entry);
+    }
+}
+
+void UNPCMemoryMatrixComponent::OnPlayerReputationChanged(const FString& FactionID, int32 NewReputation)
+{
+    const UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    const UCampaignLoaderSubsystem* CampaignLoader = GameInstance ? GameInstance->GetSubsystem<UCampaignLoaderSubsystem>() : nullptr;
+    if (!CampaignLoader)
+    {
+        return;
+    }
+
+    // Members of the faction hear of the player's standing second-hand
+    for (const FPlanetData& Planet : CampaignLoader->GetCurrentCampaign().Planets)
+    {
+        for (const FNPCData& NPC : Planet.NPCs)
+        {
+            if (NPC.Faction != FactionID)
+            {
+                continue;
+            }
+
+            FNPCMemoryEntry Entry;
+            Entry.MemoryType = ENPCMemoryType::Reputation;
+            Entry.Subject = FNPCMemoryStore::PlayerSubject;
+            Entry.Event = FString::Printf(TEXT("Standing with %s"), *FactionID);
+            Entry.Reliability = EMemoryReliability::Likely;
+            Entry.EmotionalWeight = FMath::Clamp(NewReputation / 100.0f, -1.0f, 1.0f);
+            Entry.Timestamp = GetMemoryTime();
+            Entry.DecayRate = MemoryDecayRate;
+            AddNPCMemory(NPC.Name, Entry);
+        }
+    }
+}
@@ -0,0 +1,431 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCs/NPCMemoryStore.h"
+#include "NPCs/NPCMemoryMatrixComponent.h"
+
+const TCHAR* const FNPCMemoryStore::PlayerSubject = TEXT("Player");
+
+void FNPCMemoryStore::Reset()
+{
+    Records.Reset();
+    Witnesses.Reset();
+    ByOwner.Reset();
+    ByOwnerSubject.Reset();
+    EventCounts.Reset();
+    Opinions.Reset();
+    NextOpinionSerial = 0;
+    NextSequence = 0;
+    CopyCounts.Reset();
+    ForgottenMemories.Reset();
+    DecayBuckets.Reset();
+    PlayerSubjectIndex = INDEX_NONE;
+    Strings.Reset();
+    StringLookup.Reset();
+}
+
+int32 FNPCMemoryStore::Add(FAIDMId Owner, const FNPCMemoryEntry& Entry)
+{
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+
+    FNPCMemoryRecord Record;
+    Record.Owner = Owner;
+    Record.Memory = Symbols.Intern(EAIDMSymbolKind::Memory, Entry.MemoryID);
+    Record.Source = Symbols.Intern(EAIDMSymbolKind::NPC, Entry.Source);
+    Record.Subject = InternString(Entry.Subject);
+    Record.Event = InternString(Entry.Event);
+    Record.Context = InternString(Entry.Context);
+    Record.Timestamp = Entry.Timestamp;
+    Record.EmotionalWeight = Entry.EmotionalWeight;
+    Record.DecayRate = Entry.DecayRate;
+    Record.Type = Entry.MemoryType;
+    Record.Reliability = Entry.Reliability;
+    Record.Sequence = NextSequence++;
+    Record.bSharedWithOthers = Entry.bSharedWithOthers;
+    Record.bHasWitnesses = Entry.Witnesses.Num() > 0;
+
+    const int32 Handle = Records.Add(Record);
+
+    if (Record.bHasWitnesses)
+    {
+        TArray<FAIDMId>& WitnessIds = Witnesses.Add(Handle);
+        WitnessIds.Reserve(Entry.Witnesses.Num());
+        for (const FString& Witness : Entry.Witnesses)
+        {
+            WitnessIds.Add(Symbols.Intern(EAIDMSymbolKind::NPC, Witness));
+        }
+    }
+
+    FNPCMemoryRecord& Stored = Records[Handle];
+    Stored.OwnerSlot = ByOwner.FindOrAdd(Owner).Add(Handle);
+    Stored.SubjectSlot = ByOwnerSubject.FindOrAdd(MakeKey(Owner, Record.Subject)).Add(Handle);
+    ++EventCounts.FindOrAdd(MakeKey(Owner, Record.Event));
+    ++CopyCounts.FindOrAdd(Record.Memory);
+    AddToOpinion(Handle);
+    DecayBuckets.Add(Handle, GetExpiryTime(Record));
+
+    return Handle;
+}
+
+void FNPCMemoryStore::Remove(int32 Handle)
+{
+    if (Records.IsValidIndex(Handle))
+    {
+        RemoveRecord(Handle, true);
+    }
+}
+
+void FNPCMemoryStore::RemoveRecord(int32 Handle, bool bFiled)
+{
+    const FNPCMemoryRecord& Record = Records[Handle];
+
+    if (bFiled)
+    {
+        DecayBuckets.Remove(Handle, GetExpiryTime(Record));
+    }
+
+    // Swap the last handle into the record's slot and patch that record's position
+    if (TArray<int32>* OwnerHandles = ByOwner.Find(Record.Owner))
+    {
+        const int32 Moved = OwnerHandles->Last();
+        (*OwnerHandles)[Record.OwnerSlot] = Moved;
+        Records[Moved].OwnerSlot = Record.OwnerSlot;
+        OwnerHandles->Pop(EAllowShrinking::No);
+        if (OwnerHandles->Num() == 0)
+        {
+            ByOwner.Remove(Record.Owner);
+        }
+    }
+
+    const uint64 SubjectKey = MakeKey(Record.Owner, Record.Subject);
+    if (FHandleList* SubjectHandles = ByOwnerSubject.Find(SubjectKey))
+    {
+        const int32 Moved = SubjectHandles->Last();
+        (*SubjectHandles)[Record.SubjectSlot] = Moved;
+        Records[Moved].SubjectSlot = Record.SubjectSlot;
+        SubjectHandles->Pop(EAllowShrinking::No);
+        if (SubjectHandles->Num() == 0)
+        {
+            ByOwnerSubject.Remove(SubjectKey);
+        }
+    }
+
+    const uint64 EventKey = MakeKey(Record.Owner, Record.Event);
+    if (int32* Count = EventCounts.Find(EventKey))
+    {
+        if (--(*Count) <= 0)
+        {
+            EventCounts.Remove(EventKey);
+        }
+    }
+
+    if (int32* Copies = CopyCounts.Find(Record.Memory))
+    {
+        if (--(*Copies) <= 0)
+        {
+            CopyCounts.Remove(Record.Memory);
+            ForgottenMemories.Add(Record.Memory);
+        }
+    }
+
+    RemoveFromOpinion(Handle);
+
+    if (Record.bHasWitnesses)
+    {
+        Witnesses.Remove(Handle);
+    }
+
+    Records.RemoveAt(Handle);
+}
+
+void FNPCMemoryStore::SetReliability(int32 Handle, EMemoryReliability NewReliability)
+{
+    FNPCMemoryRecord& Record = Records[Handle];
+    if (Record.Reliability == NewReliability)
+    {
+        return;
+    }
+
+    DecayBuckets.Remove(Handle, GetExpiryTime(Record));
+    RemoveFromOpinion(Handle);
+    Record.Reliability = NewReliability;
+    AddToOpinion(Handle);
+    DecayBuckets.Add(Handle, GetExpiryTime(Record));
+}
+
+void FNPCMemoryStore::TakeForgottenMemories(TArray<FAIDMId>& OutMemories)
+{
+    OutMemories = MoveTemp(ForgottenMemories);
+    ForgottenMemories.Reset();
+}
+
+FNPCMemoryEntry FNPCMemoryStore::ToEntry(int32 Handle, float Now) const
+{
+    FNPCMemoryEntry Entry;
+    if (!Records.IsValidIndex(Handle))
+    {
+        return Entry;
+    }
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FNPCMemoryRecord& Record = Records[Handle];
+
+    Entry.MemoryID = Symbols.ToString(EAIDMSymbolKind::Memory, Record.Memory);
+    Entry.MemorySymbol = Record.Memory;
+    Entry.MemoryType = Record.Type;
+    Entry.Subject = GetString(Record.Subject);
+    Entry.Event = GetString(Record.Event);
+    Entry.Context = GetString(Record.Context);
+    Entry.Reliability = GetEffectiveReliability(Record, Now);
+    Entry.EmotionalWeight = Record.EmotionalWeight;
+    Entry.Timestamp = Record.Timestamp;
+    Entry.Source = Symbols.ToString(EAIDMSymbolKind::NPC, Record.Source);
+    Entry.bSharedWithOthers = Record.bSharedWithOthers;
+    Entry.DecayRate = Record.DecayRate;
+
+    if (const TArray<FAIDMId>* WitnessIds = Record.bHasWitnesses ? Witnesses.Find(Handle) : nullptr)
+    {
+        Entry.Witnesses.Reserve(WitnessIds->Num());
+        for (const FAIDMId Witness : *WitnessIds)
+        {
+            Entry.Witnesses.Add(Symbols.ToString(EAIDMSymbolKind::NPC, Witness));
+        }
+    }
+
+    return Entry;
+}
+
+int32 FNPCMemoryStore::ExpireMemories(float Now)
+{
+    ExpiredScratch.Reset();
+    const int32 NumExpired = DecayBuckets.PopExpired(Now, ExpiredScratch);
+
+    for (const int32 Handle : ExpiredScratch)
+    {
+        RemoveRecord(Handle, false);
+    }
+
+    return NumExpired;
+}
+
+int32 FNPCMemoryStore::TrimOwner(FAIDMId Owner, int32 MaxMemories)
+{
+    const int32 NumToTrim = NumFor(Owner) - FMath::Max(MaxMemories, 0);
+    if (NumToTrim <= 0)
+    {
+        return 0;
+    }
+
+    // Sorted copy: the handle list is unordered and removal edits it
+    GetMemoriesOldestFirst(Owner, ExpiredScratch);
+    ExpiredScratch.SetNum(NumToTrim, EAllowShrinking::No);
+    for (const int32 Handle : ExpiredScratch)
+    {
+        RemoveRecord(Handle, true);
+    }
+
+    return NumToTrim;
+}
+
+TConstArrayView<int32> FNPCMemoryStore::GetMemories(FAIDMId Owner) const
+{
+    const TArray<int32>* Handles = ByOwner.Find(Owner);
+    return Handles ? TConstArrayView<int32>(*Handles) : TConstArrayView<int32>();
+}
+
+void FNPCMemoryStore::GetMemoriesOldestFirst(FAIDMId Owner, TArray<int32>& OutHandles) const
+{
+    const TConstArrayView<int32> Handles = GetMemories(Owner);
+    OutHandles.Reset();
+    OutHandles.Append(Handles.GetData(), Handles.Num());
+    OutHandles.Sort([this](int32 A, int32 B)
+    {
+        return Records[A].Sequence < Records[B].Sequence;
+    });
+}
+
+TConstArrayView<int32> FNPCMemoryStore::GetMemoriesAbout(FAIDMId Owner, const FString& Subject) const
+{
+    const int32 SubjectIndex = FindString(Subject);
+    const FHandleList* Handles = SubjectIndex != INDEX_NONE ? ByOwnerSubject.Find(MakeKey(Owner, SubjectIndex)) : nullptr;
+    return Handles ? TConstArrayView<int32>(*Handles) : TConstArrayView<int32>();
+}
+
+bool FNPCMemoryStore::KnowsAbout(FAIDMId Owner, const FString& Event) const
+{
+    const int32 EventIndex = FindString(Event);
+    return EventIndex != INDEX_NONE && EventCounts.Contains(MakeKey(Owner, EventIndex));
+}
+
+float FNPCMemoryStore::GetOpinionOfPlayer(FAIDMId Owner, float Now) const
+{
+    FOpinion* Opinion = Opinions.Find(Owner);
+    if (!Opinion)
+    {
+        return 0.0f;
+    }
+
+    AdvanceOpinion(*Opinion, Now);
+    if (Opinion->TotalWeight <= UE_SMALL_NUMBER)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Clamp(Opinion->WeightedSum / Opinion->TotalWeight, -1.0f, 1.0f);
+}
+
+const FString& FNPCMemoryStore::GetString(int32 StringIndex) const
+{
+    static const FString Empty;
+    return Strings.IsValidIndex(StringIndex) ? Strings[StringIndex] : Empty;
+}
+
+float FNPCMemoryStore::GetReliabilityWeight(EMemoryReliability Reliability)
+{
+    switch (Reliability)
+    {
+    case EMemoryReliability::Certain:   return 1.0f;
+    case EMemoryReliability::Confident: return 0.85f;
+    case EMemoryReliability::Likely:    return 0.7f;
+    case EMemoryReliability::Uncertain: return 0.5f;
+    case EMemoryReliability::Doubtful:  return 0.3f;
+    case EMemoryReliability::Rumor:     return 0.15f;
+    default:                            return 0.0f;
+    }
+}
+
+EMemoryReliability FNPCMemoryStore::GetEffectiveReliability(const FNPCMemoryRecord& Record, float Now)
+{
+    const int32 Level = static_cast<int32>(Record.Reliability) + MemoryDecay::GetLevelsLost(Record.Timestamp, GetDecayRate(Record), Now);
+    return static_cast<EMemoryReliability>(FMath::Min(Level, static_cast<int32>(EMemoryReliability::Rumor)));
+}
+
+float FNPCMemoryStore::GetExpiryTime(const FNPCMemoryRecord& Record)
+{
+    const int32 LevelsLeft = static_cast<int32>(EMemoryReliability::Rumor) - static_cast<int32>(Record.Reliability);
+    return MemoryDecay::GetTimeToLose(Record.Timestamp, GetDecayRate(Record), LevelsLeft + 1);
+}
+
+int32 FNPCMemoryStore::InternString(const FString& String)
+{
+    if (String.IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    if (const int32* Existing = StringLookup.Find(String))
+    {
+        return *Existing;
+    }
+
+    const int32 StringIndex = Strings.Add(String);
+    StringLookup.Add(String, StringIndex);
+
+    if (PlayerSubjectIndex == INDEX_NONE && String == PlayerSubject)
+    {
+        PlayerSubjectIndex = StringIndex;
+    }
+
+    return StringIndex;
+}
+
+int32 FNPCMemoryStore::FindString(const FString& String) const
+{
+    const int32* Existing = StringLookup.Find(String);
+    return Existing ? *Existing : INDEX_NONE;
+}
+
+void FNPCMemoryStore::AddToOpinion(int32 Handle)
+{
+    const FNPCMemoryRecord& Record = Records[Handle];
+    if (!IsAboutPlayer(Record))
+    {
+        return;
+    }
+
+    // Counted at the level it has when the sums were last brought up to date; later drops are queued
+    FOpinion& Opinion = Opinions.FindOrAdd(Record.Owner);
+    const EMemoryReliability Level = GetEffectiveReliability(Record, Opinion.AsOf);
+    const float Weight = GetReliabilityWeight(Level);
+    Opinion.WeightedSum += Weight * Record.EmotionalWeight;
+    Opinion.TotalWeight += Weight;
+
+    FCountedMemory& Counted = Opinion.Counted.Add(Handle);
+    Counted.Serial = NextOpinionSerial++;
+    Counted.Level = static_cast<uint8>(Level);
+    ScheduleOpinionStep(Opinion, Handle, Counted);
+}
+
+void FNPCMemoryStore::RemoveFromOpinion(int32 Handle)
+{
+    const FNPCMemoryRecord& Record = Records[Handle];
+    FOpinion* Opinion = IsAboutPlayer(Record) ? Opinions.Find(Record.Owner) : nullptr;
+
+    FCountedMemory Counted;
+    if (!Opinion || !Opinion->Counted.RemoveAndCopyValue(Handle, Counted))
+    {
+        return;
+    }
+
+    // Its pending step is left in the heap and discarded by serial when it surfaces
+    const float Weight = GetReliabilityWeight(static_cast<EMemoryReliability>(Counted.Level));
+    Opinion->WeightedSum -= Weight * Record.EmotionalWeight;
+    Opinion->TotalWeight -= Weight;
+
+    // Drop the entry (and any float drift) once the last memory about the player is gone
+    if (Opinion->Counted.Num() == 0)
+    {
+        Opinions.Remove(Record.Owner);
+    }
+}
+
+void FNPCMemoryStore::ScheduleOpinionStep(FOpinion& Opinion, int32 Handle, const FCountedMemory& Counted) const
+{
+    // Past Rumor the memory is forgotten, which ExpireMemories handles
+    if (Counted.Level >= static_cast<uint8>(EMemoryReliability::Rumor))
+    {
+        return;
+    }
+
+    const FNPCMemoryRecord& Record = Records[Handle];
+    const int32 LevelsLost = Counted.Level + 1 - static_cast<int32>(Record.Reliability);
+    const float StepTime = MemoryDecay::GetTimeToLose(Record.Timestamp, GetDecayRate(Record), LevelsLost);
+    if (StepTime >= TNumericLimits<float>::Max())
+    {
+        return;
+    }
+
+    FOpinionStep Step;
+    Step.Time = StepTime;
+    Step.Handle = Handle;
+    Step.Serial = Counted.Serial;
+    Step.ToLevel = Counted.Level + 1;
+    Opinion.Steps.HeapPush(Step);
+}
+
+void FNPCMemoryStore::AdvanceOpinion(FOpinion& Opinion, float Now) const
+{
+    while (Opinion.Steps.Num() > 0 && Opinion.Steps.HeapTop().Time <= Now)
+    {
+        FOpinionStep Step;
+        Opinion.Steps.HeapPop(Step, EAllowShrinking::No);
+
+        // Stale: the memory was removed, re-counted, or already moved past this level
+        FCountedMemory* Counted = Opinion.Counted.Find(Step.Handle);
+        if (!Counted || Counted->Serial != Step.Serial || Counted->Level >= Step.ToLevel)
+        {
+            continue;
+        }
+
+        const FNPCMemoryRecord& Record = Records[Step.Handle];
+        const float OldWeight = GetReliabilityWeight(static_cast<EMemoryReliability>(Counted->Level));
+        const float NewWeight = GetReliabilityWeight(static_cast<EMemoryReliability>(Step.ToLevel));
+        Opinion.WeightedSum += (NewWeight - OldWeight) * Record.EmotionalWeight;
+        Opinion.TotalWeight += NewWeight - OldWeight;
+
+        Counted->Level = Step.ToLevel;
+        ScheduleOpinionStep(Opinion, Step.Handle, *Counted);
+    }
+
+    // Reading at an earlier time (e.g. a rewound clock) keeps the already decayed sums
+    Opinion.AsOf = FMath::Max(Opinion.AsOf, Now);
+}
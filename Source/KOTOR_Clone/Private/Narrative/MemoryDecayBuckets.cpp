@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Narrative/MemoryDecayBuckets.h"
+
+void FMemoryDecayBuckets::Reset()
+{
+    Buckets.Reset();
+    BucketKeys.Reset();
+    Positions.Reset();
+    NumHandles = 0;
+}
+
+int32 FMemoryDecayBuckets::GetBucket(float Time) const
+{
+    // Clamped so far-future expiries share the last bucket instead of overflowing
+    return FMath::FloorToInt32(FMath::Clamp(Time / BucketSeconds, -1.0e9f, 1.0e9f));
+}
+
+void FMemoryDecayBuckets::Add(int32 Handle, float ExpiryTime)
+{
+    if (NeverExpires(ExpiryTime))
+    {
+        return;
+    }
+
+    const int32 Key = GetBucket(ExpiryTime);
+    TArray<int32>* Bucket = Buckets.Find(Key);
+    if (!Bucket)
+    {
+        Bucket = &Buckets.Add(Key);
+        BucketKeys.HeapPush(Key);
+    }
+
+    while (Positions.Num() <= Handle)
+    {
+        Positions.Add(INDEX_NONE);
+    }
+
+    Positions[Handle] = Bucket->Add(Handle);
+    ++NumHandles;
+}
+
+void FMemoryDecayBuckets::Remove(int32 Handle, float ExpiryTime)
+{
+    if (NeverExpires(ExpiryTime))
+    {
+        return;
+    }
+
+    const int32 Position = Positions.IsValidIndex(Handle) ? Positions[Handle] : INDEX_NONE;
+    const int32 Key = GetBucket(ExpiryTime);
+    TArray<int32>* Bucket = Buckets.Find(Key);
+    if (!Bucket || !Bucket->IsValidIndex(Position) || (*Bucket)[Position] != Handle)
+    {
+        return;
+    }
+
+    // Swap the last handle into the hole and patch its position
+    const int32 Moved = Bucket->Last();
+    (*Bucket)[Position] = Moved;
+    Positions[Moved] = Position;
+    Bucket->Pop(EAllowShrinking::No);
+    Positions[Handle] = INDEX_NONE;
+    --NumHandles;
+
+    // The heap key stays behind and is skipped when it surfaces
+    if (Bucket->Num() == 0)
+    {
+        Buckets.Remove(Key);
+    }
+}
+
+void FMemoryDecayBuckets::ClearPositions(TConstArrayView<int32> Handles)
+{
+    for (const int32 Handle : Handles)
+    {
+        Positions[Handle] = INDEX_NONE;
+    }
+}
+
+void FMemoryDecayBuckets::SkipEmptyBuckets()
+{
+    while (BucketKeys.Num() > 0 && !Buckets.Contains(BucketKeys.HeapTop()))
+    {
+        BucketKeys.HeapPopDiscard(EAllowShrinking::No);
+    }
+}
+
+int32 FMemoryDecayBuckets::PopExpired(float Now, TArray<int32>& OutHandles)
+{
+    const int32 StartNum = OutHandles.Num();
+
+    for (SkipEmptyBuckets(); BucketKeys.Num() > 0; SkipEmptyBuckets())
+    {
+        // A bucket has ended once its upper bound has passed
+        const int32 Key = BucketKeys.HeapTop();
+        if ((static_cast<double>(Key) + 1.0) * BucketSeconds > Now)
+        {
+            break;
+        }
+
+        BucketKeys.HeapPopDiscard(EAllowShrinking::No);
+
+        TArray<int32> Bucket;
+        Buckets.RemoveAndCopyValue(Key, Bucket);
+        OutHandles.Append(Bucket);
+    }
+
+    const int32 NumPopped = OutHandles.Num() - StartNum;
+    ClearPositions(MakeArrayView(OutHandles).Slice(StartNum, NumPopped));
+    NumHandles -= NumPopped;
+    return NumPopped;
+}
+
+int32 FMemoryDecayBuckets::PopSoonest(int32 MaxHandles, TArray<int32>& OutHandles)
+{
+    const int32 StartNum = OutHandles.Num();
+
+    for (SkipEmptyBuckets(); BucketKeys.Num() > 0 && OutHandles.Num() - StartNum < MaxHandles; SkipEmptyBuckets())
+    {
+        const int32 Key = BucketKeys.HeapTop();
+        TArray<int32>& Bucket = Buckets.FindChecked(Key);
+
+        // Take from the back so a partly trimmed bucket needs no shifting
+        const int32 NumToTake = FMath::Min(MaxHandles - (OutHandles.Num() - StartNum), Bucket.Num());
+        OutHandles.Append(Bucket.GetData() + Bucket.Num() - NumToTake, NumToTake);
+        Bucket.SetNum(Bucket.Num() - NumToTake, EAllowShrinking::No);
+
+        if (Bucket.Num() == 0)
+        {
+            Buckets.Remove(Key);
+            BucketKeys.HeapPopDiscard(EAllowShrinking::No);
+        }
+    }
+
+    const int32 NumPopped = OutHandles.Num() - StartNum;
+    ClearPositions(MakeArrayView(OutHandles).Slice(StartNum, NumPopped));
+    NumHandles -= NumPopped;
+    return NumPopped;
+}
@@ -0,0 +1,258 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Narrative/NarrativeContextAggregates.h"
+#include "Narrative/NarrativeMemoryComponent.h"
+
+namespace
+{
+    // Reputation entries listed in the summary
+    constexpr int32 MaxReputationEntries = 3;
+
+    const TCHAR* DescribeStanding(float Average)
+    {
+        if (Average >= 0.5f) return TEXT("admired");
+        if (Average >= 0.15f) return TEXT("liked");
+        if (Average > -0.15f) return TEXT("neutral");
+        if (Average > -0.5f) return TEXT("disliked");
+        return TEXT("hated");
+    }
+
+    FString DescribeCompanion(const FActiveCompanion& Companion)
+    {
+        if (!Companion.bIsAlive)
+        {
+            return TEXT("deceased");
+        }
+
+        return StaticEnum<ECompanionLoyalty>()->GetNameStringByValue(static_cast<int64>(Companion.Loyalty)).ToLower();
+    }
+}
+
+void FNarrativeContextAggregates::Reset()
+{
+    AlignmentSum = 0.0;
+    AlignmentCount = 0;
+    ReputationByNPC.Reset();
+    OverallReputation = FReputationTally();
+    CompanionStatus.Reset();
+    ActiveQuests.Reset();
+    RecentLocations.Reset();
+
+    // Versions keep counting up so consumers holding old stamps still see a change
+    for (int32 Section = 0; Section < static_cast<int32>(ENarrativeContextSection::Count); ++Section)
+    {
+        MarkDirty(static_cast<ENarrativeContextSection>(Section));
+    }
+}
+
+void FNarrativeContextAggregates::MarkDirty(ENarrativeContextSection Section)
+{
+    ++Versions[static_cast<int32>(Section)];
+    DirtySections |= 1u << static_cast<uint32>(Section);
+}
+
+void FNarrativeContextAggregates::ApplyMemory(const FNarrativeMemory& Memory, int32 Sign)
+{
+    MarkDirty(ENarrativeContextSection::Memories);
+
+    AlignmentSum += Sign * Memory.AlignmentImpact;
+    AlignmentCount += Sign;
+    MarkDirty(ENarrativeContextSection::Alignment);
+
+    if (Memory.ParticipantNPCs.Num() > 0)
+    {
+        for (const FString& NPC : Memory.ParticipantNPCs)
+        {
+            FReputationTally& Tally = ReputationByNPC.FindOrAdd(NPC);
+            Tally.Sum += Sign * Memory.EmotionalWeight;
+            Tally.Count += Sign;
+            if (Tally.Count <= 0)
+            {
+                ReputationByNPC.Remove(NPC);
+            }
+        }
+
+        OverallReputation.Sum += Sign * Memory.EmotionalWeight;
+        OverallReputation.Count += Sign;
+        MarkDirty(ENarrativeContextSection::Reputation);
+    }
+
+    // Location history is a record of where the player went; removing a memory does not undo the visit
+    if (Sign > 0 && !Memory.Location.IsEmpty())
+    {
+        const int32 Existing = RecentLocations.IndexOfByKey(Memory.Location);
+        if (Existing != 0)
+        {
+            if (Existing != INDEX_NONE)
+            {
+                RecentLocations.RemoveAt(Existing, 1, EAllowShrinking::No);
+            }
+            else if (RecentLocations.Num() == MaxRecentLocations)
+            {
+                RecentLocations.Pop(EAllowShrinking::No);
+            }
+            RecentLocations.Insert(Memory.Location, 0);
+            MarkDirty(ENarrativeContextSection::Locations);
+        }
+    }
+}
+
+void FNarrativeContextAggregates::OnQuestStarted(const FActiveQuest& Quest)
+{
+    const FString Line = Quest.QuestData.Title.IsEmpty() ? Quest.QuestID : Quest.QuestData.Title;
+
+    TPair<FString, FString>* Existing = ActiveQuests.FindByPredicate([&Quest](const TPair<FString, FString>& Entry)
+    {
+        return Entry.Key == Quest.QuestID;
+    });
+
+    if (Existing)
+    {
+        if (Existing->Value == Line)
+        {
+            return;
+        }
+        Existing->Value = Line;
+    }
+    else
+    {
+        ActiveQuests.Emplace(Quest.QuestID, Line);
+    }
+
+    MarkDirty(ENarrativeContextSection::Quests);
+}
+
+void FNarrativeContextAggregates::OnQuestEnded(const FActiveQuest& Quest)
+{
+    const int32 NumRemoved = ActiveQuests.RemoveAll([&Quest](const TPair<FString, FString>& Entry)
+    {
+        return Entry.Key == Quest.QuestID;
+    });
+
+    if (NumRemoved > 0)
+    {
+        MarkDirty(ENarrativeContextSection::Quests);
+    }
+}
+
+void FNarrativeContextAggregates::OnCompanionChanged(const FActiveCompanion& Companion)
+{
+    const FString& Name = Companion.CompanionData.Name;
+    if (Name.IsEmpty())
+    {
+        return;
+    }
+
+    FString Status = DescribeCompanion(Companion);
+    FString& Current = CompanionStatus.FindOrAdd(Name);
+    if (Current != Status)
+    {
+        Current = MoveTemp(Status);
+        MarkDirty(ENarrativeContextSection::Companions);
+    }
+}
+
+void FNarrativeContextAggregates::Refresh(FNarrativeContext& Context)
+{
+    auto IsDirty = [this](ENarrativeContextSection Section)
+    {
+        return (DirtySections & (1u << static_cast<uint32>(Section))) != 0;
+    };
+
+    if (IsDirty(ENarrativeContextSection::Alignment))
+    {
+        Context.PlayerAlignment = GetAlignmentSummary();
+    }
+
+    if (IsDirty(ENarrativeContextSection::Reputation))
+    {
+        Context.ReputationSummary = BuildReputationSummary();
+    }
+
+    if (IsDirty(ENarrativeContextSection::Companions))
+    {
+        Context.CompanionRelationships = CompanionStatus;
+    }
+
+    if (IsDirty(ENarrativeContextSection::Quests))
+    {
+        Context.ActiveQuestContext.Reset(ActiveQuests.Num());
+        for (const TPair<FString, FString>& Quest : ActiveQuests)
+        {
+            Context.ActiveQuestContext.Add(Quest.Value);
+        }
+    }
+
+    if (IsDirty(ENarrativeContextSection::Locations))
+    {
+        Context.LocationHistory = FString::Join(RecentLocations, TEXT(", "));
+    }
+
+    Context.MemoryVersion = GetVersion(ENarrativeContextSection::Memories);
+    Context.AlignmentVersion = GetVersion(ENarrativeContextSection::Alignment);
+    Context.ReputationVersion = GetVersion(ENarrativeContextSection::Reputation);
+    Context.CompanionVersion = GetVersion(ENarrativeContextSection::Companions);
+    Context.QuestVersion = GetVersion(ENarrativeContextSection::Quests);
+    Context.LocationVersion = GetVersion(ENarrativeContextSection::Locations);
+
+    DirtySections = 0;
+}
+
+FString FNarrativeContextAggregates::GetAlignmentSummary() const
+{
+    if (AlignmentCount <= 0)
+    {
+        return TEXT("neutral");
+    }
+
+    const double Average = AlignmentSum / AlignmentCount;
+    if (Average >= 0.5) return TEXT("strongly light side");
+    if (Average >= 0.15) return TEXT("leaning light side");
+    if (Average > -0.15) return TEXT("neutral");
+    if (Average > -0.5) return TEXT("leaning dark side");
+    return TEXT("strongly dark side");
+}
+
+FString FNarrativeContextAggregates::GetReputationWith(const FString& NPC) const
+{
+    const FReputationTally* Tally = ReputationByNPC.Find(NPC);
+    return Tally && Tally->Count > 0 ? FString(DescribeStanding(Tally->Sum / Tally->Count)) : FString(TEXT("unknown"));
+}
+
+FString FNarrativeContextAggregates::BuildReputationSummary() const
+{
+    if (OverallReputation.Count <= 0)
+    {
+        return TEXT("unknown");
+    }
+
+    FString Summary = FString::Printf(TEXT("generally %s"), DescribeStanding(OverallReputation.Sum / OverallReputation.Count));
+
+    // The NPCs with the strongest feelings either way; only runs when reputation changed
+    TArray<TPair<FString, float>, TInlineAllocator<MaxReputationEntries + 1>> Strongest;
+    for (const TPair<FString, FReputationTally>& Entry : ReputationByNPC)
+    {
+        const float Average = Entry.Value.Sum / Entry.Value.Count;
+        int32 Insert = Strongest.Num();
+        while (Insert > 0 && FMath::Abs(Strongest[Insert - 1].Value) < FMath::Abs(Average))
+        {
+            --Insert;
+        }
+
+        if (Insert < MaxReputationEntries)
+        {
+            Strongest.Insert(TPair<FString, float>(Entry.Key, Average), Insert);
+            if (Strongest.Num() > MaxReputationEntries)
+            {
+                Strongest.Pop(EAllowShrinking::No);
+            }
+        }
+    }
+
+    for (const TPair<FString, float>& Entry : Strongest)
+    {
+        Summary += FString::Printf(TEXT("; %s: %s"), *Entry.Key, DescribeStanding(Entry.Value));
+    }
+
+    return Summary;
+}
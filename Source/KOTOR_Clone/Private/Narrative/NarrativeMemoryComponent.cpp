@@ -0,0 +1,727 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Narrative/NarrativeMemoryComponent.h"
+#include "Narrative/NarrativeMemorySaveChunk.h"
+#include "Engine/World.h"
+#include "Algo/Unique.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    // Memories attached to a generated context
+    constexpr int32 MaxContextMemories = 10;
+
+    // Candidates pulled from each index query before relevance scoring
+    constexpr int32 MaxContextCandidates = 32;
+
+    // Recency half-life for context relevance (one in-game hour)
+    constexpr float RelevanceHalfLifeSeconds = 3600.0f;
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShareable(new FJsonValueString(String)));
+        }
+        return Values;
+    }
+
+    void FromJsonArray(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TArray<FString>& OutStrings)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (Object->TryGetArrayField(Field, Values))
+        {
+            OutStrings.Reserve(Values->Num());
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                OutStrings.Add(Value->AsString());
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> MemoryToJson(const FNarrativeMemory& Memory)
+    {
+        TSharedPtr<FJsonObject> MemoryObject = MakeShareable(new FJsonObject);
+        MemoryObject->SetStringField(TEXT("id"), Memory.MemoryID);
+        MemoryObject->SetNumberField(TEXT("event_type"), static_cast<int32>(Memory.EventType));
+        MemoryObject->SetNumberField(TEXT("importance"), static_cast<int32>(Memory.Importance));
+        MemoryObject->SetStringField(TEXT("title"), Memory.Title);
+        MemoryObject->SetStringField(TEXT("description"), Memory.Description);
+        MemoryObject->SetStringField(TEXT("location"), Memory.Location);
+        MemoryObject->SetArrayField(TEXT("participants"), ToJsonArray(Memory.ParticipantNPCs));
+        MemoryObject->SetArrayField(TEXT("tags"), ToJsonArray(Memory.Tags));
+
+        TSharedPtr<FJsonObject> ContextObject = MakeShareable(new FJsonObject);
+        for (const TPair<FString, FString>& Entry : Memory.ContextData)
+        {
+            ContextObject->SetStringField(Entry.Key, Entry.Value);
+        }
+        MemoryObject->SetObjectField(TEXT("context"), ContextObject);
+
+        MemoryObject->SetNumberField(TEXT("alignment_impact"), Memory.AlignmentImpact);
+        MemoryObject->SetNumberField(TEXT("emotional_weight"), Memory.EmotionalWeight);
+        MemoryObject->SetNumberField(TEXT("timestamp"), Memory.Timestamp);
+        MemoryObject->SetBoolField(TEXT("is_public"), Memory.bIsPublic);
+        MemoryObject->SetArrayField(TEXT("consequences"), ToJsonArray(Memory.Consequences));
+        return MemoryObject;
+    }
+
+    FNarrativeMemory MemoryFromJson(const TSharedPtr<FJsonObject>& MemoryObject)
+    {
+        FNarrativeMemory Memory;
+        MemoryObject->TryGetStringField(TEXT("id"), Memory.MemoryID);
+
+        int32 EventTypeValue = 0;
+        if (MemoryObject->TryGetNumberField(TEXT("event_type"), EventTypeValue))
+        {
+            Memory.EventType = static_cast<EMemoryEventType>(FMath::Clamp(EventTypeValue, 0, static_cast<int32>(EMemoryEventType::Custom)));
+        }
+
+        int32 ImportanceValue = 0;
+        if (MemoryObject->TryGetNumberField(TEXT("importance"), ImportanceValue))
+        {
+            Memory.Importance = static_cast<EMemoryImportance>(FMath::Clamp(ImportanceValue, 0, static_cast<int32>(EMemoryImportance::Legendary)));
+        }
+
+        MemoryObject->TryGetStringField(TEXT("title"), Memory.Title);
+        MemoryObject->TryGetStringField(TEXT("description"), Memory.Description);
+        MemoryObject->TryGetStringField(TEXT("location"), Memory.Location);
+        FromJsonArray(MemoryObject, TEXT("participants"), Memory.ParticipantNPCs);
+        FromJsonArray(MemoryObject, TEXT("tags"), Memory.Tags);
+
+        const TSharedPtr<FJsonObject>* ContextObject;
+        if (MemoryObject->TryGetObjectField(TEXT("context"), ContextObject))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*ContextObject)->Values)
+            {
+                Memory.ContextData.Add(Entry.Key, Entry.Value->AsString());
+            }
+        }
+
+        MemoryObject->TryGetNumberField(TEXT("alignment_impact"), Memory.AlignmentImpact);
+        MemoryObject->TryGetNumberField(TEXT("emotional_weight"), Memory.EmotionalWeight);
+        MemoryObject->TryGetNumberField(TEXT("timestamp"), Memory.Timestamp);
+        MemoryObject->TryGetBoolField(TEXT("is_public"), Memory.bIsPublic);
+        FromJsonArray(MemoryObject, TEXT("consequences"), Memory.Consequences);
+        return Memory;
+    }
+
+    /** Event types that matter most for each kind of prompt */
+    bool MatchesContextType(EMemoryEventType EventType, const FString& ContextType)
+    {
+        if (ContextType == TEXT("dialogue"))
+        {
+            return EventType == EMemoryEventType::Dialogue || EventType == EMemoryEventType::MoralChoice || EventType == EMemoryEventType::Companion;
+        }
+        if (ContextType == TEXT("quest"))
+        {
+            return EventType == EMemoryEventType::QuestDecision || EventType == EMemoryEventType::Story;
+        }
+        if (ContextType == TEXT("combat"))
+        {
+            return EventType == EMemoryEventType::Combat;
+        }
+        return false;
+    }
+}
+
+UNarrativeMemoryComponent::UNarrativeMemoryComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = true;
+
+    // Initialize default settings
+    MaxMemories = 1000;
+    MemoryDecayRate = 0.1f; // Importance levels per in-game hour
+    bAutoTrackQuests = true;
+    bAutoTrackCompanions = true;
+    ContextUpdateInterval = 5.0f;
+
+    QuestManagerRef = nullptr;
+    CompanionManagerRef = nullptr;
+    LastContextUpdate = 0.0f;
+}
+
+void UNarrativeMemoryComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Memories may have been restored by serialization before play
+    RebuildDerivedState();
+
+    UE_LOG(LogTemp, Log, TEXT("NarrativeMemoryComponent: Initialized with %d memories"), Memories.Num());
+}
+
+void UNarrativeMemoryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    BindTrackedComponents(false);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UNarrativeMemoryComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    // Decay and context refresh run on an interval; both cost nothing when nothing changed
+    const float Now = GetMemoryTime();
+    if (Now - LastContextUpdate >= ContextUpdateInterval)
+    {
+        LastContextUpdate = Now;
+        CleanupOldMemories();
+        UpdateCachedContext();
+    }
+}
+
+void UNarrativeMemoryComponent::InitializeNarrativeMemory(UQuestManagerComponent* QuestManager, UCompanionManagerComponent* CompanionManager)
+{
+    BindTrackedComponents(false);
+    QuestManagerRef = QuestManager;
+    CompanionManagerRef = CompanionManager;
+    BindTrackedComponents(true);
+
+    // Quests and companions that predate the binding still belong in the context
+    RebuildDerivedState();
+
+    UE_LOG(LogTemp, Log, TEXT("NarrativeMemoryComponent: Tracking quests %s, companions %s"),
+           QuestManagerRef ? TEXT("on") : TEXT("off"), CompanionManagerRef ? TEXT("on") : TEXT("off"));
+}
+
+FString UNarrativeMemoryComponent::AddMemory(const FNarrativeMemory& Memory)
+{
+    FNarrativeMemory NewMemory = Memory;
+    if (NewMemory.MemoryID.IsEmpty())
+    {
+        NewMemory.MemoryID = GenerateMemoryID();
+    }
+    if (NewMemory.Timestamp <= 0.0f)
+    {
+        NewMemory.Timestamp = GetMemoryTime();
+    }
+
+    // Re-adding an ID is an update, so the aggregates back the old version out first
+    if (MemoryIndex.FindSlot(NewMemory.MemoryID) != INDEX_NONE)
+    {
+        UpdateMemory(NewMemory.MemoryID, NewMemory);
+        return NewMemory.MemoryID;
+    }
+
+    MemoryIndex.Add(Memories, NewMemory);
+    ContextAggregates.ApplyMemory(NewMemory, 1);
+    SaveRevision.MarkChanged();
+
+    if (Memories.Num() > MaxMemories)
+    {
+        CleanupOldMemories();
+    }
+
+    OnMemoryAdded.Broadcast(NewMemory);
+    OnMemoryAddedEvent(NewMemory);
+
+    return NewMemory.MemoryID;
+}
+
+FString UNarrativeMemoryComponent::AddSimpleMemory(EMemoryEventType EventType, const FString& Title, const FString& Description,
+                                                   EMemoryImportance Importance, float AlignmentImpact)
+{
+    FNarrativeMemory Memory;
+    Memory.EventType = EventType;
+    Memory.Title = Title;
+    Memory.Description = Description;
+    Memory.Importance = Importance;
+    Memory.AlignmentImpact = FMath::Clamp(AlignmentImpact, -1.0f, 1.0f);
+    return AddMemory(Memory);
+}
+
+bool UNarrativeMemoryComponent::UpdateMemory(const FString& MemoryID, const FNarrativeMemory& UpdatedMemory)
+{
+    const int32 Slot = MemoryIndex.FindSlot(MemoryID);
+    if (Slot == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("NarrativeMemoryComponent: Memory %s not found"), *MemoryID);
+        return false;
+    }
+
+    const FNarrativeMemory OldMemory = Memories[Slot];
+    FNarrativeMemory NewMemory = UpdatedMemory;
+    if (NewMemory.MemoryID.IsEmpty())
+    {
+        NewMemory.MemoryID = MemoryID;
+    }
+
+    ContextAggregates.ApplyMemory(OldMemory, -1);
+    MemoryIndex.Update(Memories, Slot, NewMemory);
+    ContextAggregates.ApplyMemory(NewMemory, 1);
+    SaveRevision.MarkChanged();
+
+    OnMemoryUpdated.Broadcast(OldMemory, NewMemory);
+    return true;
+}
+
+FNarrativeMemory UNarrativeMemoryComponent::GetMemory(const FString& MemoryID) const
+{
+    const int32 Slot = MemoryIndex.FindSlot(MemoryID);
+    return Slot != INDEX_NONE ? Memories[Slot] : FNarrativeMemory();
+}
+
+EMemoryImportance UNarrativeMemoryComponent::GetEffectiveImportance(const FString& MemoryID) const
+{
+    const int32 Slot = MemoryIndex.FindSlot(MemoryID);
+    return Slot != INDEX_NONE ? MemoryIndex.GetEffectiveImportance(Memories[Slot], GetMemoryTime()) : EMemoryImportance::Trivial;
+}
+
+TArray<FNarrativeMemory> UNarrativeMemoryComponent::SearchMemories(EMemoryEventType EventType, EMemoryImportance MinImportance,
+                                                                   const TArray<FString>& Tags, int32 MaxResults) const
+{
+    FNarrativeMemorySearch Criteria;
+
+    // Custom is the Blueprint default and means "any type"
+    if (EventType != EMemoryEventType::Custom)
+    {
+        Criteria.EventType = EventType;
+    }
+    Criteria.MinImportance = MinImportance;
+    Criteria.Tags = Tags;
+    Criteria.MaxResults = MaxResults;
+    Criteria.Now = GetMemoryTime();
+
+    TArray<int32> Slots;
+    MemoryIndex.Search(Memories, Criteria, Slots);
+
+    TArray<FNarrativeMemory> Result;
+    Result.Reserve(Slots.Num());
+    for (const int32 Slot : Slots)
+    {
+        Result.Add(Memories[Slot]);
+    }
+    return Result;
+}
+
+TArray<FNarrativeMemory> UNarrativeMemoryComponent::GetRecentMemories(float TimeWindow, int32 MaxResults) const
+{
+    TArray<int32> Slots;
+    MemoryIndex.GetRecent(Memories, GetMemoryTime(), TimeWindow, MaxResults, Slots);
+
+    TArray<FNarrativeMemory> Result;
+    Result.Reserve(Slots.Num());
+    for (const int32 Slot : Slots)
+    {
+        Result.Add(Memories[Slot]);
+    }
+    return Result;
+}
+
+FNarrativeContext UNarrativeMemoryComponent::GenerateNarrativeContext(const FString& ContextType, const FString& NPCName, const FString& Location)
+{
+    // Only the sections whose inputs changed are rebuilt; the rest are copied as they stand
+    UpdateCachedContext();
+    FNarrativeContext Context = CachedContext;
+
+    // Candidates come from the index (the newest memories, plus the newest involving the NPC), not a pass over every memory
+    const float Now = GetMemoryTime();
+    TArray<int32> Candidates;
+    MemoryIndex.GetRecent(Memories, Now, TNumericLimits<float>::Max(), MaxContextCandidates, Candidates);
+    if (!NPCName.IsEmpty())
+    {
+        FNarrativeMemorySearch Criteria;
+        Criteria.Participants.Add(NPCName);
+        Criteria.MaxResults = MaxContextCandidates;
+        Criteria.Now = Now;
+        MemoryIndex.Search(Memories, Criteria, Candidates);
+    }
+
+    Candidates.Sort();
+    Candidates.SetNum(Algo::Unique(Candidates), EAllowShrinking::No);
+
+    TArray<TPair<float, int32>> Scored;
+    Scored.Reserve(Candidates.Num());
+    for (const int32 Slot : Candidates)
+    {
+        Scored.Emplace(CalculateMemoryRelevance(Memories[Slot], ContextType, NPCName, Location), Slot);
+    }
+    Scored.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+    {
+        return A.Key > B.Key;
+    });
+
+    const int32 NumRelevant = FMath::Min(Scored.Num(), MaxContextMemories);
+    float EmotionalIntensity = 0.0f;
+    float AlignmentTrend = 0.0f;
+    for (int32 Index = 0; Index < NumRelevant; ++Index)
+    {
+        const FNarrativeMemory& Memory = Memories[Scored[Index].Value];
+        Context.RelevantMemories.Add(Memory);
+        EmotionalIntensity += FMath::Abs(Memory.EmotionalWeight);
+        AlignmentTrend += Memory.AlignmentImpact;
+    }
+
+    if (NumRelevant > 0)
+    {
+        Context.EmotionalState.Add(TEXT("intensity"), EmotionalIntensity / NumRelevant);
+        Context.EmotionalState.Add(TEXT("alignment_trend"), AlignmentTrend / NumRelevant);
+    }
+
+    // Blueprint overrides; unimplemented events would return empty values, so only call the ones that exist
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UNarrativeMemoryComponent, FilterMemoriesForContext)))
+    {
+        Context.RelevantMemories = FilterMemoriesForContext(Context.RelevantMemories, ContextType);
+    }
+
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UNarrativeMemoryComponent, GenerateCustomContext)))
+    {
+        const FNarrativeContext Custom = GenerateCustomContext(ContextType, NPCName, Location);
+        Context.RelevantMemories.Append(Custom.RelevantMemories);
+        Context.ActiveQuestContext.Append(Custom.ActiveQuestContext);
+        Context.CompanionRelationships.Append(Custom.CompanionRelationships);
+        Context.EmotionalState.Append(Custom.EmotionalState);
+    }
+
+    OnContextGenerated.Broadcast(Context);
+    return Context;
+}
+
+FString UNarrativeMemoryComponent::GetPlayerAlignmentSummary() const
+{
+    return ContextAggregates.GetAlignmentSummary();
+}
+
+FString UNarrativeMemoryComponent::GetReputationWith(const FString& NPCOrFaction) const
+{
+    return ContextAggregates.GetReputationWith(NPCOrFaction);
+}
+
+void UNarrativeMemoryComponent::ClearAllMemories()
+{
+    Memories.Reset();
+    RebuildDerivedState();
+    SaveRevision.MarkChanged();
+
+    UE_LOG(LogTemp, Log, TEXT("NarrativeMemoryComponent: Cleared all memories"));
+}
+
+FString UNarrativeMemoryComponent::SaveMemoryData() const
+{
+    TSharedPtr<FJsonObject> SaveObject = MakeShareable(new FJsonObject);
+
+    TArray<TSharedPtr<FJsonValue>> MemoriesArray;
+    MemoriesArray.Reserve(Memories.Num());
+    for (const FNarrativeMemory& Memory : Memories)
+    {
+        MemoriesArray.Add(MakeShareable(new FJsonValueObject(MemoryToJson(Memory))));
+    }
+    SaveObject->SetArrayField(TEXT("memories"), MemoriesArray);
+
+    // Serialize to string
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(SaveObject.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool UNarrativeMemoryComponent::LoadMemoryData(const FString& SaveData)
+{
+    if (SaveData.IsEmpty())
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SaveData);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("NarrativeMemoryComponent: Failed to parse memory save data"));
+        return false;
+    }
+
+    TArray<FNarrativeMemory> LoadedMemories;
+    const TArray<TSharedPtr<FJsonValue>>* MemoriesArray;
+    if (JsonObject->TryGetArrayField(TEXT("memories"), MemoriesArray))
+    {
+        LoadedMemories.Reserve(MemoriesArray->Num());
+        for (const TSharedPtr<FJsonValue>& MemoryValue : *MemoriesArray)
+        {
+            const TSharedPtr<FJsonObject>* MemoryObject;
+            if (MemoryValue->TryGetObject(MemoryObject))
+            {
+                LoadedMemories.Add(MemoryFromJson(*MemoryObject));
+            }
+        }
+    }
+
+    Memories = MoveTemp(LoadedMemories);
+    RebuildDerivedState();
+    SaveRevision.MarkChanged();
+
+    UE_LOG(LogTemp, Log, TEXT("NarrativeMemoryComponent: Loaded %d memories"), Memories.Num());
+    return true;
+}
+
+void UNarrativeMemoryComponent::WriteSaveChunk(FSaveGameContainer& Container) const
+{
+    if (!SaveRevision.NeedsWrite(Container, SaveContainer::NarrativeMemoryChunk))
+    {
+        return;
+    }
+
+    NarrativeMemorySaveChunk::Write(Memories, Container);
+    SaveRevision.MarkSynced(Container);
+}
+
+bool UNarrativeMemoryComponent::ReadSaveChunk(const FSaveGameContainer& Container)
+{
+    TArray<FNarrativeMemory> LoadedMemories;
+    if (!NarrativeMemorySaveChunk::Read(Container, LoadedMemories))
+    {
+        // Quests and companions restore without broadcasting, so refold them into the context anyway
+        RebuildDerivedState();
+        return false;
+    }
+
+    Memories = MoveTemp(LoadedMemories);
+    RebuildDerivedState();
+    SaveRevision.MarkSynced(Container);
+
+    UE_LOG(LogTemp, Log, TEXT("NarrativeMemoryComponent: Loaded %d memories from save chunk"), Memories.Num());
+    return true;
+}
+
+TMap<FString, int32> UNarrativeMemoryComponent::GetMemoryStatistics() const
+{
+    TMap<FString, int32> Statistics;
+    Statistics.Add(TEXT("TotalMemories"), Memories.Num());
+
+    const UEnum* EventTypeEnum = StaticEnum<EMemoryEventType>();
+    const UEnum* ImportanceEnum = StaticEnum<EMemoryImportance>();
+    const float Now = GetMemoryTime();
+    int32 PublicMemories = 0;
+
+    for (const FNarrativeMemory& Memory : Memories)
+    {
+        ++Statistics.FindOrAdd(FString::Printf(TEXT("Type_%s"), *EventTypeEnum->GetNameStringByValue(static_cast<int64>(Memory.EventType))));
+
+        // Bucketed by importance as of now, so the counts show what decay has done
+        const EMemoryImportance Importance = MemoryIndex.GetEffectiveImportance(Memory, Now);
+        ++Statistics.FindOrAdd(FString::Printf(TEXT("Importance_%s"), *ImportanceEnum->GetNameStringByValue(static_cast<int64>(Importance))));
+
+        PublicMemories += Memory.bIsPublic ? 1 : 0;
+    }
+
+    Statistics.Add(TEXT("PublicMemories"), PublicMemories);
+    return Statistics;
+}
+
+FString UNarrativeMemoryComponent::GenerateMemoryID()
+{
+    return FString::Printf(TEXT("mem_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+float UNarrativeMemoryComponent::GetMemoryTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void UNarrativeMemoryComponent::CleanupOldMemories()
+{
+    auto BackOut = [this](const FNarrativeMemory& Memory)
+    {
+        ContextAggregates.ApplyMemory(Memory, -1);
+    };
+
+    const int32 NumExpired = MemoryIndex.ExpireMemories(Memories, GetMemoryTime(), BackOut);
+    const int32 NumTrimmed = MemoryIndex.TrimToCount(Memories, MaxMemories, BackOut);
+
+    if (NumExpired + NumTrimmed > 0)
+    {
+        SaveRevision.MarkChanged();
+        UE_LOG(LogTemp, Verbose, TEXT("NarrativeMemoryComponent: Forgot %d decayed and %d excess memories"), NumExpired, NumTrimmed);
+    }
+}
+
+float UNarrativeMemoryComponent::CalculateMemoryRelevance(const FNarrativeMemory& Memory, const FString& ContextType,
+                                                          const FString& NPCName, const FString& Location) const
+{
+    const float Now = GetMemoryTime();
+    const float Importance = static_cast<float>(MemoryIndex.GetEffectiveImportance(Memory, Now)) / static_cast<float>(EMemoryImportance::Legendary);
+    const float Recency = FMath::Pow(0.5f, FMath::Max(Now - Memory.Timestamp, 0.0f) / RelevanceHalfLifeSeconds);
+
+    float Relevance = 0.4f * Importance + 0.2f * Recency;
+    if (!NPCName.IsEmpty() && Memory.ParticipantNPCs.Contains(NPCName))
+    {
+        Relevance += 0.25f;
+    }
+    if (!Location.IsEmpty() && Memory.Location == Location)
+    {
+        Relevance += 0.15f;
+    }
+    if (MatchesContextType(Memory.EventType, ContextType))
+    {
+        Relevance += 0.1f;
+    }
+    return Relevance;
+}
+
+void UNarrativeMemoryComponent::UpdateCachedContext()
+{
+    if (ContextAggregates.IsDirty())
+    {
+        ContextAggregates.Refresh(CachedContext);
+    }
+}
+
+void UNarrativeMemoryComponent::RebuildDerivedState()
+{
+    MemoryIndex.Rebuild(Memories, MemoryDecayRate);
+
+    ContextAggregates.Reset();
+    for (const FNarrativeMemory& Memory : Memories)
+    {
+        ContextAggregates.ApplyMemory(Memory, 1);
+    }
+
+    if (QuestManagerRef)
+    {
+        for (const FActiveQuest& Quest : QuestManagerRef->GetActiveQuests())
+        {
+            ContextAggregates.OnQuestStarted(Quest);
+        }
+    }
+
+    if (CompanionManagerRef)
+    {
+        for (const FActiveCompanion& Companion : CompanionManagerRef->GetRecruitedCompanions())
+        {
+            ContextAggregates.OnCompanionChanged(Companion);
+        }
+    }
+
+    UpdateCachedContext();
+}
+
+void UNarrativeMemoryComponent::BindTrackedComponents(bool bBind)
+{
+    // The context follows quests and companions whether or not they are also recorded as memories
+    if (QuestManagerRef)
+    {
+        if (bBind)
+        {
+            QuestManagerRef->OnQuestStarted.AddUniqueDynamic(this, &UNarrativeMemoryComponent::OnQuestStarted);
+            QuestManagerRef->OnQuestCompleted.AddUniqueDynamic(this, &UNarrativeMemoryComponent::OnQuestCompleted);
+            QuestManagerRef->OnQuestFailed.AddUniqueDynamic(this, &UNarrativeMemoryComponent::OnQuestFailed);
+        }
+        else
+        {
+            QuestManagerRef->OnQuestStarted.RemoveDynamic(this, &UNarrativeMemoryComponent::OnQuestStarted);
+            QuestManagerRef->OnQuestCompleted.RemoveDynamic(this, &UNarrativeMemoryComponent::OnQuestCompleted);
+            QuestManagerRef->OnQuestFailed.RemoveDynamic(this, &UNarrativeMemoryComponent::OnQuestFailed);
+        }
+    }
+
+    if (CompanionManagerRef)
+    {
+        if (bBind)
+        {
+            CompanionManagerRef->OnCompanionLoyaltyChanged.AddUniqueDynamic(this, &UNarrativeMemoryComponent::OnCompanionLoyaltyChanged);
+        }
+        else
+        {
+            CompanionManagerRef->OnCompanionLoyaltyChanged.RemoveDynamic(this, &UNarrativeMemoryComponent::OnCompanionLoyaltyChanged);
+        }
+    }
+}
+
+void UNarrativeMemoryComponent::OnQuestStarted(const FActiveQuest& Quest)
+{
+    ContextAggregates.OnQuestStarted(Quest);
+
+    if (bAutoTrackQuests)
+    {
+        FNarrativeMemory Memory;
+        Memory.EventType = EMemoryEventType::QuestDecision;
+        Memory.Importance = EMemoryImportance::Moderate;
+        Memory.Title = FString::Printf(TEXT("Started quest: %s"), *Quest.QuestData.Title);
+        Memory.Description = Quest.QuestData.Description;
+        Memory.Location = Quest.LayoutName;
+        Memory.Tags = { TEXT("quest"), TEXT("quest_started"), Quest.QuestID };
+        Memory.ContextData.Add(TEXT("QuestID"), Quest.QuestID);
+        if (!Quest.QuestGiverName.IsEmpty())
+        {
+            Memory.ParticipantNPCs.Add(Quest.QuestGiverName);
+        }
+        AddMemory(Memory);
+    }
+}
+
+void UNarrativeMemoryComponent::OnQuestCompleted(const FActiveQuest& Quest)
+{
+    ContextAggregates.OnQuestEnded(Quest);
+
+    if (bAutoTrackQuests)
+    {
+        FNarrativeMemory Memory;
+        Memory.EventType = EMemoryEventType::QuestDecision;
+        Memory.Importance = EMemoryImportance::Important;
+        Memory.Title = FString::Printf(TEXT("Completed quest: %s"), *Quest.QuestData.Title);
+        Memory.Description = Quest.QuestData.Description;
+        Memory.Location = Quest.LayoutName;
+        Memory.Tags = { TEXT("quest"), TEXT("quest_completed"), Quest.QuestID };
+        Memory.ContextData.Add(TEXT("QuestID"), Quest.QuestID);
+        Memory.EmotionalWeight = 0.3f;
+        if (!Quest.QuestGiverName.IsEmpty())
+        {
+            Memory.ParticipantNPCs.Add(Quest.QuestGiverName);
+        }
+        AddMemory(Memory);
+    }
+}
+
+void UNarrativeMemoryComponent::OnQuestFailed(const FActiveQuest& Quest)
+{
+    ContextAggregates.OnQuestEnded(Quest);
+
+    if (bAutoTrackQuests)
+    {
+        FNarrativeMemory Memory;
+        Memory.EventType = EMemoryEventType::QuestDecision;
+        Memory.Importance = EMemoryImportance::Important;
+        Memory.Title = FString::Printf(TEXT("Failed quest: %s"), *Quest.QuestData.Title);
+        Memory.Description = Quest.QuestData.Description;
+        Memory.Location = Quest.LayoutName;
+        Memory.Tags = { TEXT("quest"), TEXT("quest_failed"), Quest.QuestID };
+        Memory.ContextData.Add(TEXT("QuestID"), Quest.QuestID);
+        Memory.EmotionalWeight = 0.3f;
+        if (!Quest.QuestGiverName.IsEmpty())
+        {
+            Memory.ParticipantNPCs.Add(Quest.QuestGiverName);
+        }
+        AddMemory(Memory);
+    }
+}
+
+void UNarrativeMemoryComponent::OnCompanionLoyaltyChanged(const FActiveCompanion& Companion)
+{
+    ContextAggregates.OnCompanionChanged(Companion);
+
+    if (bAutoTrackCompanions)
+    {
+        const FString& Name = Companion.CompanionData.Name;
+
+        FNarrativeMemory Memory;
+        Memory.EventType = EMemoryEventType::Companion;
+        Memory.Importance = EMemoryImportance::Minor;
+        Memory.Title = FString::Printf(TEXT("%s's loyalty changed"), *Name);
+        Memory.ParticipantNPCs.Add(Name);
+        Memory.Tags = { TEXT("companion"), TEXT("loyalty") };
+        Memory.ContextData.Add(TEXT("Loyalty"), StaticEnum<ECompanionLoyalty>()->GetNameStringByValue(static_cast<int64>(Companion.Loyalty)));
+
+        // Loyalty points run -100..100; they colour how the companion is remembered to feel
+        Memory.EmotionalWeight = FMath::Clamp(Companion.LoyaltyPoints / 100.0f, -1.0f, 1.0f);
+        AddMemory(Memory);
+    }
+}
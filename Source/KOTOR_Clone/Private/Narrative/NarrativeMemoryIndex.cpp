@@ -0,0 +1,625 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Narrative/NarrativeMemoryIndex.h"
+#include "Narrative/NarrativeMemoryComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    void InsertPosting(TArray<uint64>& Posting, uint64 OrderKey)
+    {
+        // Memories mostly arrive in time order, so this is nearly always an append
+        if (Posting.Num() == 0 || Posting.Last() < OrderKey)
+        {
+            Posting.Add(OrderKey);
+            return;
+        }
+
+        const int32 Index = Algo::LowerBound(Posting, OrderKey);
+        if (!Posting.IsValidIndex(Index) || Posting[Index] != OrderKey)
+        {
+            Posting.Insert(OrderKey, Index);
+        }
+    }
+}
+
+void FNarrativeMemoryIndex::Reset()
+{
+    IdLookup.Reset();
+    SlotById.Reset();
+    FreeIds.Reset();
+    SlotIds.Reset();
+    DecayBuckets.Reset();
+    Postings.Reset();
+    TagLookup.Reset();
+    ParticipantLookup.Reset();
+}
+
+void FNarrativeMemoryIndex::Rebuild(TArray<FNarrativeMemory>& Memories, float InDecayRate)
+{
+    Reset();
+    DecayRate = InDecayRate;
+
+    SlotIds.Reserve(Memories.Num());
+    SlotById.Reserve(Memories.Num());
+
+    for (int32 Slot = 0; Slot < Memories.Num();)
+    {
+        const FString& MemoryID = Memories[Slot].MemoryID;
+        if (!MemoryID.IsEmpty() && IdLookup.Contains(MemoryID))
+        {
+            // Later duplicates lose; swap the tail in and look at this slot again
+            Memories.RemoveAtSwap(Slot, EAllowShrinking::No);
+            continue;
+        }
+
+        SlotIds.Add(MemoryID.IsEmpty() ? INDEX_NONE : AllocateId(MemoryID, Slot));
+        ++Slot;
+    }
+
+    // Loaded memories are in no particular order, so postings are filled unsorted and sorted once
+    FPostingKeys Keys;
+    for (int32 Slot = 0; Slot < Memories.Num(); ++Slot)
+    {
+        const int32 Id = SlotIds[Slot];
+        if (Id == INDEX_NONE)
+        {
+            continue;
+        }
+
+        DecayBuckets.Add(Id, GetExpiryTime(Memories[Slot]));
+
+        Keys.Reset();
+        GatherPostingKeys(Memories[Slot], true, Keys);
+        const uint64 OrderKey = GetOrderKey(Memories, Slot);
+        for (const uint64 Key : Keys)
+        {
+            Postings.FindOrAdd(Key).Add(OrderKey);
+        }
+    }
+
+    for (TPair<uint64, TArray<uint64>>& Posting : Postings)
+    {
+        // A memory that repeats a tag is filed under it twice
+        Posting.Value.Sort();
+        Posting.Value.SetNum(Algo::Unique(Posting.Value), EAllowShrinking::No);
+    }
+}
+
+int32 FNarrativeMemoryIndex::Add(TArray<FNarrativeMemory>& Memories, const FNarrativeMemory& Memory)
+{
+    if (const int32* Existing = Memory.MemoryID.IsEmpty() ? nullptr : IdLookup.Find(Memory.MemoryID))
+    {
+        const int32 Slot = SlotById[*Existing];
+        Update(Memories, Slot, Memory);
+        return Slot;
+    }
+
+    const int32 Slot = Memories.Add(Memory);
+    const int32 Id = Memory.MemoryID.IsEmpty() ? INDEX_NONE : AllocateId(Memory.MemoryID, Slot);
+    SlotIds.Add(Id);
+    if (Id != INDEX_NONE)
+    {
+        DecayBuckets.Add(Id, GetExpiryTime(Memory));
+        IndexTerms(Memory, GetOrderKey(Memories, Slot));
+    }
+
+    return Slot;
+}
+
+void FNarrativeMemoryIndex::Update(TArray<FNarrativeMemory>& Memories, int32 Slot, const FNarrativeMemory& Memory)
+{
+    FNarrativeMemory& Existing = Memories[Slot];
+    const int32 Id = SlotIds[Slot];
+
+    // The ID is the index key; an update that renames the memory is a remove plus an add
+    if (!Memory.MemoryID.Equals(Existing.MemoryID, ESearchCase::IgnoreCase))
+    {
+        RemoveAt(Memories, Slot);
+        Add(Memories, Memory);
+        return;
+    }
+
+    if (Id == INDEX_NONE)
+    {
+        Existing = Memory;
+        return;
+    }
+
+    // Re-filed under the new order key too, in case the update re-timed it
+    const float OldExpiry = GetExpiryTime(Existing);
+    UnindexTerms(Existing, GetOrderKey(Memories, Slot));
+
+    Existing = Memory;
+
+    IndexTerms(Existing, GetOrderKey(Memories, Slot));
+    const float NewExpiry = GetExpiryTime(Existing);
+    if (OldExpiry != NewExpiry)
+    {
+        DecayBuckets.Remove(Id, OldExpiry);
+        DecayBuckets.Add(Id, NewExpiry);
+    }
+}
+
+void FNarrativeMemoryIndex::RemoveAt(TArray<FNarrativeMemory>& Memories, int32 Slot)
+{
+    const int32 Id = SlotIds[Slot];
+    if (Id != INDEX_NONE)
+    {
+        DecayBuckets.Remove(Id, GetExpiryTime(Memories[Slot]));
+        UnindexTerms(Memories[Slot], GetOrderKey(Memories, Slot));
+        FreeId(Memories[Slot].MemoryID, Id);
+    }
+
+    RemoveSlot(Memories, Slot);
+}
+
+void FNarrativeMemoryIndex::RemoveSlot(TArray<FNarrativeMemory>& Memories, int32 Slot)
+{
+    Memories.RemoveAtSwap(Slot, EAllowShrinking::No);
+    SlotIds.RemoveAtSwap(Slot, EAllowShrinking::No);
+
+    // Re-point the memory that was moved into the hole
+    if (SlotIds.IsValidIndex(Slot) && SlotIds[Slot] != INDEX_NONE)
+    {
+        SlotById[SlotIds[Slot]] = Slot;
+    }
+}
+
+int32 FNarrativeMemoryIndex::FindSlot(const FString& MemoryID) const
+{
+    const int32* Id = IdLookup.Find(MemoryID);
+    return Id ? SlotById[*Id] : INDEX_NONE;
+}
+
+uint64 FNarrativeMemoryIndex::MakeOrderKey(float Timestamp, int32 Id)
+{
+    // Flip every bit of negatives and the sign bit of positives so the bits sort like the floats
+    uint32 Bits = 0;
+    FMemory::Memcpy(&Bits, &Timestamp, sizeof(Bits));
+    Bits = (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+    return (static_cast<uint64>(Bits) << 32) | static_cast<uint32>(Id);
+}
+
+uint64 FNarrativeMemoryIndex::GetOrderKey(const TArray<FNarrativeMemory>& Memories, int32 Slot) const
+{
+    return MakeOrderKey(Memories[Slot].Timestamp, SlotIds[Slot]);
+}
+
+int32 FNarrativeMemoryIndex::AllocateId(const FString& MemoryID, int32 Slot)
+{
+    const int32 Id = FreeIds.Num() > 0 ? FreeIds.Pop(EAllowShrinking::No) : SlotById.Add(INDEX_NONE);
+    SlotById[Id] = Slot;
+    IdLookup.Add(MemoryID, Id);
+    return Id;
+}
+
+void FNarrativeMemoryIndex::FreeId(const FString& MemoryID, int32 Id)
+{
+    IdLookup.Remove(MemoryID);
+    SlotById[Id] = INDEX_NONE;
+    FreeIds.Add(Id);
+}
+
+int32 FNarrativeMemoryIndex::ExpireMemories(TArray<FNarrativeMemory>& Memories, float Now)
+{
+    return ExpireMemories(Memories, Now, [](const FNarrativeMemory&) {});
+}
+
+int32 FNarrativeMemoryIndex::ExpireMemories(TArray<FNarrativeMemory>& Memories, float Now, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved)
+{
+    ExpiredScratch.Reset();
+    DecayBuckets.PopExpired(Now, ExpiredScratch);
+    return RemoveIds(Memories, ExpiredScratch, OnRemoved);
+}
+
+int32 FNarrativeMemoryIndex::TrimToCount(TArray<FNarrativeMemory>& Memories, int32 MaxMemories)
+{
+    return TrimToCount(Memories, MaxMemories, [](const FNarrativeMemory&) {});
+}
+
+int32 FNarrativeMemoryIndex::TrimToCount(TArray<FNarrativeMemory>& Memories, int32 MaxMemories, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved)
+{
+    const int32 NumToTrim = Memories.Num() - FMath::Max(MaxMemories, 0);
+    if (NumToTrim <= 0)
+    {
+        return 0;
+    }
+
+    ExpiredScratch.Reset();
+    DecayBuckets.PopSoonest(NumToTrim, ExpiredScratch);
+    return RemoveIds(Memories, ExpiredScratch, OnRemoved);
+}
+
+int32 FNarrativeMemoryIndex::RemoveIds(TArray<FNarrativeMemory>& Memories, TArrayView<const int32> Ids, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved)
+{
+    if (Ids.Num() == 0)
+    {
+        return 0;
+    }
+
+    // Postings are compacted once per touched list rather than once per removed memory
+    TArray<uint64> Removed;
+    Removed.Reserve(Ids.Num());
+    TSet<uint64> TouchedKeys;
+    FPostingKeys Keys;
+
+    for (const int32 Id : Ids)
+    {
+        const int32 Slot = SlotById.IsValidIndex(Id) ? SlotById[Id] : INDEX_NONE;
+        if (Slot == INDEX_NONE)
+        {
+            continue;
+        }
+
+        Keys.Reset();
+        GatherPostingKeys(Memories[Slot], false, Keys);
+        TouchedKeys.Append(Keys);
+        Removed.Add(GetOrderKey(Memories, Slot));
+        OnRemoved(Memories[Slot]);
+
+        // Already unfiled by the bucket pop, so no RemoveAt here
+        FreeId(Memories[Slot].MemoryID, Id);
+        RemoveSlot(Memories, Slot);
+    }
+
+    Removed.Sort();
+    for (const uint64 Key : TouchedKeys)
+    {
+        TArray<uint64>& Posting = Postings.FindChecked(Key);
+        Posting.RemoveAll([&Removed](uint64 OrderKey)
+        {
+            return Algo::BinarySearch(Removed, OrderKey) != INDEX_NONE;
+        });
+
+        if (Posting.Num() == 0)
+        {
+            Postings.Remove(Key);
+        }
+    }
+
+    return Removed.Num();
+}
+
+void FNarrativeMemoryIndex::GatherPostingKeys(const FNarrativeMemory& Memory, bool bIntern, FPostingKeys& OutKeys)
+{
+    OutKeys.Add(MakePostingKey(EPostingKind::All, 0));
+    OutKeys.Add(MakePostingKey(EPostingKind::EventType, static_cast<int32>(Memory.EventType)));
+
+    auto GatherTerms = [bIntern, &OutKeys](const TArray<FString>& Terms, TMap<FString, int32>& Lookup, EPostingKind Kind)
+    {
+        for (const FString& Term : Terms)
+        {
+            if (Term.IsEmpty())
+            {
+                continue;
+            }
+
+            const int32* TermId = Lookup.Find(Term);
+            if (!TermId && bIntern)
+            {
+                TermId = &Lookup.Add(Term, Lookup.Num());
+            }
+            if (TermId)
+            {
+                OutKeys.Add(MakePostingKey(Kind, *TermId));
+            }
+        }
+    };
+
+    GatherTerms(Memory.Tags, TagLookup, EPostingKind::Tag);
+    GatherTerms(Memory.ParticipantNPCs, ParticipantLookup, EPostingKind::Participant);
+}
+
+void FNarrativeMemoryIndex::IndexTerms(const FNarrativeMemory& Memory, uint64 OrderKey)
+{
+    FPostingKeys Keys;
+    GatherPostingKeys(Memory, true, Keys);
+
+    for (const uint64 Key : Keys)
+    {
+        InsertPosting(Postings.FindOrAdd(Key), OrderKey);
+    }
+}
+
+void FNarrativeMemoryIndex::UnindexTerms(const FNarrativeMemory& Memory, uint64 OrderKey)
+{
+    FPostingKeys Keys;
+    GatherPostingKeys(Memory, false, Keys);
+
+    for (const uint64 Key : Keys)
+    {
+        TArray<uint64>* Posting = Postings.Find(Key);
+        if (!Posting)
+        {
+            continue;
+        }
+
+        const int32 Index = Algo::BinarySearch(*Posting, OrderKey);
+        if (Index != INDEX_NONE)
+        {
+            Posting->RemoveAt(Index, 1, EAllowShrinking::No);
+        }
+        if (Posting->Num() == 0)
+        {
+            Postings.Remove(Key);
+        }
+    }
+}
+
+int32 FNarrativeMemoryIndex::Search(const TArray<FNarrativeMemory>& Memories, const FNarrativeMemorySearch& Criteria, TArray<int32>& OutSlots) const
+{
+    if (Criteria.MaxResults <= 0)
+    {
+        return 0;
+    }
+
+    int32 NumFound = 0;
+    auto Accept = [this, &Memories, &Criteria, &OutSlots, &NumFound](int32 Slot)
+    {
+        if (GetEffectiveImportance(Memories[Slot], Criteria.Now) >= Criteria.MinImportance)
+        {
+            OutSlots.Add(Slot);
+            ++NumFound;
+        }
+        return NumFound < Criteria.MaxResults;
+    };
+
+    // Any term nobody has used means no memory can match
+    TArray<const TArray<uint64>*, TInlineAllocator<8>> Lists;
+    auto AddList = [this, &Lists](uint64 Key)
+    {
+        const TArray<uint64>* Posting = Postings.Find(Key);
+        Lists.Add(Posting);
+        return Posting != nullptr;
+    };
+
+    if (Criteria.EventType.IsSet() && !AddList(MakePostingKey(EPostingKind::EventType, static_cast<int32>(Criteria.EventType.GetValue()))))
+    {
+        return 0;
+    }
+
+    for (const FString& Tag : Criteria.Tags)
+    {
+        const int32* TagId = TagLookup.Find(Tag);
+        if (!TagId || !AddList(MakePostingKey(EPostingKind::Tag, *TagId)))
+        {
+            return 0;
+        }
+    }
+
+    for (const FString& Participant : Criteria.Participants)
+    {
+        const int32* ParticipantId = ParticipantLookup.Find(Participant);
+        if (!ParticipantId || !AddList(MakePostingKey(EPostingKind::Participant, *ParticipantId)))
+        {
+            return 0;
+        }
+    }
+
+    // No terms: importance is the only filter, applied to every memory newest first
+    if (Lists.Num() == 0 && !AddList(MakePostingKey(EPostingKind::All, 0)))
+    {
+        return 0;
+    }
+
+    // Drive from the shortest list, newest first; each other list keeps a shrinking search bound
+    Lists.Sort([](const TArray<uint64>& A, const TArray<uint64>& B) { return A.Num() < B.Num(); });
+
+    TArray<int32, TInlineAllocator<8>> Bounds;
+    for (const TArray<uint64>* List : Lists)
+    {
+        Bounds.Add(List->Num());
+    }
+
+    const TArray<uint64>& Driver = *Lists[0];
+    for (int32 DriverIndex = Driver.Num() - 1; DriverIndex >= 0; --DriverIndex)
+    {
+        const uint64 Candidate = Driver[DriverIndex];
+        bool bInAll = true;
+
+        for (int32 ListIndex = 1; ListIndex < Lists.Num(); ++ListIndex)
+        {
+            const TArray<uint64>& List = *Lists[ListIndex];
+            const int32 Bound = Algo::UpperBound(TConstArrayView<uint64>(List.GetData(), Bounds[ListIndex]), Candidate);
+            Bounds[ListIndex] = Bound;
+
+            if (Bound == 0)
+            {
+                // Everything left in the driver is older still
+                return NumFound;
+            }
+            if (List[Bound - 1] != Candidate)
+            {
+                bInAll = false;
+                break;
+            }
+        }
+
+        if (bInAll && !Accept(SlotById[GetOrderKeyId(Candidate)]))
+        {
+            break;
+        }
+    }
+
+    return NumFound;
+}
+
+int32 FNarrativeMemoryIndex::GetRecent(const TArray<FNarrativeMemory>& Memories, float Now, float TimeWindow, int32 MaxResults, TArray<int32>& OutSlots) const
+{
+    const TArray<uint64>* All = Postings.Find(MakePostingKey(EPostingKind::All, 0));
+    if (!All || MaxResults <= 0)
+    {
+        return 0;
+    }
+
+    // Newest first off the end of the chronological list; stops at the window edge
+    const float WindowStart = Now - TimeWindow;
+    int32 NumFound = 0;
+    for (int32 Index = All->Num() - 1; Index >= 0 && NumFound < MaxResults; --Index)
+    {
+        const int32 Slot = SlotById[GetOrderKeyId((*All)[Index])];
+        if (Memories[Slot].Timestamp < WindowStart)
+        {
+            break;
+        }
+
+        OutSlots.Add(Slot);
+        ++NumFound;
+    }
+    return NumFound;
+}
+
+EMemoryImportance FNarrativeMemoryIndex::GetEffectiveImportance(const FNarrativeMemory& Memory, float Now) const
+{
+    if (Memory.Importance >= EMemoryImportance::Critical)
+    {
+        return Memory.Importance;
+    }
+
+    const int32 Level = static_cast<int32>(Memory.Importance) - MemoryDecay::GetLevelsLost(Memory.Timestamp, DecayRate, Now);
+    return static_cast<EMemoryImportance>(FMath::Max(Level, 0));
+}
+
+float FNarrativeMemoryIndex::GetExpiryTime(const FNarrativeMemory& Memory) const
+{
+    if (Memory.Importance >= EMemoryImportance::Critical)
+    {
+        return TNumericLimits<float>::Max();
+    }
+
+    // Gone once it would drop below Trivial
+    return MemoryDecay::GetTimeToLose(Memory.Timestamp, DecayRate, static_cast<int32>(Memory.Importance) + 1);
+}
+
+namespace
+{
+    constexpr int32 BenchmarkTagCount = 256;
+    constexpr int32 BenchmarkNPCCount = 1000;
+
+    // Skewed toward low indices, so a few tags are common and most are rare
+    int32 SkewedIndex(FRandomStream& Stream, int32 Count)
+    {
+        const float Unit = Stream.FRand();
+        return FMath::Min(static_cast<int32>(Unit * Unit * Count), Count - 1);
+    }
+
+    /** The pre-index SearchMemories: a pass over every memory comparing FString tags */
+    int32 LinearSearch(const TArray<FNarrativeMemory>& Memories, const FNarrativeMemorySearch& Criteria, TArray<int32>& OutSlots)
+    {
+        int32 NumFound = 0;
+        for (int32 Slot = Memories.Num() - 1; Slot >= 0 && NumFound < Criteria.MaxResults; --Slot)
+        {
+            const FNarrativeMemory& Memory = Memories[Slot];
+            if ((Criteria.EventType.IsSet() && Memory.EventType != Criteria.EventType.GetValue()) || Memory.Importance < Criteria.MinImportance)
+            {
+                continue;
+            }
+
+            bool bHasAllTags = true;
+            for (const FString& Tag : Criteria.Tags)
+            {
+                if (!Memory.Tags.Contains(Tag))
+                {
+                    bHasAllTags = false;
+                    break;
+                }
+            }
+
+            if (bHasAllTags)
+            {
+                OutSlots.Add(Slot);
+                ++NumFound;
+            }
+        }
+        return NumFound;
+    }
+
+    void BenchmarkMemorySearch(const TArray<FString>& Args)
+    {
+        const int32 MaxMemories = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 10000) : 1000000;
+        const int32 NumQueries = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 200;
+
+        for (int32 NumMemories = 10000; NumMemories <= MaxMemories; NumMemories *= 10)
+        {
+            FNarrativeMemoryIndex Index;
+
+            TArray<FNarrativeMemory> Memories;
+            Memories.Reserve(NumMemories);
+
+            FRandomStream Stream(0x7A65);
+            for (int32 MemoryIndex = 0; MemoryIndex < NumMemories; ++MemoryIndex)
+            {
+                FNarrativeMemory Memory;
+                Memory.MemoryID = FString::Printf(TEXT("bench_%d"), MemoryIndex);
+                Memory.EventType = static_cast<EMemoryEventType>(Stream.RandRange(0, static_cast<int32>(EMemoryEventType::Custom)));
+                Memory.Importance = static_cast<EMemoryImportance>(Stream.RandRange(0, static_cast<int32>(EMemoryImportance::Legendary)));
+                Memory.Timestamp = static_cast<float>(MemoryIndex);
+                for (int32 TagIndex = 0; TagIndex < 3; ++TagIndex)
+                {
+                    Memory.Tags.AddUnique(FString::Printf(TEXT("tag_%d"), SkewedIndex(Stream, BenchmarkTagCount)));
+                }
+                Memory.ParticipantNPCs.Add(FString::Printf(TEXT("npc_%d"), SkewedIndex(Stream, BenchmarkNPCCount)));
+                Index.Add(Memories, Memory);
+            }
+
+            TArray<FNarrativeMemorySearch> Queries;
+            for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+            {
+                FNarrativeMemorySearch& Query = Queries.AddDefaulted_GetRef();
+                Query.Tags.Add(FString::Printf(TEXT("tag_%d"), SkewedIndex(Stream, BenchmarkTagCount)));
+                if (Stream.FRand() < 0.5f)
+                {
+                    Query.Tags.AddUnique(FString::Printf(TEXT("tag_%d"), SkewedIndex(Stream, BenchmarkTagCount)));
+                }
+                if (Stream.FRand() < 0.5f)
+                {
+                    Query.EventType = static_cast<EMemoryEventType>(Stream.RandRange(0, static_cast<int32>(EMemoryEventType::Custom)));
+                }
+                Query.MinImportance = EMemoryImportance::Minor;
+                Query.Now = static_cast<float>(NumMemories);
+            }
+
+            auto TimeQueries = [&Queries](TFunctionRef<int32(const FNarrativeMemorySearch&, TArray<int32>&)> RunQuery, uint32& OutChecksum)
+            {
+                TArray<int32> Slots;
+                OutChecksum = 0;
+                const double StartTime = FPlatformTime::Seconds();
+                for (const FNarrativeMemorySearch& Query : Queries)
+                {
+                    Slots.Reset();
+                    RunQuery(Query, Slots);
+                    for (const int32 Slot : Slots)
+                    {
+                        OutChecksum = HashCombineFast(OutChecksum, static_cast<uint32>(Slot));
+                    }
+                }
+                return Queries.Num() / FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+            };
+
+            uint32 LinearChecksum = 0;
+            uint32 IndexedChecksum = 0;
+            const double LinearRate = TimeQueries([&Memories](const FNarrativeMemorySearch& Query, TArray<int32>& Slots)
+            {
+                return LinearSearch(Memories, Query, Slots);
+            }, LinearChecksum);
+            const double IndexedRate = TimeQueries([&Memories, &Index](const FNarrativeMemorySearch& Query, TArray<int32>& Slots)
+            {
+                return Index.Search(Memories, Query, Slots);
+            }, IndexedChecksum);
+
+            UE_LOG(LogTemp, Display, TEXT("Narrative.BenchmarkSearch: %d memories, linear %.0f queries/s, indexed %.0f queries/s (%.1fx), results %s"),
+                   NumMemories, LinearRate, IndexedRate, IndexedRate / FMath::Max(LinearRate, 1e-9),
+                   LinearChecksum == IndexedChecksum ? TEXT("MATCH") : TEXT("MISMATCH"));
+        }
+    }
+
+    FAutoConsoleCommand BenchmarkMemorySearchCommand(
+        TEXT("Narrative.BenchmarkSearch"),
+        TEXT("Compare indexed narrative memory search with a linear scan at 10k, 100k and 1M memories. Usage: Narrative.BenchmarkSearch [MaxMemories=1000000] [Queries=200]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkMemorySearch));
+}
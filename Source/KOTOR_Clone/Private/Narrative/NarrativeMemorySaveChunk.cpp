@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Narrative/NarrativeMemorySaveChunk.h"
+#include "Narrative/NarrativeMemoryComponent.h"
+#include "AIDM/SaveGameContainer.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+void NarrativeMemorySaveChunk::Write(const TArray<FNarrativeMemory>& Memories, FSaveGameContainer& Container)
+{
+    TArray<int32> Order;
+    Order.Reserve(Memories.Num());
+    for (int32 Slot = 0; Slot < Memories.Num(); ++Slot)
+    {
+        Order.Add(Slot);
+    }
+    Order.Sort([&Memories](int32 A, int32 B)
+    {
+        const FNarrativeMemory& MemoryA = Memories[A];
+        const FNarrativeMemory& MemoryB = Memories[B];
+        return MemoryA.Timestamp != MemoryB.Timestamp ? MemoryA.Timestamp < MemoryB.Timestamp : MemoryA.MemoryID < MemoryB.MemoryID;
+    });
+
+    FSaveChunkWriter Writer;
+    Writer.WriteVarU32(Order.Num());
+    for (const int32 Slot : Order)
+    {
+        const FNarrativeMemory& Memory = Memories[Slot];
+        Writer.WriteString(Memory.MemoryID);
+        Writer.WriteU8(static_cast<uint8>(Memory.EventType));
+        Writer.WriteU8(static_cast<uint8>(Memory.Importance));
+        Writer.WriteString(Memory.Title);
+        Writer.WriteString(Memory.Description);
+        Writer.WriteString(Memory.Location);
+        Writer.WriteStringArray(Memory.ParticipantNPCs);
+        Writer.WriteStringArray(Memory.Tags);
+        Writer.WriteStringMap(Memory.ContextData);
+        Writer.WriteF32(Memory.AlignmentImpact);
+        Writer.WriteF32(Memory.EmotionalWeight);
+        Writer.WriteTimestamp(Memory.Timestamp);
+        Writer.WriteBool(Memory.bIsPublic);
+        Writer.WriteStringArray(Memory.Consequences);
+    }
+
+    TArray<uint8> Payload;
+    Writer.Finalize(Payload);
+    Container.SetChunk(SaveContainer::NarrativeMemoryChunk, Version, MoveTemp(Payload));
+}
+
+bool NarrativeMemorySaveChunk::Read(const FSaveGameContainer& Container, TArray<FNarrativeMemory>& OutMemories)
+{
+    TArray<uint8> Payload;
+    if (!Container.GetChunk(SaveContainer::NarrativeMemoryChunk, Version, Payload))
+    {
+        return false;
+    }
+
+    FSaveChunkReader Reader(Payload);
+    TArray<FNarrativeMemory> Memories;
+    Memories.SetNum(Reader.ReadCount());
+    for (FNarrativeMemory& Memory : Memories)
+    {
+        Memory.MemoryID = Reader.ReadString();
+
+        const uint8 EventTypeValue = Reader.ReadU8();
+        Memory.EventType = EventTypeValue <= static_cast<uint8>(EMemoryEventType::Custom) ? static_cast<EMemoryEventType>(EventTypeValue) : EMemoryEventType::Custom;
+        const uint8 ImportanceValue = Reader.ReadU8();
+        Memory.Importance = ImportanceValue <= static_cast<uint8>(EMemoryImportance::Legendary) ? static_cast<EMemoryImportance>(ImportanceValue) : EMemoryImportance::Minor;
+
+        Memory.Title = Reader.ReadString();
+        Memory.Description = Reader.ReadString();
+        Memory.Location = Reader.ReadString();
+        Reader.ReadStringArray(Memory.ParticipantNPCs);
+        Reader.ReadStringArray(Memory.Tags);
+        Reader.ReadStringMap(Memory.ContextData);
+        Memory.AlignmentImpact = Reader.ReadF32();
+        Memory.EmotionalWeight = Reader.ReadF32();
+        Memory.Timestamp = Reader.ReadTimestamp();
+        Memory.bIsPublic = Reader.ReadBool();
+        Reader.ReadStringArray(Memory.Consequences);
+    }
+
+    if (!Reader.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("NarrativeMemorySaveChunk: Narrative memory chunk is corrupt"));
+        return false;
+    }
+
+    OutMemories = MoveTemp(Memories);
+    return true;
+}
+
+namespace
+{
+    void BenchmarkSaveContainer(const TArray<FString>& Args)
+    {
+        const int32 NumMemories = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+        TArray<FNarrativeMemory> Memories;
+        Memories.Reserve(NumMemories);
+
+        FRandomStream Stream(0x5A7E);
+        float Timestamp = 0.0f;
+        for (int32 MemoryIndex = 0; MemoryIndex < NumMemories; ++MemoryIndex)
+        {
+            FNarrativeMemory& Memory = Memories.AddDefaulted_GetRef();
+            Memory.MemoryID = FString::Printf(TEXT("mem_%d"), MemoryIndex);
+            Memory.EventType = static_cast<EMemoryEventType>(Stream.RandRange(0, static_cast<int32>(EMemoryEventType::Custom)));
+            Memory.Importance = static_cast<EMemoryImportance>(Stream.RandRange(0, static_cast<int32>(EMemoryImportance::Legendary)));
+            Memory.Title = FString::Printf(TEXT("Event %d"), Stream.RandRange(0, 63));
+            Memory.Location = FString::Printf(TEXT("planet_%d"), Stream.RandRange(0, 7));
+            Memory.ParticipantNPCs.Add(FString::Printf(TEXT("npc_%d"), Stream.RandRange(0, 255)));
+            Memory.Tags.Add(FString::Printf(TEXT("tag_%d"), Stream.RandRange(0, 31)));
+            Memory.AlignmentImpact = Stream.FRandRange(-1.0f, 1.0f);
+            Memory.EmotionalWeight = Stream.FRand();
+            Timestamp += Stream.FRandRange(1.0f, 30.0f);
+            Memory.Timestamp = Timestamp;
+        }
+
+        FSaveGameContainer Container;
+        TArray<uint8> Bytes;
+
+        double StartTime = FPlatformTime::Seconds();
+        NarrativeMemorySaveChunk::Write(Memories, Container);
+        Container.Write(Bytes);
+        const double FirstSaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+        const int32 FirstSaveBytes = Bytes.Num();
+
+        // Nothing changed: the chunk is re-encoded but matches its CRC, so nothing is recompressed
+        StartTime = FPlatformTime::Seconds();
+        NarrativeMemorySaveChunk::Write(Memories, Container);
+        const bool bStayedClean = !Container.IsDirty();
+        Container.Write(Bytes);
+        const double CleanSaveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        FSaveGameContainer Loaded;
+        TArray<FNarrativeMemory> LoadedMemories;
+        StartTime = FPlatformTime::Seconds();
+        const bool bLoaded = Loaded.Read(Bytes) && NarrativeMemorySaveChunk::Read(Loaded, LoadedMemories);
+        const double LoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        // Timestamps come back rounded to the millisecond
+        const float TimestampTolerance = static_cast<float>(0.5 / SaveContainer::TimestampTicksPerSecond);
+        bool bRoundTrip = bLoaded && LoadedMemories.Num() == Memories.Num();
+        for (int32 Index = 0; bRoundTrip && Index < Memories.Num(); ++Index)
+        {
+            const FNarrativeMemory& Original = Memories[Index];
+            const FNarrativeMemory& Copy = LoadedMemories[Index];
+            bRoundTrip = Original.MemoryID == Copy.MemoryID && FMath::Abs(Original.Timestamp - Copy.Timestamp) <= TimestampTolerance &&
+                Original.AlignmentImpact == Copy.AlignmentImpact && Original.Tags == Copy.Tags;
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("SaveGame.BenchmarkContainer: %d memories, %d bytes (%.1f bytes/memory), save %.2f ms, unchanged save %.2f ms (%s), load %.2f ms, round trip %s"),
+               NumMemories, FirstSaveBytes, static_cast<double>(FirstSaveBytes) / NumMemories, FirstSaveMs,
+               CleanSaveMs, bStayedClean ? TEXT("clean") : TEXT("DIRTY"), LoadMs, bRoundTrip ? TEXT("MATCH") : TEXT("MISMATCH"));
+    }
+
+    FAutoConsoleCommand BenchmarkSaveContainerCommand(
+        TEXT("SaveGame.BenchmarkContainer"),
+        TEXT("Time saving and loading narrative memories through the binary save container. Usage: SaveGame.BenchmarkContainer [Memories=100000]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSaveContainer));
+}
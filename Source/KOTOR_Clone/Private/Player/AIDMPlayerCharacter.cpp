@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Player/AIDMPlayerCharacter.h"
+#include "Player/InteractableRegistrySubsystem.h"
 #include "Components/InputComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
@@ -8,6 +9,11 @@
 #include "Blueprint/UserWidget.h"
 #include "UI/DialogueWidget.h"
 #include "Debug/AIDMDebugWidget.h"
+#include "Companions/CompanionManagerComponent.h"
+#include "Narrative/NarrativeMemoryComponent.h"
+#include "NPCs/NPCMemoryMatrixComponent.h"
+#include "Timeline/CampaignTimelineComponent.h"
+#include "Misc/Paths.h"
 #include "DrawDebugHelpers.h"
 
 AAIDMPlayerCharacter::AAIDMPlayerCharacter()
@@ -258,6 +264,87 @@ void AAIDMPlayerCharacter::TravelToLayout(const FString& LayoutName)
     }
 }
 
+bool AAIDMPlayerCharacter::SaveGameToSlot(const FString& SlotName)
+{
+    if (SlotName.IsEmpty())
+    {
+        return false;
+    }
+
+    // Each subsystem skips encoding if its chunk in the container is already current
+    if (QuestManager)
+    {
+        QuestManager->WriteSaveChunk(SaveGameContainer);
+    }
+    if (UCompanionManagerComponent* CompanionManager = FindComponentByClass<UCompanionManagerComponent>())
+    {
+        CompanionManager->WriteSaveChunk(SaveGameContainer);
+    }
+    if (UNarrativeMemoryComponent* NarrativeMemory = FindComponentByClass<UNarrativeMemoryComponent>())
+    {
+        NarrativeMemory->WriteSaveChunk(SaveGameContainer);
+    }
+    if (UNPCMemoryMatrixComponent* NPCMemory = FindComponentByClass<UNPCMemoryMatrixComponent>())
+    {
+        NPCMemory->WriteSaveChunk(SaveGameContainer);
+    }
+    if (UCampaignTimelineComponent* Timeline = FindComponentByClass<UCampaignTimelineComponent>())
+    {
+        Timeline->WriteSaveChunk(SaveGameContainer);
+    }
+
+    const FString SavePath = GetSaveSlotPath(SlotName);
+    if (!SaveGameContainer.SaveToFile(SavePath))
+    {
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AIDMPlayerCharacter: Saved %s"), *SavePath);
+    return true;
+}
+
+bool AAIDMPlayerCharacter::LoadGameFromSlot(const FString& SlotName)
+{
+    if (SlotName.IsEmpty())
+    {
+        return false;
+    }
+
+    const FString SavePath = GetSaveSlotPath(SlotName);
+    if (!SaveGameContainer.LoadFromFile(SavePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AIDMPlayerCharacter: Failed to load %s"), *SavePath);
+        return false;
+    }
+
+    // Quests and companions restore without broadcasting, so the narrative memory reads after them
+    // and rebuilds its context from their state. Recruiting restored companions still reaches the
+    // timeline, which reads last so its chunk replaces those events.
+    if (QuestManager)
+    {
+        QuestManager->ReadSaveChunk(SaveGameContainer);
+    }
+    if (UCompanionManagerComponent* CompanionManager = FindComponentByClass<UCompanionManagerComponent>())
+    {
+        CompanionManager->ReadSaveChunk(SaveGameContainer);
+    }
+    if (UNarrativeMemoryComponent* NarrativeMemory = FindComponentByClass<UNarrativeMemoryComponent>())
+    {
+        NarrativeMemory->ReadSaveChunk(SaveGameContainer);
+    }
+    if (UNPCMemoryMatrixComponent* NPCMemory = FindComponentByClass<UNPCMemoryMatrixComponent>())
+    {
+        NPCMemory->ReadSaveChunk(SaveGameContainer);
+    }
+    if (UCampaignTimelineComponent* Timeline = FindComponentByClass<UCampaignTimelineComponent>())
+    {
+        Timeline->ReadSaveChunk(SaveGameContainer);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AIDMPlayerCharacter: Loaded %s"), *SavePath);
+    return true;
+}
+
 void AAIDMPlayerCharacter::CreateUIWidgets()
 {
     if (!GetWorld() || !GetWorld()->GetFirstPlayerController())
@@ -324,33 +411,15 @@ void AAIDMPlayerCharacter::UpdateInteractable()
 
 AActor* AAIDMPlayerCharacter::FindNearestInteractable()
 {
-    if (!GetWorld())
+    UWorld* World = GetWorld();
+    UInteractableRegistrySubsystem* Registry = World ? World->GetSubsystem<UInteractableRegistrySubsystem>() : nullptr;
+    if (!Registry)
     {
         return nullptr;
     }
     
-    FVector PlayerLocation = GetActorLocation();
-    AActor* NearestActor = nullptr;
-    float NearestDistance = InteractionRange;
-    
-    // Find all actors within interaction range
-    for (TActorIterator<AActor> ActorItr(GetWorld()); ActorItr; ++ActorItr)
-    {
-        AActor* Actor = *ActorItr;
-        
-        if (Actor && Actor != this && IsActorInteractable(Actor))
-        {
-            float Distance = FVector::Dist(PlayerLocation, Actor->GetActorLocation());
-            
-            if (Distance < NearestDistance)
-            {
-                NearestDistance = Distance;
-                NearestActor = Actor;
-            }
-        }
-    }
-    
-    return NearestActor;
+    // Only the registry cells overlapping the interaction range are visited
+    return Registry->FindNearestInteractable(GetActorLocation(), InteractionRange, this);
 }
 
 bool AAIDMPlayerCharacter::IsActorInteractable(AActor* Actor) const
@@ -360,11 +429,13 @@ bool AAIDMPlayerCharacter::IsActorInteractable(AActor* Actor) const
         return false;
     }
     
-    // Check if actor has an "Interactable" tag or component
-    // This is a simplified check - in a real implementation you'd have a proper interface
-    return Actor->Tags.Contains(TEXT("NPC")) || 
-           Actor->Tags.Contains(TEXT("Interactable")) ||
-           Actor->GetName().Contains(TEXT("NPC"));
+    // Same rule the interactable registry uses to auto-register actors
+    return UInteractableRegistrySubsystem::ShouldAutoRegister(Actor);
+}
+
+FString AAIDMPlayerCharacter::GetSaveSlotPath(const FString& SlotName) const
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), SlotName + SaveContainer::FileExtension);
 }
 
 void AAIDMPlayerCharacter::OnDebugToggle()
@@ -454,10 +525,10 @@ void AAIDMPlayerCharacter::OnPlanetChanged(int32 OldPlanetIndex, int32 NewPlanet
     
     if (CampaignLoader && CampaignLoader->IsCampaignLoaded())
     {
-        FPlanetData NewPlanet = CampaignLoader->GetPlanetData(NewPlanetIndex);
-        if (NewPlanet.Layouts.Num() > 0)
+        const FPlanetData* NewPlanet = CampaignLoader->FindPlanetData(NewPlanetIndex);
+        if (NewPlanet && NewPlanet->Layouts.Num() > 0)
         {
-            OnAreaEntered(NewPlanet, NewPlanet.Layouts[0]);
+            OnAreaEntered(*NewPlanet, NewPlanet->Layouts[0]);
         }
     }
 }
@@ -469,8 +540,9 @@ void AAIDMPlayerCharacter::OnLayoutChanged(const FString& OldLayout, const FStri
     
     if (AIDirector && AIDirector->IsInitialized())
     {
-        FPlanetData CurrentPlanet = AIDirector->GetCurrentPlanetData();
-        FMapLayout CurrentLayout = AIDirector->GetCurrentLayoutData();
-        OnAreaEntered(CurrentPlanet, CurrentLayout);
+        if (const FPlanetData* CurrentPlanet = AIDirector->FindCurrentPlanetData())
+        {
+            OnAreaEntered(*CurrentPlanet, AIDirector->GetCurrentLayoutData());
+        }
     }
 }
@@ -0,0 +1,210 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Player/InteractableRegistrySubsystem.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "NPCs/ProceduralNPCActor.h"
+#include "Loot/LootPickupSystem.h"
+#include "Meditation/MeditationShrineActor.h"
+#include "Morality/MoralEchoSystem.h"
+#include "Visions/AlternateRealitySimulator.h"
+
+UInteractableRegistrySubsystem::UInteractableRegistrySubsystem()
+{
+    CellSize = 500.0f;
+}
+
+void UInteractableRegistrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UWorld* World = GetWorld())
+    {
+        ActorSpawnedHandle = World->AddOnActorSpawnedHandler(
+            FOnActorSpawned::FDelegate::CreateUObject(this, &UInteractableRegistrySubsystem::HandleActorSpawned));
+    }
+}
+
+void UInteractableRegistrySubsystem::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+    ActorSpawnedHandle.Reset();
+
+    Cells.Empty();
+    RegisteredCells.Empty();
+    MovableActors.Empty();
+
+    Super::Deinitialize();
+}
+
+void UInteractableRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // One full pass for level-placed actors; everything after this registers on spawn
+    for (TActorIterator<AActor> It(&InWorld); It; ++It)
+    {
+        if (ShouldAutoRegister(*It))
+        {
+            RegisterInteractable(*It);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("InteractableRegistrySubsystem: Registered %d interactables"), RegisteredCells.Num());
+}
+
+void UInteractableRegistrySubsystem::Tick(float DeltaTime)
+{
+    // Re-file actors that walked into another cell; static actors never move cells
+    for (int32 Index = MovableActors.Num() - 1; Index >= 0; --Index)
+    {
+        AActor* Actor = MovableActors[Index].Get();
+        FIntPoint* FiledCell = Actor ? RegisteredCells.Find(Actor) : nullptr;
+        if (!FiledCell)
+        {
+            MovableActors.RemoveAtSwap(Index);
+            continue;
+        }
+
+        const FIntPoint CurrentCell = GetCell(Actor->GetActorLocation());
+        if (CurrentCell != *FiledCell)
+        {
+            RemoveFromCell(*FiledCell, Actor);
+            Cells.FindOrAdd(CurrentCell).Add(Actor);
+            *FiledCell = CurrentCell;
+        }
+    }
+}
+
+TStatId UInteractableRegistrySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractableRegistrySubsystem, STATGROUP_Tickables);
+}
+
+void UInteractableRegistrySubsystem::RegisterInteractable(AActor* Actor)
+{
+    if (!Actor || RegisteredCells.Contains(Actor))
+    {
+        return;
+    }
+
+    const FIntPoint Cell = GetCell(Actor->GetActorLocation());
+    Cells.FindOrAdd(Cell).Add(Actor);
+    RegisteredCells.Add(Actor, Cell);
+
+    if (Actor->IsRootComponentMovable())
+    {
+        MovableActors.Add(Actor);
+    }
+
+    Actor->OnDestroyed.AddUniqueDynamic(this, &UInteractableRegistrySubsystem::HandleActorDestroyed);
+}
+
+void UInteractableRegistrySubsystem::UnregisterInteractable(AActor* Actor)
+{
+    FIntPoint Cell;
+    if (!Actor || !RegisteredCells.RemoveAndCopyValue(Actor, Cell))
+    {
+        return;
+    }
+
+    RemoveFromCell(Cell, Actor);
+    MovableActors.RemoveSwap(Actor);
+    Actor->OnDestroyed.RemoveDynamic(this, &UInteractableRegistrySubsystem::HandleActorDestroyed);
+}
+
+AActor* UInteractableRegistrySubsystem::FindNearestInteractable(const FVector& Location, float Range, AActor* IgnoreActor) const
+{
+    if (Range <= 0.0f)
+    {
+        return nullptr;
+    }
+
+    const FIntPoint MinCell = GetCell(Location - FVector(Range, Range, 0.0f));
+    const FIntPoint MaxCell = GetCell(Location + FVector(Range, Range, 0.0f));
+
+    AActor* NearestActor = nullptr;
+    float NearestDistanceSq = FMath::Square(Range);
+
+    for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+    {
+        for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+        {
+            const TArray<TWeakObjectPtr<AActor>>* CellActors = Cells.Find(FIntPoint(CellX, CellY));
+            if (!CellActors)
+            {
+                continue;
+            }
+
+            for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
+            {
+                AActor* Actor = WeakActor.Get();
+                if (!Actor || Actor == IgnoreActor)
+                {
+                    continue;
+                }
+
+                const float DistanceSq = FVector::DistSquared(Location, Actor->GetActorLocation());
+                if (DistanceSq < NearestDistanceSq)
+                {
+                    NearestDistanceSq = DistanceSq;
+                    NearestActor = Actor;
+                }
+            }
+        }
+    }
+
+    return NearestActor;
+}
+
+bool UInteractableRegistrySubsystem::ShouldAutoRegister(const AActor* Actor)
+{
+    if (!Actor)
+    {
+        return false;
+    }
+
+    return Actor->IsA<AProceduralNPCActor>() ||
+           Actor->IsA<ALootPickupActor>() ||
+           Actor->IsA<ALootChestActor>() ||
+           Actor->IsA<AMeditationShrineActor>() ||
+           Actor->IsA<AVisionShrine>() ||
+           Actor->IsA<AEchoSceneTriggerVolume>() ||
+           Actor->Tags.Contains(TEXT("NPC")) ||
+           Actor->Tags.Contains(TEXT("Interactable")) ||
+           Actor->GetName().Contains(TEXT("NPC"));
+}
+
+FIntPoint UInteractableRegistrySubsystem::GetCell(const FVector& Location) const
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UInteractableRegistrySubsystem::RemoveFromCell(const FIntPoint& Cell, const AActor* Actor)
+{
+    if (TArray<TWeakObjectPtr<AActor>>* CellActors = Cells.Find(Cell))
+    {
+        CellActors->RemoveSwap(const_cast<AActor*>(Actor));
+        if (CellActors->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void UInteractableRegistrySubsystem::HandleActorSpawned(AActor* Actor)
+{
+    if (ShouldAutoRegister(Actor))
+    {
+        RegisterInteractable(Actor);
+    }
+}
+
+void UInteractableRegistrySubsystem::HandleActorDestroyed(AActor* DestroyedActor)
+{
+    UnregisterInteractable(DestroyedActor);
+}
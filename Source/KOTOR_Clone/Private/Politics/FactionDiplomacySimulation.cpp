@@ -0,0 +1,225 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// Upkeep of the derived lookups (relation matrix, territory index) and headless diplomacy rounds
+
+#include "Politics/FactionDiplomacySystem.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    // Largest random swing per round, and how strongly extreme relationships relax toward neutral
+    constexpr int32 MaxDriftPerRound = 3;
+    constexpr int32 RelaxDivisor = 50;
+
+    // Flattened TerritoryControl record, see UFactionDiplomacySystem::TerritoryControl
+    FString MakeTerritoryRecord(const FString& Territory, const FString& FactionID)
+    {
+        return Territory + TEXT("::") + FactionID;
+    }
+}
+
+void UFactionDiplomacySystem::RebuildRelationMatrix()
+{
+    RelationMatrix.Reset();
+
+    for (FFactionData& Faction : Factions)
+    {
+        const int32 Slot = RelationMatrix.AddFaction(Faction.FactionID);
+        Faction.FactionSymbol = Slot != INDEX_NONE ? RelationMatrix.GetFaction(Slot) : FAIDMId();
+    }
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (int32 Index = 0; Index < DiplomaticRelationships.Num(); ++Index)
+    {
+        const FDiplomaticRelationship& Relationship = DiplomaticRelationships[Index];
+        const int32 SlotA = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, Relationship.FactionA));
+        const int32 SlotB = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, Relationship.FactionB));
+        if (SlotA == INDEX_NONE || SlotB == INDEX_NONE || SlotA == SlotB)
+        {
+            continue;
+        }
+
+        RelationMatrix.SetRelationship(SlotA, SlotB, Relationship.RelationshipValue, Relationship.Stance);
+        RelationMatrix.SetRecordIndex(SlotA, SlotB, Index);
+    }
+}
+
+void UFactionDiplomacySystem::SyncRelationshipRecords()
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (FDiplomaticRelationship& Relationship : DiplomaticRelationships)
+    {
+        const int32 SlotA = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, Relationship.FactionA));
+        const int32 SlotB = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, Relationship.FactionB));
+        if (SlotA == INDEX_NONE || SlotB == INDEX_NONE)
+        {
+            continue;
+        }
+
+        const FFactionRelationCell& Cell = RelationMatrix.GetCell(SlotA, SlotB);
+        Relationship.RelationshipValue = Cell.Value;
+        Relationship.Stance = Cell.Stance;
+    }
+}
+
+void UFactionDiplomacySystem::RebuildTerritoryIndex()
+{
+    TerritoryIndex.Reset();
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+
+    for (const FString& Record : TerritoryControl)
+    {
+        FString Territory;
+        FString FactionID;
+        if (Record.Split(TEXT("::"), &Territory, &FactionID))
+        {
+            TerritoryIndex.AddControl(Symbols.Intern(EAIDMSymbolKind::Planet, Territory), Symbols.Intern(EAIDMSymbolKind::Faction, FactionID));
+        }
+    }
+
+    for (const FFactionData& Faction : Factions)
+    {
+        const FAIDMId FactionSymbol = Symbols.Intern(EAIDMSymbolKind::Faction, Faction.FactionID);
+        for (const FString& Territory : Faction.ControlledTerritories)
+        {
+            TerritoryIndex.AddControl(Symbols.Intern(EAIDMSymbolKind::Planet, Territory), FactionSymbol);
+        }
+    }
+}
+
+void UFactionDiplomacySystem::ApplyTerritoryTransfer(const FString& Territory, const FString& FromFaction, const FString& ToFaction)
+{
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FAIDMId TerritorySymbol = Symbols.Intern(EAIDMSymbolKind::Planet, Territory);
+    if (!TerritorySymbol.IsValid())
+    {
+        return;
+    }
+
+    auto RemoveRecords = [this, &Territory](const FString& FactionID)
+    {
+        TerritoryControl.RemoveSingle(MakeTerritoryRecord(Territory, FactionID));
+        for (FFactionData& Faction : Factions)
+        {
+            if (Faction.FactionID == FactionID)
+            {
+                Faction.ControlledTerritories.Remove(Territory);
+            }
+        }
+    };
+
+    const FAIDMId ToSymbol = Symbols.Intern(EAIDMSymbolKind::Faction, ToFaction);
+
+    if (FromFaction.IsEmpty())
+    {
+        // Copy: the view is invalidated by SetController
+        const TArray<FAIDMId, TInlineAllocator<2>> PreviousControllers(TerritoryIndex.GetControllers(TerritorySymbol));
+        for (const FAIDMId Previous : PreviousControllers)
+        {
+            if (Previous != ToSymbol)
+            {
+                RemoveRecords(Symbols.ToString(EAIDMSymbolKind::Faction, Previous));
+            }
+        }
+
+        TerritoryIndex.SetController(TerritorySymbol, ToSymbol);
+    }
+    else
+    {
+        TerritoryIndex.RemoveControl(TerritorySymbol, Symbols.Find(EAIDMSymbolKind::Faction, FromFaction));
+        RemoveRecords(FromFaction);
+        TerritoryIndex.AddControl(TerritorySymbol, ToSymbol);
+    }
+
+    if (ToSymbol.IsValid())
+    {
+        TerritoryControl.AddUnique(MakeTerritoryRecord(Territory, ToFaction));
+        for (FFactionData& Faction : Factions)
+        {
+            if (Faction.FactionID == ToFaction)
+            {
+                Faction.ControlledTerritories.AddUnique(Territory);
+            }
+        }
+    }
+}
+
+void UFactionDiplomacySystem::RemoveFactionTerritories(FAIDMId Faction)
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FString FactionID = Symbols.ToString(EAIDMSymbolKind::Faction, Faction);
+
+    for (const FAIDMId Territory : TerritoryIndex.GetTerritories(Faction))
+    {
+        TerritoryControl.RemoveSingle(MakeTerritoryRecord(Symbols.ToString(EAIDMSymbolKind::Planet, Territory), FactionID));
+    }
+
+    TerritoryIndex.RemoveFaction(Faction);
+}
+
+void UFactionDiplomacySystem::BeginHeadlessSimulation()
+{
+    bHeadlessSimulation = true;
+    HeadlessChangedPairs.Reset();
+}
+
+int32 UFactionDiplomacySystem::StepDiplomacyHeadless(uint32 Seed, uint32 StepIndex)
+{
+    int32 NumChanged = 0;
+    const uint32 StepSeed = HashCombineFast(Seed, StepIndex);
+
+    // One linear pass over the upper triangle; records are only touched at the end
+    RelationMatrix.SweepPairs([this, StepSeed, &NumChanged](int32 SlotA, int32 SlotB, FFactionRelationCell& Cell)
+    {
+        // Vassalage is set by treaties, not by drift
+        if (Cell.Stance == EDiplomaticStance::Vassal)
+        {
+            return;
+        }
+
+        // Seeded by the pair's IDs, so the result does not depend on slot assignment
+        const uint32 HashA = RelationMatrix.GetSlotHash(SlotA);
+        const uint32 HashB = RelationMatrix.GetSlotHash(SlotB);
+        FRandomStream Stream(static_cast<int32>(HashCombineFast(StepSeed, HashA ^ HashB)));
+
+        const int32 Drift = Stream.RandRange(-MaxDriftPerRound, MaxDriftPerRound) - Cell.Value / RelaxDivisor;
+        const int32 NewValue = FMath::Clamp(Cell.Value + Drift, -100, 100);
+        Cell.Value = static_cast<int8>(NewValue);
+
+        const EDiplomaticStance NewStance = CalculateDiplomaticStance(NewValue);
+        if (NewStance != Cell.Stance)
+        {
+            Cell.Stance = NewStance;
+            HeadlessChangedPairs.Add(FIntPoint(SlotA, SlotB));
+            ++NumChanged;
+        }
+    });
+
+    return NumChanged;
+}
+
+void UFactionDiplomacySystem::EndHeadlessSimulation()
+{
+    if (!bHeadlessSimulation)
+    {
+        return;
+    }
+
+    bHeadlessSimulation = false;
+    SyncRelationshipRecords();
+
+    TArray<FIntPoint> ChangedPairs = HeadlessChangedPairs.Array();
+    HeadlessChangedPairs.Reset();
+    ChangedPairs.Sort([](const FIntPoint& A, const FIntPoint& B)
+    {
+        return A.X != B.X ? A.X < B.X : A.Y < B.Y;
+    });
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (const FIntPoint& Pair : ChangedPairs)
+    {
+        const FString FactionA = Symbols.ToString(EAIDMSymbolKind::Faction, RelationMatrix.GetFaction(Pair.X));
+        const FString FactionB = Symbols.ToString(EAIDMSymbolKind::Faction, RelationMatrix.GetFaction(Pair.Y));
+        OnDiplomaticStanceChanged.Broadcast(FactionA, FactionB);
+    }
+}
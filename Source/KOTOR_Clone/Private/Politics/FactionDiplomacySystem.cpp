@@ -0,0 +1,650 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Politics/FactionDiplomacySystem.h"
+#include "Engine/World.h"
+#include "Misc/Guid.h"
+#include "TimerManager.h"
+
+namespace
+{
+    // Relationship change applied by a default-handled diplomatic action
+    int32 DefaultActionImpact(const FString& ActionType)
+    {
+        if (ActionType == TEXT("alliance")) return 30;
+        if (ActionType == TEXT("treaty") || ActionType == TEXT("peace")) return 20;
+        if (ActionType == TEXT("trade")) return 10;
+        if (ActionType == TEXT("war")) return -60;
+        return 0;
+    }
+
+    // Starting relationship for a pair of faction types: lawful and outlaw factions distrust each other
+    int32 InitialRelationshipValue(EFactionType TypeA, EFactionType TypeB)
+    {
+        auto IsLawful = [](EFactionType Type)
+        {
+            return Type == EFactionType::Government || Type == EFactionType::Military;
+        };
+        auto IsOutlaw = [](EFactionType Type)
+        {
+            return Type == EFactionType::Criminal || Type == EFactionType::Rebel || Type == EFactionType::Cult;
+        };
+
+        if ((IsLawful(TypeA) && IsOutlaw(TypeB)) || (IsOutlaw(TypeA) && IsLawful(TypeB)))
+        {
+            return -40;
+        }
+        return TypeA == TypeB ? 20 : 0;
+    }
+}
+
+UFactionDiplomacySystem::UFactionDiplomacySystem()
+{
+    // Automatic diplomacy runs on a timer, not per frame
+    PrimaryComponentTick.bCanEverTick = false;
+
+    bAutomaticDiplomacy = true;
+    DiplomacyUpdateInterval = 60.0f;
+
+    CampaignLoaderRef = nullptr;
+    NarrativeMemoryRef = nullptr;
+}
+
+void UFactionDiplomacySystem::BeginPlay()
+{
+    Super::BeginPlay();
+
+    FAIDMSymbolTable::Get().OnReset().AddUObject(this, &UFactionDiplomacySystem::HandleSymbolsReset);
+
+    UE_LOG(LogTemp, Log, TEXT("FactionDiplomacySystem: Initialized"));
+}
+
+void UFactionDiplomacySystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(DiplomacyTimer);
+    }
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UFactionDiplomacySystem::OnMemoryAdded);
+    }
+
+    FAIDMSymbolTable::Get().OnReset().RemoveAll(this);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UFactionDiplomacySystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void UFactionDiplomacySystem::InitializeDiplomacySystem(UCampaignLoaderSubsystem* CampaignLoader,
+                                                        UNarrativeMemoryComponent* NarrativeMemory)
+{
+    CampaignLoaderRef = CampaignLoader;
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UFactionDiplomacySystem::OnMemoryAdded);
+    }
+    NarrativeMemoryRef = NarrativeMemory;
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.AddDynamic(this, &UFactionDiplomacySystem::OnMemoryAdded);
+    }
+
+    LoadFactionsFromCampaign();
+    InitializeDiplomaticRelationships();
+    RebuildRelationMatrix();
+    RebuildTerritoryIndex();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(DiplomacyTimer);
+        if (bAutomaticDiplomacy && DiplomacyUpdateInterval > 0.0f)
+        {
+            World->GetTimerManager().SetTimer(DiplomacyTimer, this, &UFactionDiplomacySystem::ProcessAutomaticDiplomacy,
+                                              DiplomacyUpdateInterval, true);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FactionDiplomacySystem: Loaded %d factions, %d relationships"),
+           Factions.Num(), DiplomaticRelationships.Num());
+}
+
+void UFactionDiplomacySystem::AddFaction(const FFactionData& FactionData)
+{
+    if (FactionData.FactionID.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionDiplomacySystem: Ignoring faction with no ID"));
+        return;
+    }
+
+    // The matrix interns the ID; an existing faction keeps its slot
+    const int32 Slot = RelationMatrix.AddFaction(FactionData.FactionID);
+    const FAIDMId FactionSymbol = Slot != INDEX_NONE ? RelationMatrix.GetFaction(Slot) : FAIDMId();
+
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+
+    if (FFactionData* Existing = FindFaction(FactionSymbol))
+    {
+        // Unindex only the territories the new record drops; kept ones stay where they are in
+        // their controller lists, so a primary controller stays primary
+        for (const FString& Territory : Existing->ControlledTerritories)
+        {
+            if (!FactionData.ControlledTerritories.Contains(Territory))
+            {
+                TerritoryIndex.RemoveControl(Symbols.Find(EAIDMSymbolKind::Planet, Territory), FactionSymbol);
+            }
+        }
+
+        *Existing = FactionData;
+        Existing->FactionSymbol = FactionSymbol;
+        for (const FString& Territory : Existing->ControlledTerritories)
+        {
+            TerritoryIndex.AddControl(Symbols.Intern(EAIDMSymbolKind::Planet, Territory), FactionSymbol);
+        }
+        return;
+    }
+
+    FFactionData& NewFaction = Factions.Add_GetRef(FactionData);
+    NewFaction.FactionSymbol = FactionSymbol;
+
+    for (const FString& Territory : NewFaction.ControlledTerritories)
+    {
+        TerritoryIndex.AddControl(Symbols.Intern(EAIDMSymbolKind::Planet, Territory), FactionSymbol);
+    }
+
+    if (!FindPlayerReputation(FactionSymbol))
+    {
+        FPlayerReputation& Reputation = PlayerReputations.AddDefaulted_GetRef();
+        Reputation.FactionID = FactionData.FactionID;
+        Reputation.FactionSymbol = FactionSymbol;
+        Reputation.ReputationTitle = CalculateReputationTitle(Reputation.ReputationValue);
+    }
+}
+
+void UFactionDiplomacySystem::RemoveFaction(const FString& FactionID)
+{
+    const FAIDMId FactionSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID);
+    if (FactionSymbol.IsValid())
+    {
+        RemoveFactionTerritories(FactionSymbol);
+    }
+
+    const int32 NumRemoved = Factions.RemoveAll([&FactionID](const FFactionData& Faction)
+    {
+        return Faction.FactionID == FactionID;
+    });
+    if (NumRemoved == 0)
+    {
+        return;
+    }
+
+    DiplomaticRelationships.RemoveAll([&FactionID](const FDiplomaticRelationship& Relationship)
+    {
+        return Relationship.FactionA == FactionID || Relationship.FactionB == FactionID;
+    });
+    PendingActions.RemoveAll([&FactionID](const FDiplomaticAction& Action)
+    {
+        return Action.InitiatorFaction == FactionID || Action.TargetFaction == FactionID;
+    });
+    PlayerReputations.RemoveAll([&FactionID](const FPlayerReputation& Reputation)
+    {
+        return Reputation.FactionID == FactionID;
+    });
+
+    // Removing records shifts the indices the cells point at, so rebuild rather than patch
+    RebuildRelationMatrix();
+}
+
+void UFactionDiplomacySystem::UpdateDiplomaticRelationship(const FString& FactionA, const FString& FactionB,
+                                                           int32 RelationshipChange, const FString& Reason)
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const int32 SlotA = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionA));
+    const int32 SlotB = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionB));
+    if (SlotA == INDEX_NONE || SlotB == INDEX_NONE || SlotA == SlotB)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionDiplomacySystem: Cannot update relationship %s - %s"), *FactionA, *FactionB);
+        return;
+    }
+
+    const FFactionRelationCell Cell = RelationMatrix.GetCell(SlotA, SlotB);
+    const EDiplomaticStance OldStance = Cell.Stance;
+    const int32 NewValue = FMath::Clamp(Cell.Value + RelationshipChange, -100, 100);
+
+    // Vassalage is set by treaties, not by relationship value
+    const EDiplomaticStance NewStance = OldStance == EDiplomaticStance::Vassal ? OldStance : CalculateDiplomaticStance(NewValue);
+    RelationMatrix.SetRelationship(SlotA, SlotB, NewValue, NewStance);
+
+    int32 RecordIndex = RelationMatrix.GetRecordIndex(SlotA, SlotB);
+    if (RecordIndex == INDEX_NONE)
+    {
+        FDiplomaticRelationship& NewRecord = DiplomaticRelationships.AddDefaulted_GetRef();
+        NewRecord.FactionA = FactionA;
+        NewRecord.FactionB = FactionB;
+        RecordIndex = DiplomaticRelationships.Num() - 1;
+        RelationMatrix.SetRecordIndex(SlotA, SlotB, RecordIndex);
+    }
+
+    FDiplomaticRelationship& Record = DiplomaticRelationships[RecordIndex];
+    Record.RelationshipValue = NewValue;
+    Record.Stance = NewStance;
+    Record.LastInteraction = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+    if (!Reason.IsEmpty())
+    {
+        Record.SharedHistory.Add(Reason);
+    }
+
+    if (NewStance != OldStance)
+    {
+        OnDiplomaticStanceChangedEvent(FactionA, FactionB, OldStance, NewStance);
+        OnDiplomaticStanceChanged.Broadcast(FactionA, FactionB);
+    }
+}
+
+void UFactionDiplomacySystem::UpdatePlayerReputation(const FString& FactionID, int32 ReputationChange, const FString& Source)
+{
+    FPlayerReputation* Reputation = FindPlayerReputation(FactionID);
+    if (!Reputation)
+    {
+        if (!FindFaction(FactionID))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FactionDiplomacySystem: Unknown faction %s"), *FactionID);
+            return;
+        }
+
+        Reputation = &PlayerReputations.AddDefaulted_GetRef();
+        Reputation->FactionID = FactionID;
+        Reputation->FactionSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID);
+    }
+
+    const int32 OldReputation = Reputation->ReputationValue;
+    Reputation->ReputationValue = FMath::Clamp(OldReputation + ReputationChange, -100, 100);
+    Reputation->ReputationTitle = CalculateReputationTitle(Reputation->ReputationValue);
+    if (!Source.IsEmpty())
+    {
+        Reputation->ReputationSources.Add(Source);
+    }
+
+    const int32 NewReputation = Reputation->ReputationValue;
+    if (NewReputation != OldReputation)
+    {
+        OnPlayerReputationChangedEvent(FactionID, OldReputation, NewReputation, Source);
+        OnPlayerReputationChanged.Broadcast(FactionID, NewReputation);
+    }
+}
+
+FString UFactionDiplomacySystem::ProposeDiplomaticAction(const FDiplomaticAction& Action)
+{
+    // Copy: listeners may propose further actions, and approving below removes the pending entry
+    FDiplomaticAction Proposed = Action;
+    if (Proposed.ActionID.IsEmpty())
+    {
+        Proposed.ActionID = GenerateActionID();
+    }
+
+    PendingActions.Add(Proposed);
+    OnDiplomaticActionProposed.Broadcast(Proposed);
+
+    if (!Proposed.bRequiresPlayerApproval)
+    {
+        ApproveDiplomaticAction(Proposed.ActionID, true);
+    }
+    return Proposed.ActionID;
+}
+
+void UFactionDiplomacySystem::ApproveDiplomaticAction(const FString& ActionID, bool bApproved)
+{
+    const FDiplomaticAction* Found = FindAction(ActionID);
+    if (!Found)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FactionDiplomacySystem: No pending action %s"), *ActionID);
+        return;
+    }
+
+    const FDiplomaticAction Action = *Found;
+    PendingActions.RemoveAll([&ActionID](const FDiplomaticAction& Pending)
+    {
+        return Pending.ActionID == ActionID;
+    });
+
+    if (!bApproved || ProcessCustomDiplomaticAction(Action))
+    {
+        return;
+    }
+
+    const FString Reason = FString::Printf(TEXT("%s between %s and %s"), *Action.ActionType, *Action.InitiatorFaction, *Action.TargetFaction);
+    UpdateDiplomaticRelationship(Action.InitiatorFaction, Action.TargetFaction, DefaultActionImpact(Action.ActionType), Reason);
+
+    if (FDiplomaticRelationship* Relationship = FindRelationship(Action.InitiatorFaction, Action.TargetFaction))
+    {
+        if (Action.ActionType == TEXT("war"))
+        {
+            Relationship->Treaties.Reset();
+            Relationship->Conflicts.Add(Reason);
+        }
+        else if (Action.ActionType == TEXT("peace"))
+        {
+            Relationship->Conflicts.Reset();
+        }
+        else if (Action.ActionType != TEXT("trade"))
+        {
+            Relationship->Treaties.Add(Action.ActionType);
+        }
+    }
+}
+
+FFactionData UFactionDiplomacySystem::GetFactionData(const FString& FactionID) const
+{
+    const FAIDMId FactionSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID);
+    const FFactionData* Faction = FactionSymbol.IsValid() ? Factions.FindByPredicate([FactionSymbol](const FFactionData& Candidate)
+    {
+        return Candidate.FactionSymbol == FactionSymbol;
+    }) : nullptr;
+    return Faction ? *Faction : FFactionData();
+}
+
+FDiplomaticRelationship UFactionDiplomacySystem::GetDiplomaticRelationship(const FString& FactionA, const FString& FactionB) const
+{
+    FDiplomaticRelationship Result;
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const int32 SlotA = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionA));
+    const int32 SlotB = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionB));
+    if (SlotA == INDEX_NONE || SlotB == INDEX_NONE)
+    {
+        Result.FactionA = FactionA;
+        Result.FactionB = FactionB;
+        return Result;
+    }
+
+    const int32 RecordIndex = RelationMatrix.GetRecordIndex(SlotA, SlotB);
+    if (DiplomaticRelationships.IsValidIndex(RecordIndex))
+    {
+        Result = DiplomaticRelationships[RecordIndex];
+    }
+
+    // The matrix is authoritative for stance and value (records lag during headless runs)
+    const FFactionRelationCell& Cell = RelationMatrix.GetCell(SlotA, SlotB);
+    Result.FactionA = FactionA;
+    Result.FactionB = FactionB;
+    Result.RelationshipValue = Cell.Value;
+    Result.Stance = Cell.Stance;
+    return Result;
+}
+
+FPlayerReputation UFactionDiplomacySystem::GetPlayerReputation(const FString& FactionID) const
+{
+    const FAIDMId FactionSymbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID);
+    const FPlayerReputation* Reputation = FactionSymbol.IsValid() ? PlayerReputations.FindByPredicate([FactionSymbol](const FPlayerReputation& Candidate)
+    {
+        return Candidate.FactionSymbol == FactionSymbol;
+    }) : nullptr;
+
+    if (Reputation)
+    {
+        return *Reputation;
+    }
+
+    FPlayerReputation Unknown;
+    Unknown.FactionID = FactionID;
+    return Unknown;
+}
+
+void UFactionDiplomacySystem::TransferTerritoryControl(const FString& Territory, const FString& FromFaction,
+                                                       const FString& ToFaction, const FString& Reason)
+{
+    if (Territory.IsEmpty() || ToFaction.IsEmpty())
+    {
+        return;
+    }
+
+    ApplyTerritoryTransfer(Territory, FromFaction, ToFaction);
+    OnTerritoryChanged.Broadcast(Territory, ToFaction);
+
+    UE_LOG(LogTemp, Log, TEXT("FactionDiplomacySystem: %s passed from %s to %s (%s)"),
+           *Territory, FromFaction.IsEmpty() ? TEXT("its controllers") : *FromFaction, *ToFaction, *Reason);
+}
+
+TArray<FString> UFactionDiplomacySystem::GetTerritoryControllers(const FString& Territory) const
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const TConstArrayView<FAIDMId> Controllers = TerritoryIndex.GetControllers(Symbols.Find(EAIDMSymbolKind::Planet, Territory));
+
+    TArray<FString> Result;
+    Result.Reserve(Controllers.Num());
+    for (const FAIDMId Controller : Controllers)
+    {
+        Result.Add(Symbols.ToString(EAIDMSymbolKind::Faction, Controller));
+    }
+    return Result;
+}
+
+int32 UFactionDiplomacySystem::GetFactionInfluenceOnPlanet(const FString& FactionID, const FString& Planet) const
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FAIDMId FactionSymbol = Symbols.Find(EAIDMSymbolKind::Faction, FactionID);
+    const FFactionData* Faction = FactionSymbol.IsValid() ? Factions.FindByPredicate([FactionSymbol](const FFactionData& Candidate)
+    {
+        return Candidate.FactionSymbol == FactionSymbol;
+    }) : nullptr;
+    if (!Faction || !Faction->bIsActive)
+    {
+        return 0;
+    }
+
+    // Full influence where the faction rules, shared when the planet is contested, half at home otherwise
+    const TConstArrayView<FAIDMId> Controllers = TerritoryIndex.GetControllers(Symbols.Find(EAIDMSymbolKind::Planet, Planet));
+    if (Controllers.Contains(FactionSymbol))
+    {
+        return Faction->Influence / Controllers.Num();
+    }
+    return Faction->HomePlanet == Planet ? Faction->Influence / 2 : 0;
+}
+
+bool UFactionDiplomacySystem::AreFactionsAtWar(const FString& FactionA, const FString& FactionB) const
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    return RelationMatrix.AreAtWar(Symbols.Find(EAIDMSymbolKind::Faction, FactionA), Symbols.Find(EAIDMSymbolKind::Faction, FactionB));
+}
+
+void UFactionDiplomacySystem::LoadFactionsFromCampaign()
+{
+    Factions.Reset();
+    TerritoryControl.Reset();
+    if (!CampaignLoaderRef)
+    {
+        return;
+    }
+
+    // Campaigns have no faction list; factions are the planet governments and the NPC factions
+    const FCampaignPlan& Campaign = CampaignLoaderRef->GetCurrentCampaign();
+    TMap<FString, int32> FactionIndices;
+
+    auto AddCampaignFaction = [this, &FactionIndices](const FString& FactionID, const FString& HomePlanet, EFactionType Type) -> FFactionData*
+    {
+        if (FactionID.IsEmpty())
+        {
+            return nullptr;
+        }
+        if (const int32* Existing = FactionIndices.Find(FactionID))
+        {
+            return &Factions[*Existing];
+        }
+
+        FactionIndices.Add(FactionID, Factions.Num());
+        FFactionData& Faction = Factions.AddDefaulted_GetRef();
+        Faction.FactionID = FactionID;
+        Faction.FactionName = FactionID;
+        Faction.HomePlanet = HomePlanet;
+        Faction.Type = Type;
+        return &Faction;
+    };
+
+    for (const FPlanetData& Planet : Campaign.Planets)
+    {
+        if (FFactionData* Government = AddCampaignFaction(Planet.Government, Planet.Name, EFactionType::Government))
+        {
+            Government->ControlledTerritories.AddUnique(Planet.Name);
+        }
+
+        for (const FNPCData& NPC : Planet.NPCs)
+        {
+            AddCampaignFaction(NPC.Faction, Planet.Name, EFactionType::Government);
+        }
+        for (const FCampaignEnemyData& Enemy : Planet.Enemies)
+        {
+            AddCampaignFaction(Enemy.Faction, Planet.Name, EFactionType::Criminal);
+        }
+    }
+
+    PlayerReputations.Reset();
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (const FFactionData& Faction : Factions)
+    {
+        FPlayerReputation& Reputation = PlayerReputations.AddDefaulted_GetRef();
+        Reputation.FactionID = Faction.FactionID;
+        Reputation.FactionSymbol = Symbols.Intern(EAIDMSymbolKind::Faction, Faction.FactionID);
+        Reputation.ReputationTitle = CalculateReputationTitle(Reputation.ReputationValue);
+    }
+}
+
+void UFactionDiplomacySystem::InitializeDiplomaticRelationships()
+{
+    DiplomaticRelationships.Reset();
+    DiplomaticRelationships.Reserve(Factions.Num() * (Factions.Num() - 1) / 2);
+
+    for (int32 IndexA = 0; IndexA < Factions.Num(); ++IndexA)
+    {
+        for (int32 IndexB = IndexA + 1; IndexB < Factions.Num(); ++IndexB)
+        {
+            FDiplomaticRelationship& Relationship = DiplomaticRelationships.AddDefaulted_GetRef();
+            Relationship.FactionA = Factions[IndexA].FactionID;
+            Relationship.FactionB = Factions[IndexB].FactionID;
+            Relationship.RelationshipValue = InitialRelationshipValue(Factions[IndexA].Type, Factions[IndexB].Type);
+            Relationship.Stance = CalculateDiplomaticStance(Relationship.RelationshipValue);
+        }
+    }
+}
+
+FFactionData* UFactionDiplomacySystem::FindFaction(const FString& FactionID)
+{
+    return FindFaction(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID));
+}
+
+FFactionData* UFactionDiplomacySystem::FindFaction(FAIDMId FactionSymbol)
+{
+    if (!FactionSymbol.IsValid())
+    {
+        return nullptr;
+    }
+
+    return Factions.FindByPredicate([FactionSymbol](const FFactionData& Faction)
+    {
+        return Faction.FactionSymbol == FactionSymbol;
+    });
+}
+
+FDiplomaticRelationship* UFactionDiplomacySystem::FindRelationship(const FString& FactionA, const FString& FactionB)
+{
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const int32 SlotA = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionA));
+    const int32 SlotB = RelationMatrix.FindSlot(Symbols.Find(EAIDMSymbolKind::Faction, FactionB));
+    if (SlotA == INDEX_NONE || SlotB == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    const int32 RecordIndex = RelationMatrix.GetRecordIndex(SlotA, SlotB);
+    return DiplomaticRelationships.IsValidIndex(RecordIndex) ? &DiplomaticRelationships[RecordIndex] : nullptr;
+}
+
+FPlayerReputation* UFactionDiplomacySystem::FindPlayerReputation(const FString& FactionID)
+{
+    return FindPlayerReputation(FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Faction, FactionID));
+}
+
+FPlayerReputation* UFactionDiplomacySystem::FindPlayerReputation(FAIDMId FactionSymbol)
+{
+    if (!FactionSymbol.IsValid())
+    {
+        return nullptr;
+    }
+
+    return PlayerReputations.FindByPredicate([FactionSymbol](const FPlayerReputation& Reputation)
+    {
+        return Reputation.FactionSymbol == FactionSymbol;
+    });
+}
+
+FDiplomaticAction* UFactionDiplomacySystem::FindAction(const FString& ActionID)
+{
+    return PendingActions.FindByPredicate([&ActionID](const FDiplomaticAction& Action)
+    {
+        return Action.ActionID == ActionID;
+    });
+}
+
+EDiplomaticStance UFactionDiplomacySystem::CalculateDiplomaticStance(int32 RelationshipValue) const
+{
+    if (RelationshipValue <= -60) return EDiplomaticStance::Hostile;
+    if (RelationshipValue <= -20) return EDiplomaticStance::Unfriendly;
+    if (RelationshipValue < 20) return EDiplomaticStance::Neutral;
+    if (RelationshipValue < 60) return EDiplomaticStance::Friendly;
+    return EDiplomaticStance::Allied;
+}
+
+FString UFactionDiplomacySystem::CalculateReputationTitle(int32 ReputationValue) const
+{
+    if (ReputationValue <= -60) return TEXT("Enemy");
+    if (ReputationValue <= -20) return TEXT("Distrusted");
+    if (ReputationValue < 20) return TEXT("Neutral");
+    if (ReputationValue < 60) return TEXT("Friend");
+    return TEXT("Hero");
+}
+
+void UFactionDiplomacySystem::ProcessAutomaticDiplomacy()
+{
+    if (!bAutomaticDiplomacy || Factions.Num() < 2)
+    {
+        return;
+    }
+
+    // One drift round through the matrix; stance changes are broadcast once per pair by End
+    BeginHeadlessSimulation();
+    StepDiplomacyHeadless(static_cast<uint32>(FMath::Rand()), 0);
+    EndHeadlessSimulation();
+}
+
+FString UFactionDiplomacySystem::GenerateActionID()
+{
+    return FString::Printf(TEXT("action_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+void UFactionDiplomacySystem::HandleSymbolsReset()
+{
+    // Rebuilding the matrix re-interns every faction and refreshes FFactionData::FactionSymbol
+    RebuildRelationMatrix();
+    RebuildTerritoryIndex();
+
+    FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    for (FPlayerReputation& Reputation : PlayerReputations)
+    {
+        Reputation.FactionSymbol = Symbols.Intern(EAIDMSymbolKind::Faction, Reputation.FactionID);
+    }
+}
+
+void UFactionDiplomacySystem::OnMemoryAdded(const FNarrativeMemory& Memory)
+{
+    // Memories tagged with a faction move the player's standing with it
+    const FString* FactionID = Memory.ContextData.Find(TEXT("Faction"));
+    const FString* ReputationChange = Memory.ContextData.Find(TEXT("ReputationChange"));
+    if (FactionID && ReputationChange)
+    {
+        UpdatePlayerReputation(*FactionID, FCString::Atoi(**ReputationChange), Memory.Title);
+    }
+}
@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Politics/FactionRelationMatrix.h"
+#include "Politics/FactionDiplomacySystem.h"
+
+namespace
+{
+    // Slots added per growth step, so adding factions one at a time does not re-layout every time
+    constexpr int32 SlotGrowth = 16;
+}
+
+void FFactionRelationMatrix::Reset()
+{
+    Stride = 0;
+    Cells.Reset();
+    RecordIndices.Reset();
+    SlotFactions.Reset();
+    SlotHashes.Reset();
+    SlotBySymbol.Reset();
+    FreeSlots.Reset();
+}
+
+int32 FFactionRelationMatrix::AddFaction(const FString& FactionID)
+{
+    const FAIDMId Faction = FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Faction, FactionID);
+    if (!Faction.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 ExistingSlot = FindSlot(Faction);
+    if (ExistingSlot != INDEX_NONE)
+    {
+        return ExistingSlot;
+    }
+
+    if (FreeSlots.Num() == 0)
+    {
+        const int32 OldStride = Stride;
+        Grow(Stride + SlotGrowth);
+        for (int32 Slot = Stride - 1; Slot >= OldStride; --Slot)
+        {
+            FreeSlots.Add(Slot);
+        }
+    }
+
+    const int32 Slot = FreeSlots.Pop(EAllowShrinking::No);
+    SlotFactions[Slot] = Faction;
+    SlotHashes[Slot] = GetTypeHash(FactionID);
+
+    while (SlotBySymbol.Num() <= Faction.Index)
+    {
+        SlotBySymbol.Add(INDEX_NONE);
+    }
+    SlotBySymbol[Faction.Index] = Slot;
+
+    ClearSlot(Slot);
+    return Slot;
+}
+
+void FFactionRelationMatrix::RemoveFaction(FAIDMId Faction)
+{
+    const int32 Slot = FindSlot(Faction);
+    if (Slot == INDEX_NONE)
+    {
+        return;
+    }
+
+    ClearSlot(Slot);
+    SlotFactions[Slot] = FAIDMId();
+    SlotHashes[Slot] = 0;
+    SlotBySymbol[Faction.Index] = INDEX_NONE;
+    FreeSlots.Add(Slot);
+}
+
+void FFactionRelationMatrix::SetRelationship(int32 SlotA, int32 SlotB, int32 Value, EDiplomaticStance Stance)
+{
+    FFactionRelationCell& Cell = Cells[CellIndex(SlotA, SlotB)];
+    Cell.Value = static_cast<int8>(FMath::Clamp(Value, -100, 100));
+    Cell.Stance = Stance;
+}
+
+void FFactionRelationMatrix::SetRecordIndex(int32 SlotA, int32 SlotB, int32 RecordIndex)
+{
+    RecordIndices[CellIndex(SlotA, SlotB)] = RecordIndex;
+}
+
+EDiplomaticStance FFactionRelationMatrix::GetStance(FAIDMId FactionA, FAIDMId FactionB) const
+{
+    const int32 SlotA = FindSlot(FactionA);
+    const int32 SlotB = FindSlot(FactionB);
+    return SlotA != INDEX_NONE && SlotB != INDEX_NONE ? GetCell(SlotA, SlotB).Stance : EDiplomaticStance::Neutral;
+}
+
+int32 FFactionRelationMatrix::GetValue(FAIDMId FactionA, FAIDMId FactionB) const
+{
+    const int32 SlotA = FindSlot(FactionA);
+    const int32 SlotB = FindSlot(FactionB);
+    return SlotA != INDEX_NONE && SlotB != INDEX_NONE ? GetCell(SlotA, SlotB).Value : 0;
+}
+
+bool FFactionRelationMatrix::AreAtWar(FAIDMId FactionA, FAIDMId FactionB) const
+{
+    return GetStance(FactionA, FactionB) == EDiplomaticStance::Hostile;
+}
+
+void FFactionRelationMatrix::Grow(int32 NewStride)
+{
+    TArray<FFactionRelationCell> NewCells;
+    TArray<int32> NewRecordIndices;
+    NewCells.SetNumZeroed(NewStride * NewStride);
+    NewRecordIndices.Init(INDEX_NONE, NewStride * NewStride);
+
+    for (int32 Row = 0; Row < Stride; ++Row)
+    {
+        FMemory::Memcpy(NewCells.GetData() + Row * NewStride, Cells.GetData() + Row * Stride, Stride * sizeof(FFactionRelationCell));
+        FMemory::Memcpy(NewRecordIndices.GetData() + Row * NewStride, RecordIndices.GetData() + Row * Stride, Stride * sizeof(int32));
+    }
+
+    Cells = MoveTemp(NewCells);
+    RecordIndices = MoveTemp(NewRecordIndices);
+    SlotFactions.SetNum(NewStride);
+    SlotHashes.SetNumZeroed(NewStride);
+    Stride = NewStride;
+}
+
+void FFactionRelationMatrix::ClearSlot(int32 Slot)
+{
+    for (int32 Other = 0; Other < Stride; ++Other)
+    {
+        const int32 Index = CellIndex(Slot, Other);
+        Cells[Index].Value = 0;
+        Cells[Index].Stance = EDiplomaticStance::Neutral;
+        RecordIndices[Index] = INDEX_NONE;
+    }
+
+    // A faction is always allied with itself
+    Cells[CellIndex(Slot, Slot)].Value = 100;
+    Cells[CellIndex(Slot, Slot)].Stance = EDiplomaticStance::Allied;
+}
@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Politics/TerritoryControlIndex.h"
+
+void FTerritoryControlIndex::Reset()
+{
+    ControllersByTerritory.Reset();
+    TerritoriesByFaction.Reset();
+}
+
+void FTerritoryControlIndex::AddControl(FAIDMId Territory, FAIDMId Faction)
+{
+    if (!Territory.IsValid() || !Faction.IsValid())
+    {
+        return;
+    }
+
+    ControllersByTerritory.FindOrAdd(Territory).AddUnique(Faction);
+    TerritoriesByFaction.FindOrAdd(Faction).AddUnique(Territory);
+}
+
+void FTerritoryControlIndex::RemoveControl(FAIDMId Territory, FAIDMId Faction)
+{
+    if (auto* Controllers = ControllersByTerritory.Find(Territory))
+    {
+        // Stable removal keeps the primary controller first
+        Controllers->Remove(Faction);
+        if (Controllers->Num() == 0)
+        {
+            ControllersByTerritory.Remove(Territory);
+        }
+    }
+
+    if (auto* Territories = TerritoriesByFaction.Find(Faction))
+    {
+        Territories->RemoveSwap(Territory);
+        if (Territories->Num() == 0)
+        {
+            TerritoriesByFaction.Remove(Faction);
+        }
+    }
+}
+
+void FTerritoryControlIndex::SetController(FAIDMId Territory, FAIDMId Faction)
+{
+    if (!Territory.IsValid())
+    {
+        return;
+    }
+
+    if (auto* Controllers = ControllersByTerritory.Find(Territory))
+    {
+        for (const FAIDMId PreviousController : *Controllers)
+        {
+            if (PreviousController == Faction)
+            {
+                continue;
+            }
+
+            if (auto* Territories = TerritoriesByFaction.Find(PreviousController))
+            {
+                Territories->RemoveSwap(Territory);
+                if (Territories->Num() == 0)
+                {
+                    TerritoriesByFaction.Remove(PreviousController);
+                }
+            }
+        }
+
+        Controllers->Reset();
+    }
+
+    if (Faction.IsValid())
+    {
+        AddControl(Territory, Faction);
+    }
+    else
+    {
+        ControllersByTerritory.Remove(Territory);
+    }
+}
+
+void FTerritoryControlIndex::RemoveFaction(FAIDMId Faction)
+{
+    TArray<FAIDMId, TInlineAllocator<8>> Territories;
+    if (!TerritoriesByFaction.RemoveAndCopyValue(Faction, Territories))
+    {
+        return;
+    }
+
+    for (const FAIDMId Territory : Territories)
+    {
+        if (auto* Controllers = ControllersByTerritory.Find(Territory))
+        {
+            Controllers->Remove(Faction);
+            if (Controllers->Num() == 0)
+            {
+                ControllersByTerritory.Remove(Territory);
+            }
+        }
+    }
+}
+
+TConstArrayView<FAIDMId> FTerritoryControlIndex::GetControllers(FAIDMId Territory) const
+{
+    const auto* Controllers = ControllersByTerritory.Find(Territory);
+    return Controllers ? TConstArrayView<FAIDMId>(*Controllers) : TConstArrayView<FAIDMId>();
+}
+
+TConstArrayView<FAIDMId> FTerritoryControlIndex::GetTerritories(FAIDMId Faction) const
+{
+    const auto* Territories = TerritoriesByFaction.Find(Faction);
+    return Territories ? TConstArrayView<FAIDMId>(*Territories) : TConstArrayView<FAIDMId>();
+}
+
+FAIDMId FTerritoryControlIndex::GetPrimaryController(FAIDMId Territory) const
+{
+    const TConstArrayView<FAIDMId> Controllers = GetControllers(Territory);
+    return Controllers.Num() > 0 ? Controllers[0] : FAIDMId();
+}
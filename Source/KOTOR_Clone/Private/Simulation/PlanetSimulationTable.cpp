@@ -0,0 +1,530 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/PlanetSimulationTable.h"
+#include "Simulation/WorldStateSimulator.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/Crc.h"
+
+namespace
+{
+    // Fraction of the gap to the target closed per in-game hour
+    constexpr float DriftPerHour = 0.05f;
+
+    // Relative population change per hour at the extremes of economy + morale
+    constexpr float PopulationGrowthPerHour = 0.0005f;
+
+    // Indexed by EPlanetState
+    constexpr float PoliticalSecurityBaseline[] = { 0.8f, 0.6f, 0.4f, 0.25f, 0.5f, 0.55f, 0.2f, 0.45f };
+    constexpr float PoliticalEconomyPressure[]  = { 0.0f, 0.05f, 0.15f, 0.3f, 0.15f, 0.05f, 0.35f, 0.1f };
+    constexpr float PoliticalMoralePressure[]   = { 0.0f, 0.05f, 0.15f, 0.25f, 0.3f, -0.1f, 0.35f, 0.0f };
+
+    // Indexed by EWeatherPattern
+    constexpr float WeatherEconomyPressure[] = { 0.0f, 0.05f, 0.15f, 0.1f, 0.1f, 0.1f, 0.05f, 0.15f };
+    constexpr float WeatherMoralePressure[]  = { 0.0f, 0.03f, 0.08f, 0.08f, 0.1f, 0.08f, 0.05f, 0.12f };
+
+    EEconomicState ClassifyEconomy(EEconomicState Current, float Economy)
+    {
+        // Embargo, black market and rationing are imposed by events and only lifted by them
+        if (Current == EEconomicState::Embargo || Current == EEconomicState::BlackMarket || Current == EEconomicState::Rationing)
+        {
+            return Current;
+        }
+
+        if (Economy >= 0.8f) return EEconomicState::Prosperous;
+        if (Economy >= 0.55f) return EEconomicState::Stable;
+        if (Economy >= 0.35f) return EEconomicState::Struggling;
+        if (Economy >= 0.15f) return EEconomicState::Recession;
+        return EEconomicState::Collapse;
+    }
+}
+
+void PlanetSimulationKernels::UpdateEconomy(float* RESTRICT Economy, const float* RESTRICT Security, const float* RESTRICT Morale,
+                                            const float* RESTRICT EconomyPressure, int32 Num, float Alpha)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const float Target = FMath::Clamp(0.25f + 0.45f * Security[Index] + 0.3f * Morale[Index] - EconomyPressure[Index], 0.0f, 1.0f);
+        Economy[Index] = FMath::Clamp(Economy[Index] + (Target - Economy[Index]) * Alpha, 0.0f, 1.0f);
+    }
+}
+
+void PlanetSimulationKernels::UpdateSecurity(float* RESTRICT Security, const float* RESTRICT SecurityBaseline, const float* RESTRICT Morale,
+                                             int32 Num, float Alpha)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const float Target = FMath::Clamp(SecurityBaseline[Index] + 0.2f * (Morale[Index] - 0.5f), 0.0f, 1.0f);
+        Security[Index] = FMath::Clamp(Security[Index] + (Target - Security[Index]) * Alpha, 0.0f, 1.0f);
+    }
+}
+
+void PlanetSimulationKernels::UpdateMorale(float* RESTRICT Morale, const float* RESTRICT Economy, const float* RESTRICT Security,
+                                           const float* RESTRICT MoralePressure, int32 Num, float Alpha)
+{
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const float Target = FMath::Clamp(0.2f + 0.5f * Economy[Index] + 0.3f * Security[Index] - MoralePressure[Index], 0.0f, 1.0f);
+        Morale[Index] = FMath::Clamp(Morale[Index] + (Target - Morale[Index]) * Alpha, 0.0f, 1.0f);
+    }
+}
+
+void PlanetSimulationKernels::UpdatePopulation(float* RESTRICT Population, const float* RESTRICT Economy, const float* RESTRICT Morale,
+                                               int32 Num, float DeltaHours)
+{
+    const float Scale = PopulationGrowthPerHour * DeltaHours;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const float Growth = (Economy[Index] + Morale[Index] - 1.0f) * Scale;
+        Population[Index] = FMath::Max(Population[Index] * (1.0f + Growth), 0.0f);
+    }
+}
+
+FPlanetStateEffect FPlanetStateEffect::FromStateChanges(const TMap<FString, float>& StateChanges)
+{
+    FPlanetStateEffect Effect;
+    for (const TPair<FString, float>& Change : StateChanges)
+    {
+        if (Change.Key == TEXT("Economy") || Change.Key == TEXT("ResourceAvailability"))
+        {
+            Effect.Economy += Change.Value;
+        }
+        else if (Change.Key == TEXT("Security") || Change.Key == TEXT("SecurityLevel"))
+        {
+            Effect.Security += Change.Value;
+        }
+        else if (Change.Key == TEXT("Morale") || Change.Key == TEXT("CivilianMorale"))
+        {
+            Effect.Morale += Change.Value;
+        }
+        else if (Change.Key == TEXT("Population"))
+        {
+            Effect.Population += Change.Value;
+        }
+    }
+    return Effect;
+}
+
+void FPlanetSimulationTable::Reset()
+{
+    Economy.Reset();
+    Security.Reset();
+    Morale.Reset();
+    Population.Reset();
+    SecurityBaseline.Reset();
+    EconomyPressure.Reset();
+    MoralePressure.Reset();
+    PoliticalState.Reset();
+    EconomicCondition.Reset();
+    WeatherCondition.Reset();
+    LastUpdateTime.Reset();
+    RowSeeds.Reset();
+    Names.Reset();
+    Symbols.Reset();
+    ControllingFaction.Reset();
+    PriceModifiers.Reset();
+    ActiveEvents.Reset();
+    RecentHistory.Reset();
+    RowBySymbol.Reset();
+}
+
+int32 FPlanetSimulationTable::AddPlanet(const FPlanetWorldState& State)
+{
+    return AddPlanet(State, FAIDMSymbolTable::Get().Intern(EAIDMSymbolKind::Planet, State.PlanetName));
+}
+
+int32 FPlanetSimulationTable::AddPlanet(const FPlanetWorldState& State, FAIDMId Symbol)
+{
+    if (const int32* ExistingRow = RowBySymbol.Find(Symbol))
+    {
+        SetRow(*ExistingRow, State);
+        return *ExistingRow;
+    }
+
+    const int32 Row = Names.Add(State.PlanetName);
+    Symbols.Add(Symbol);
+    ControllingFaction.Add(State.ControllingFaction);
+    PriceModifiers.Add(State.PriceModifiers);
+    ActiveEvents.Add(State.ActiveEvents);
+    RecentHistory.Add(State.RecentHistory);
+
+    Economy.Add(State.ResourceAvailability);
+    Security.Add(State.SecurityLevel);
+    Morale.Add(State.CivilianMorale);
+    Population.Add(State.Population);
+    SecurityBaseline.AddZeroed();
+    EconomyPressure.AddZeroed();
+    MoralePressure.AddZeroed();
+    PoliticalState.Add(State.PoliticalState);
+    EconomicCondition.Add(State.EconomicCondition);
+    WeatherCondition.Add(State.WeatherCondition);
+    LastUpdateTime.Add(State.LastUpdateTime);
+    RowSeeds.Add(GetTypeHash(State.PlanetName));
+
+    RefreshModifiers(Row);
+
+    if (Symbol.IsValid())
+    {
+        RowBySymbol.Add(Symbol, Row);
+    }
+
+    return Row;
+}
+
+int32 FPlanetSimulationTable::FindRow(FAIDMId PlanetSymbol) const
+{
+    const int32* Row = RowBySymbol.Find(PlanetSymbol);
+    return Row ? *Row : INDEX_NONE;
+}
+
+int32 FPlanetSimulationTable::FindRow(const FString& PlanetName) const
+{
+    // A name that was never interned cannot be in the table
+    const FAIDMId Symbol = FAIDMSymbolTable::Get().Find(EAIDMSymbolKind::Planet, PlanetName);
+    return Symbol.IsValid() ? FindRow(Symbol) : INDEX_NONE;
+}
+
+FPlanetWorldState FPlanetSimulationTable::GetRow(int32 Row) const
+{
+    FPlanetWorldState State;
+    if (!Names.IsValidIndex(Row))
+    {
+        return State;
+    }
+
+    State.PlanetName = Names[Row];
+    State.PlanetSymbol = Symbols[Row];
+    State.ControllingFaction = ControllingFaction[Row];
+    State.PoliticalState = PoliticalState[Row];
+    State.EconomicCondition = EconomicCondition[Row];
+    State.WeatherCondition = WeatherCondition[Row];
+    State.CivilianMorale = Morale[Row];
+    State.ResourceAvailability = Economy[Row];
+    State.SecurityLevel = Security[Row];
+    State.Population = Population[Row];
+    State.PriceModifiers = PriceModifiers[Row];
+    State.ActiveEvents = ActiveEvents[Row];
+    State.RecentHistory = RecentHistory[Row];
+    State.LastUpdateTime = LastUpdateTime[Row];
+    return State;
+}
+
+TArray<FPlanetWorldState> FPlanetSimulationTable::GetAllRows() const
+{
+    TArray<FPlanetWorldState> States;
+    States.Reserve(Num());
+    for (int32 Row = 0; Row < Num(); ++Row)
+    {
+        States.Add(GetRow(Row));
+    }
+    return States;
+}
+
+void FPlanetSimulationTable::SetRow(int32 Row, const FPlanetWorldState& State)
+{
+    if (!Names.IsValidIndex(Row))
+    {
+        return;
+    }
+
+    ControllingFaction[Row] = State.ControllingFaction;
+    PriceModifiers[Row] = State.PriceModifiers;
+    ActiveEvents[Row] = State.ActiveEvents;
+    RecentHistory[Row] = State.RecentHistory;
+
+    Economy[Row] = State.ResourceAvailability;
+    Security[Row] = State.SecurityLevel;
+    Morale[Row] = State.CivilianMorale;
+    Population[Row] = State.Population;
+    PoliticalState[Row] = State.PoliticalState;
+    EconomicCondition[Row] = State.EconomicCondition;
+    WeatherCondition[Row] = State.WeatherCondition;
+    LastUpdateTime[Row] = State.LastUpdateTime;
+
+    RefreshModifiers(Row);
+}
+
+void FPlanetSimulationTable::ApplyEffect(int32 Row, const FPlanetStateEffect& Effect)
+{
+    if (!Names.IsValidIndex(Row))
+    {
+        return;
+    }
+
+    Economy[Row] = FMath::Clamp(Economy[Row] + Effect.Economy, 0.0f, 1.0f);
+    Security[Row] = FMath::Clamp(Security[Row] + Effect.Security, 0.0f, 1.0f);
+    Morale[Row] = FMath::Clamp(Morale[Row] + Effect.Morale, 0.0f, 1.0f);
+    Population[Row] = FMath::Max(Population[Row] * (1.0f + Effect.Population), 0.0f);
+}
+
+void FPlanetSimulationTable::AddHistory(int32 Row, const FString& Entry)
+{
+    if (!RecentHistory.IsValidIndex(Row))
+    {
+        return;
+    }
+
+    TArray<FString>& History = RecentHistory[Row];
+    History.Add(Entry);
+    if (History.Num() > MaxRecentHistory)
+    {
+        History.RemoveAt(0, History.Num() - MaxRecentHistory);
+    }
+}
+
+void FPlanetSimulationTable::RefreshSymbols()
+{
+    RowBySymbol.Reset();
+
+    FAIDMSymbolTable& SymbolTable = FAIDMSymbolTable::Get();
+    for (int32 Row = 0; Row < Num(); ++Row)
+    {
+        Symbols[Row] = SymbolTable.Intern(EAIDMSymbolKind::Planet, Names[Row]);
+        if (Symbols[Row].IsValid())
+        {
+            RowBySymbol.Add(Symbols[Row], Row);
+        }
+    }
+}
+
+void FPlanetSimulationTable::SetPoliticalState(int32 Row, EPlanetState NewState)
+{
+    if (PoliticalState.IsValidIndex(Row))
+    {
+        PoliticalState[Row] = NewState;
+        RefreshModifiers(Row);
+    }
+}
+
+void FPlanetSimulationTable::SetWeather(int32 Row, EWeatherPattern NewWeather)
+{
+    if (WeatherCondition.IsValidIndex(Row))
+    {
+        WeatherCondition[Row] = NewWeather;
+        RefreshModifiers(Row);
+    }
+}
+
+void FPlanetSimulationTable::Step(const FPlanetSimulationStepParams& Params, TConstArrayView<FPlanetEffectSource> Effects, FPlanetSimulationStepResult& OutResult)
+{
+    OutResult.ChangedRows.Reset();
+    OutResult.EventRolls.Reset();
+
+    const int32 NumRows = Num();
+    if (NumRows == 0 || Params.DeltaHours <= 0.0f)
+    {
+        return;
+    }
+
+    // Group effects by row (CSR), keeping event order within each row so the sums are order-stable
+    EffectOffsets.Reset();
+    EffectOffsets.SetNumZeroed(NumRows + 1);
+    for (const FPlanetEffectSource& Source : Effects)
+    {
+        for (const int32 Row : Source.Rows)
+        {
+            if (Row >= 0 && Row < NumRows)
+            {
+                ++EffectOffsets[Row + 1];
+            }
+        }
+    }
+
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        EffectOffsets[Row + 1] += EffectOffsets[Row];
+    }
+
+    EffectIndices.SetNumUninitialized(EffectOffsets[NumRows], EAllowShrinking::No);
+    for (int32 SourceIndex = 0; SourceIndex < Effects.Num(); ++SourceIndex)
+    {
+        for (const int32 Row : Effects[SourceIndex].Rows)
+        {
+            if (Row >= 0 && Row < NumRows)
+            {
+                EffectIndices[EffectOffsets[Row]++] = SourceIndex;
+            }
+        }
+    }
+
+    // The fill advanced every offset to the start of the next row; shift back
+    for (int32 Row = NumRows; Row > 0; --Row)
+    {
+        EffectOffsets[Row] = EffectOffsets[Row - 1];
+    }
+    EffectOffsets[0] = 0;
+
+    ConditionChanged.SetNumUninitialized(NumRows, EAllowShrinking::No);
+    EventSelectors.SetNumUninitialized(NumRows, EAllowShrinking::No);
+
+    // Blocks only touch their own rows, so they can run in any order on any thread
+    const int32 NumBlocks = FMath::DivideAndRoundUp(NumRows, RowsPerBlock);
+    ParallelFor(NumBlocks, [this, &Params, Effects](int32 BlockIndex)
+    {
+        StepBlock(BlockIndex, Params, Effects);
+    }, Params.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    for (int32 Row = 0; Row < NumRows; ++Row)
+    {
+        if (ConditionChanged[Row])
+        {
+            OutResult.ChangedRows.Add(Row);
+        }
+
+        if (EventSelectors[Row] >= 0.0f)
+        {
+            FPlanetEventRoll& Roll = OutResult.EventRolls.AddDefaulted_GetRef();
+            Roll.Row = Row;
+            Roll.Selector = EventSelectors[Row];
+        }
+    }
+}
+
+void FPlanetSimulationTable::StepBlock(int32 BlockIndex, const FPlanetSimulationStepParams& Params, TConstArrayView<FPlanetEffectSource> Effects)
+{
+    const int32 Begin = BlockIndex * RowsPerBlock;
+    const int32 Count = FMath::Min(RowsPerBlock, Num() - Begin);
+    const int32 End = Begin + Count;
+
+    for (int32 Row = Begin; Row < End; ++Row)
+    {
+        for (int32 Index = EffectOffsets[Row]; Index < EffectOffsets[Row + 1]; ++Index)
+        {
+            const FPlanetStateEffect& Effect = Effects[EffectIndices[Index]].Effect;
+            Economy[Row] += Effect.Economy;
+            Security[Row] += Effect.Security;
+            Morale[Row] += Effect.Morale;
+            Population[Row] *= 1.0f + Effect.Population;
+        }
+
+        Economy[Row] = FMath::Clamp(Economy[Row], 0.0f, 1.0f);
+        Security[Row] = FMath::Clamp(Security[Row], 0.0f, 1.0f);
+        Morale[Row] = FMath::Clamp(Morale[Row], 0.0f, 1.0f);
+        Population[Row] = FMath::Max(Population[Row], 0.0f);
+    }
+
+    // Same order the per-planet update used: economy, then security, then morale
+    const float Alpha = FMath::Clamp(Params.DeltaHours * DriftPerHour, 0.0f, 1.0f);
+    PlanetSimulationKernels::UpdateEconomy(Economy.GetData() + Begin, Security.GetData() + Begin, Morale.GetData() + Begin, EconomyPressure.GetData() + Begin, Count, Alpha);
+    PlanetSimulationKernels::UpdateSecurity(Security.GetData() + Begin, SecurityBaseline.GetData() + Begin, Morale.GetData() + Begin, Count, Alpha);
+    PlanetSimulationKernels::UpdateMorale(Morale.GetData() + Begin, Economy.GetData() + Begin, Security.GetData() + Begin, MoralePressure.GetData() + Begin, Count, Alpha);
+    PlanetSimulationKernels::UpdatePopulation(Population.GetData() + Begin, Economy.GetData() + Begin, Morale.GetData() + Begin, Count, Params.DeltaHours);
+
+    const uint32 StepSeed = HashCombineFast(Params.Seed, Params.StepIndex);
+    for (int32 Row = Begin; Row < End; ++Row)
+    {
+        const EEconomicState NewCondition = ClassifyEconomy(EconomicCondition[Row], Economy[Row]);
+        ConditionChanged[Row] = NewCondition != EconomicCondition[Row];
+        EconomicCondition[Row] = NewCondition;
+        LastUpdateTime[Row] = Params.CurrentTime;
+
+        // Unstable planets see more incidents
+        FRandomStream Stream(static_cast<int32>(HashCombineFast(StepSeed, RowSeeds[Row])));
+        const float Chance = FMath::Clamp(Params.EventChancePerHour * Params.DeltaHours * (1.5f - Security[Row]), 0.0f, 1.0f);
+        const float Roll = Stream.FRand();
+        const float Selector = Stream.FRand();
+        EventSelectors[Row] = Roll < Chance ? Selector : -1.0f;
+    }
+}
+
+uint32 FPlanetSimulationTable::ComputeChecksum() const
+{
+    uint32 Crc = 0;
+    Crc = FCrc::MemCrc32(Economy.GetData(), Economy.Num() * sizeof(float), Crc);
+    Crc = FCrc::MemCrc32(Security.GetData(), Security.Num() * sizeof(float), Crc);
+    Crc = FCrc::MemCrc32(Morale.GetData(), Morale.Num() * sizeof(float), Crc);
+    Crc = FCrc::MemCrc32(Population.GetData(), Population.Num() * sizeof(float), Crc);
+    Crc = FCrc::MemCrc32(EconomicCondition.GetData(), EconomicCondition.Num() * sizeof(EEconomicState), Crc);
+    return Crc;
+}
+
+void FPlanetSimulationTable::RefreshModifiers(int32 Row)
+{
+    const int32 PoliticalIndex = FMath::Clamp<int32>(static_cast<int32>(PoliticalState[Row]), 0, UE_ARRAY_COUNT(PoliticalSecurityBaseline) - 1);
+    const int32 WeatherIndex = FMath::Clamp<int32>(static_cast<int32>(WeatherCondition[Row]), 0, UE_ARRAY_COUNT(WeatherEconomyPressure) - 1);
+
+    SecurityBaseline[Row] = PoliticalSecurityBaseline[PoliticalIndex];
+    EconomyPressure[Row] = PoliticalEconomyPressure[PoliticalIndex] + WeatherEconomyPressure[WeatherIndex];
+    MoralePressure[Row] = PoliticalMoralePressure[PoliticalIndex] + WeatherMoralePressure[WeatherIndex];
+}
+
+namespace
+{
+    // Steps two copies of a synthetic galaxy serially and in parallel and compares the results bit for bit
+    void VerifySimulationDeterminism(const TArray<FString>& Args)
+    {
+        const int32 NumSteps = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+        const int32 NumPlanets = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 10000;
+
+        // Anonymous rows: the check must not flood the campaign symbol table
+        FPlanetSimulationTable SerialTable;
+        FRandomStream Stream(0x91A7);
+        for (int32 PlanetIndex = 0; PlanetIndex < NumPlanets; ++PlanetIndex)
+        {
+            FPlanetWorldState State;
+            State.PlanetName = FString::Printf(TEXT("planet_%d"), PlanetIndex);
+            State.PoliticalState = static_cast<EPlanetState>(Stream.RandRange(0, static_cast<int32>(EPlanetState::Rebuilding)));
+            State.WeatherCondition = static_cast<EWeatherPattern>(Stream.RandRange(0, static_cast<int32>(EWeatherPattern::Radiation)));
+            State.ResourceAvailability = Stream.FRand();
+            State.SecurityLevel = Stream.FRand();
+            State.CivilianMorale = Stream.FRand();
+            State.Population = Stream.FRandRange(1.0f, 5000.0f);
+            SerialTable.AddPlanet(State, FAIDMId());
+        }
+
+        FPlanetSimulationTable ParallelTable = SerialTable;
+
+        // A recurring event over every third planet exercises the effect merge
+        TArray<FPlanetEffectSource> Effects;
+        FPlanetEffectSource& Source = Effects.AddDefaulted_GetRef();
+        Source.Effect.Economy = -0.01f;
+        Source.Effect.Morale = 0.005f;
+        for (int32 Row = 0; Row < SerialTable.Num(); Row += 3)
+        {
+            Source.Rows.Add(Row);
+        }
+
+        FPlanetSimulationStepParams Params;
+        Params.Seed = 0x5EED;
+        Params.EventChancePerHour = 0.01f;
+
+        auto RunSteps = [&Params, &Effects, NumSteps](FPlanetSimulationTable& Table, bool bParallel, int32& OutNumRolls)
+        {
+            FPlanetSimulationStepResult Result;
+            FPlanetSimulationStepParams StepParams = Params;
+            StepParams.bParallel = bParallel;
+            OutNumRolls = 0;
+
+            const double StartTime = FPlatformTime::Seconds();
+            for (int32 Step = 0; Step < NumSteps; ++Step)
+            {
+                StepParams.StepIndex = Step;
+                StepParams.CurrentTime = Step * StepParams.DeltaHours;
+                Table.Step(StepParams, Effects, Result);
+                OutNumRolls += Result.EventRolls.Num();
+            }
+            return FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+        };
+
+        int32 SerialRolls = 0;
+        int32 ParallelRolls = 0;
+        const double SerialSeconds = RunSteps(SerialTable, false, SerialRolls);
+        const double ParallelSeconds = RunSteps(ParallelTable, true, ParallelRolls);
+
+        const uint32 SerialChecksum = SerialTable.ComputeChecksum();
+        const uint32 ParallelChecksum = ParallelTable.ComputeChecksum();
+        const bool bMatch = SerialChecksum == ParallelChecksum && SerialRolls == ParallelRolls;
+
+        UE_LOG(LogTemp, Display, TEXT("WorldSim.VerifyDeterminism: %d planets x %d steps, serial %.0f steps/s, parallel %.0f steps/s"),
+               SerialTable.Num(), NumSteps, NumSteps / SerialSeconds, NumSteps / ParallelSeconds);
+        UE_LOG(LogTemp, Display, TEXT("WorldSim.VerifyDeterminism: checksum %08x vs %08x, %d vs %d event rolls - %s"),
+               SerialChecksum, ParallelChecksum, SerialRolls, ParallelRolls, bMatch ? TEXT("MATCH") : TEXT("MISMATCH"));
+    }
+
+    FAutoConsoleCommand VerifyDeterminismCommand(
+        TEXT("WorldSim.VerifyDeterminism"),
+        TEXT("Step copies of a synthetic galaxy serially and in parallel and check the results are bit-identical. Usage: WorldSim.VerifyDeterminism [Steps=1000] [Planets=10000]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&VerifySimulationDeterminism));
+}
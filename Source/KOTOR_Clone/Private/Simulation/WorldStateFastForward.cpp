@@ -0,0 +1,222 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// Headless fast-forward for UWorldStateSimulator
+
+#include "Simulation/WorldStateSimulator.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    // Simulated values of every planet before a fast-forward, to find the planets it changed
+    struct FPlanetValuesSnapshot
+    {
+        TArray<float> Economy;
+        TArray<float> Security;
+        TArray<float> Morale;
+        TArray<float> Population;
+        TArray<EPlanetState> PoliticalState;
+        TArray<EEconomicState> EconomicCondition;
+        TArray<EWeatherPattern> WeatherCondition;
+
+        explicit FPlanetValuesSnapshot(const FPlanetSimulationTable& Table)
+            : Economy(Table.Economy)
+            , Security(Table.Security)
+            , Morale(Table.Morale)
+            , Population(Table.Population)
+            , PoliticalState(Table.PoliticalState)
+            , EconomicCondition(Table.EconomicCondition)
+            , WeatherCondition(Table.WeatherCondition)
+        {
+        }
+
+        // LastUpdateTime is left out: every step stamps it
+        void MarkChangedRows(const FPlanetSimulationTable& Table, TBitArray<>& DirtyRows) const
+        {
+            for (int32 Row = 0; Row < Economy.Num(); ++Row)
+            {
+                DirtyRows[Row] |= Economy[Row] != Table.Economy[Row] || Security[Row] != Table.Security[Row] ||
+                    Morale[Row] != Table.Morale[Row] || Population[Row] != Table.Population[Row] ||
+                    PoliticalState[Row] != Table.PoliticalState[Row] || EconomicCondition[Row] != Table.EconomicCondition[Row] ||
+                    WeatherCondition[Row] != Table.WeatherCondition[Row];
+            }
+        }
+    };
+}
+
+FWorldFastForwardReport UWorldStateSimulator::FastForward(float Days)
+{
+    FWorldFastForwardReport Report;
+
+    if (bFastForwarding || Days <= 0.0f || PlanetTable.Num() == 0)
+    {
+        return Report;
+    }
+
+    const float StepHours = FMath::Max(UpdateInterval, 0.01f);
+    const int32 NumSteps = FMath::CeilToInt(Days * 24.0f / StepHours);
+    TBitArray<> DirtyRows(false, PlanetTable.Num());
+    const FPlanetValuesSnapshot ValuesBefore(PlanetTable);
+
+    {
+        TGuardValue<bool> FastForwardGuard(bFastForwarding, true);
+
+        if (FactionSystemRef)
+        {
+            FactionSystemRef->BeginHeadlessSimulation();
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 Step = 0; Step < NumSteps; ++Step)
+        {
+            StepHeadless(StepHours, DirtyRows, Report);
+        }
+
+        Report.WallSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+        Report.StepsPerSecond = Report.StepsSimulated / FMath::Max(Report.WallSeconds, UE_SMALL_NUMBER);
+    }
+
+    // Steps only flag condition changes and event starts/expiries; drift in the values counts too
+    ValuesBefore.MarkChangedRows(PlanetTable, DirtyRows);
+
+    // Batched notifications: each changed planet and faction pair once, with its final state
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->EndHeadlessSimulation();
+    }
+
+    // The view still holds the pre-fast-forward states; keep them for the Blueprint event
+    const TArray<FPlanetWorldState> OldStates = MoveTemp(PlanetStates);
+    RefreshPlanetStatesView();
+
+    for (TConstSetBitIterator<> It(DirtyRows); It; ++It)
+    {
+        const int32 Row = It.GetIndex();
+        const FPlanetWorldState NewState = PlanetStates[Row]; // Copy: listeners may refresh the view
+        OnPlanetStateChangedEvent(NewState.PlanetName, OldStates.IsValidIndex(Row) ? OldStates[Row] : NewState, NewState);
+        OnPlanetStateChanged.Broadcast(NewState);
+        ++Report.PlanetsChanged;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("WorldStateSimulator: Fast-forwarded %.1f days (%d steps) in %.3fs, %.0f steps/s, %d planets changed, %d events"),
+           Report.SimulatedHours / 24.0f, Report.StepsSimulated, Report.WallSeconds, Report.StepsPerSecond,
+           Report.PlanetsChanged, Report.EventsTriggered);
+
+    OnWorldFastForwardCompleted.Broadcast(Report);
+    return Report;
+}
+
+void UWorldStateSimulator::StepHeadless(float DeltaHours, TBitArray<>& DirtyRows, FWorldFastForwardReport& Report)
+{
+    Report.EventsExpired += ExpireFinishedEvents(DirtyRows);
+
+    BuildEventEffects(DeltaHours, EffectScratch);
+
+    const FPlanetSimulationStepParams Params = MakeStepParams(DeltaHours);
+    PlanetTable.Step(Params, EffectScratch, StepResultScratch);
+    ++SimulationStepIndex; // The clock now reads the end of this step
+
+    for (const int32 Row : StepResultScratch.ChangedRows)
+    {
+        DirtyRows[Row] = true;
+    }
+
+    Report.EventsTriggered += StartRolledEvents(StepResultScratch.EventRolls, DirtyRows);
+
+    if (FactionSystemRef)
+    {
+        Report.StanceChanges += FactionSystemRef->StepDiplomacyHeadless(Params.Seed, Params.StepIndex);
+    }
+
+    ++Report.StepsSimulated;
+    Report.SimulatedHours += DeltaHours;
+}
+
+void UWorldStateSimulator::BuildEventEffects(float DeltaHours, TArray<FPlanetEffectSource>& OutEffects) const
+{
+    // Reuse the row arrays from the previous step
+    OutEffects.SetNum(ActiveEvents.Num());
+
+    for (int32 EventIndex = 0; EventIndex < ActiveEvents.Num(); ++EventIndex)
+    {
+        const FGalacticEvent& Event = ActiveEvents[EventIndex];
+        FPlanetEffectSource& Source = OutEffects[EventIndex];
+        Source.Rows.Reset();
+
+        // StateEffects is the total change over the event's lifetime, spread evenly across steps
+        Source.Effect = FPlanetStateEffect::FromStateChanges(Event.StateEffects);
+        const float Scale = Event.Duration > 0.0f ? FMath::Min(DeltaHours / Event.Duration, 1.0f) : 0.0f;
+        Source.Effect.Economy *= Scale;
+        Source.Effect.Security *= Scale;
+        Source.Effect.Morale *= Scale;
+        Source.Effect.Population *= Scale;
+
+        for (const FString& PlanetName : Event.AffectedPlanets)
+        {
+            const int32 Row = PlanetTable.FindRow(PlanetName);
+            if (Row != INDEX_NONE)
+            {
+                Source.Rows.Add(Row);
+            }
+        }
+    }
+}
+
+int32 UWorldStateSimulator::ExpireFinishedEvents(TBitArray<>& DirtyRows)
+{
+    int32 NumExpired = 0;
+
+    // Order-preserving removal keeps effect merging deterministic
+    const float CurrentHours = GetSimulationHours();
+    for (int32 EventIndex = 0; EventIndex < ActiveEvents.Num();)
+    {
+        const FGalacticEvent& Event = ActiveEvents[EventIndex];
+        if (Event.StartTime + Event.Duration > CurrentHours)
+        {
+            ++EventIndex;
+            continue;
+        }
+
+        for (const FString& PlanetName : Event.AffectedPlanets)
+        {
+            const int32 Row = PlanetTable.FindRow(PlanetName);
+            if (Row == INDEX_NONE)
+            {
+                continue;
+            }
+
+            PlanetTable.ActiveEvents[Row].Remove(Event.EventID);
+            PlanetTable.AddHistory(Row, Event.Title);
+            DirtyRows[Row] = true;
+        }
+
+        EventHistory.Add(ActiveEvents[EventIndex]);
+        ActiveEvents.RemoveAt(EventIndex);
+        ++NumExpired;
+    }
+
+    return NumExpired;
+}
+
+int32 UWorldStateSimulator::StartRolledEvents(TConstArrayView<FPlanetEventRoll> Rolls, TBitArray<>& DirtyRows)
+{
+    if (EventTemplates.Num() == 0)
+    {
+        return 0;
+    }
+
+    for (const FPlanetEventRoll& Roll : Rolls)
+    {
+        const int32 TemplateIndex = FMath::Min(static_cast<int32>(Roll.Selector * EventTemplates.Num()), EventTemplates.Num() - 1);
+
+        FGalacticEvent& Event = ActiveEvents.Add_GetRef(EventTemplates[TemplateIndex]);
+        Event.EventID = FString::Printf(TEXT("sim_%u_%d"), SimulationStepIndex, Roll.Row);
+        Event.AffectedPlanets = { PlanetTable.Names[Roll.Row] };
+        Event.StartTime = GetSimulationHours();
+        Event.bPlayerTriggered = false;
+
+        PlanetTable.ActiveEvents[Roll.Row].Add(Event.EventID);
+        DirtyRows[Roll.Row] = true;
+    }
+
+    return Rolls.Num();
+}
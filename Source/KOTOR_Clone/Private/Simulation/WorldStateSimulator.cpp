@@ -0,0 +1,536 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Simulation/WorldStateSimulator.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/Guid.h"
+#include "TimerManager.h"
+
+namespace
+{
+    // Real seconds per in-game hour at SimulationSpeed 1
+    constexpr float RealSecondsPerGameHour = 60.0f;
+
+    FGalacticEvent MakeEventTemplate(const FString& EventType, const FString& Title, float Duration, const TMap<FString, float>& StateEffects)
+    {
+        FGalacticEvent Event;
+        Event.EventType = EventType;
+        Event.Title = Title;
+        Event.Duration = Duration;
+        Event.StateEffects = StateEffects;
+        return Event;
+    }
+
+    FString DescribeEnum(const UEnum* Enum, int64 Value)
+    {
+        return Enum ? Enum->GetDisplayNameTextByValue(Value).ToString() : FString();
+    }
+}
+
+void UWorldStateSimulator::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CampaignLoaderRef = nullptr;
+    FactionSystemRef = nullptr;
+    NarrativeMemoryRef = nullptr;
+    bAutomaticSimulation = true;
+    SimulationSpeed = 1.0f;
+    UpdateInterval = 1.0f;
+
+    LoadEventTemplates();
+
+    // Planet symbols are campaign-scoped; re-intern them when a new campaign is loaded
+    FAIDMSymbolTable::Get().OnReset().AddUObject(this, &UWorldStateSimulator::HandleSymbolsReset);
+
+    UE_LOG(LogTemp, Log, TEXT("WorldStateSimulator: Initialized"));
+}
+
+void UWorldStateSimulator::Deinitialize()
+{
+    if (UGameInstance* GameInstance = GetGameInstance())
+    {
+        GameInstance->GetTimerManager().ClearTimer(SimulationTimer);
+    }
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UWorldStateSimulator::OnMemoryAdded);
+    }
+
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->OnDiplomaticStanceChanged.RemoveDynamic(this, &UWorldStateSimulator::OnFactionRelationshipChanged);
+    }
+
+    FAIDMSymbolTable::Get().OnReset().RemoveAll(this);
+
+    Super::Deinitialize();
+}
+
+void UWorldStateSimulator::InitializeWorldSimulator(UCampaignLoaderSubsystem* CampaignLoader,
+                                                    UFactionDiplomacySystem* FactionSystem,
+                                                    UNarrativeMemoryComponent* NarrativeMemory)
+{
+    CampaignLoaderRef = CampaignLoader;
+    FactionSystemRef = FactionSystem;
+    NarrativeMemoryRef = NarrativeMemory;
+
+    if (NarrativeMemoryRef)
+    {
+        NarrativeMemoryRef->OnMemoryAdded.AddUniqueDynamic(this, &UWorldStateSimulator::OnMemoryAdded);
+    }
+
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->OnDiplomaticStanceChanged.AddUniqueDynamic(this, &UWorldStateSimulator::OnFactionRelationshipChanged);
+    }
+
+    LoadPlanetStatesFromCampaign();
+    RestartSimulationTimer();
+
+    UE_LOG(LogTemp, Log, TEXT("WorldStateSimulator: Simulating %d planets"), PlanetTable.Num());
+}
+
+void UWorldStateSimulator::UpdateWorldSimulation()
+{
+    if (bFastForwarding || PlanetTable.Num() == 0)
+    {
+        return;
+    }
+
+    // Same step as FastForward, plus the per-planet and per-event notifications
+    ProcessActiveEvents();
+    UpdatePlanets(FMath::Max(UpdateInterval, 0.01f));
+    RefreshPlanetStatesView();
+}
+
+FGalacticEvent UWorldStateSimulator::TriggerGalacticEvent(const FString& EventType,
+                                                          const TArray<FString>& AffectedPlanets,
+                                                          bool PlayerTriggered)
+{
+    FGalacticEvent Event;
+    if (const FGalacticEvent* Template = EventTemplates.FindByPredicate([&EventType](const FGalacticEvent& Candidate) { return Candidate.EventType == EventType; }))
+    {
+        Event = *Template;
+    }
+    else
+    {
+        Event = GenerateCustomGalacticEvent(EventType, GetGalacticIntelligenceSummary());
+        Event.EventType = EventType;
+    }
+
+    Event.EventID = GenerateEventID();
+    Event.AffectedPlanets = AffectedPlanets;
+    Event.StartTime = GetSimulationHours();
+    Event.bPlayerTriggered = PlayerTriggered;
+
+    ActiveEvents.Add(Event);
+    ApplyEventEffects(Event);
+
+    OnGalacticEventTriggeredEvent(Event);
+    OnGalacticEventTriggered.Broadcast(Event);
+
+    UE_LOG(LogTemp, Log, TEXT("WorldStateSimulator: %s event '%s' on %d planets"), *EventType, *Event.Title, AffectedPlanets.Num());
+
+    return Event;
+}
+
+void UWorldStateSimulator::UpdatePlanetState(const FString& PlanetName, const TMap<FString, float>& StateChanges)
+{
+    const int32 Row = FindPlanetRow(PlanetName);
+    if (Row == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WorldStateSimulator: Unknown planet %s"), *PlanetName);
+        return;
+    }
+
+    const FPlanetWorldState OldState = PlanetTable.GetRow(Row);
+    PlanetTable.ApplyEffect(Row, FPlanetStateEffect::FromStateChanges(StateChanges));
+    NotifyPlanetChanged(Row, OldState);
+}
+
+void UWorldStateSimulator::ChangePlanetControl(const FString& PlanetName, const FString& NewFaction, const FString& Reason)
+{
+    const int32 Row = FindPlanetRow(PlanetName);
+    if (Row == INDEX_NONE)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("WorldStateSimulator: Unknown planet %s"), *PlanetName);
+        return;
+    }
+
+    if (PlanetTable.ControllingFaction[Row] == NewFaction)
+    {
+        return;
+    }
+
+    const FPlanetWorldState OldState = PlanetTable.GetRow(Row);
+    PlanetTable.ControllingFaction[Row] = NewFaction;
+    PlanetTable.AddHistory(Row, FString::Printf(TEXT("%s took control: %s"), *NewFaction, *Reason));
+
+    // Keep the diplomacy system's territory index in step with the planet table
+    if (FactionSystemRef)
+    {
+        FactionSystemRef->ApplyTerritoryTransfer(PlanetName, FString(), NewFaction);
+    }
+
+    // A planet taken by force is occupied until the fighting dies down
+    if (OldState.PoliticalState == EPlanetState::Conflict || OldState.PoliticalState == EPlanetState::War)
+    {
+        PlanetTable.SetPoliticalState(Row, EPlanetState::Occupied);
+    }
+
+    OnFactionControlChanged.Broadcast(PlanetName, NewFaction);
+    NotifyPlanetChanged(Row, OldState);
+
+    UE_LOG(LogTemp, Log, TEXT("WorldStateSimulator: %s now controlled by %s (%s)"), *PlanetName, *NewFaction, *Reason);
+}
+
+FPlanetWorldState UWorldStateSimulator::GetPlanetWorldState(const FString& PlanetName) const
+{
+    return PlanetTable.GetRow(FindPlanetRow(PlanetName));
+}
+
+TArray<FGalacticEvent> UWorldStateSimulator::GetActiveGalacticEvents() const
+{
+    return ActiveEvents;
+}
+
+FString UWorldStateSimulator::GetGalacticIntelligenceSummary() const
+{
+    int32 NumAtWar = 0;
+    int32 NumStruggling = 0;
+    for (int32 Row = 0; Row < PlanetTable.Num(); ++Row)
+    {
+        const EPlanetState PoliticalState = PlanetTable.PoliticalState[Row];
+        NumAtWar += PoliticalState == EPlanetState::Conflict || PoliticalState == EPlanetState::War;
+        NumStruggling += PlanetTable.EconomicCondition[Row] >= EEconomicState::Struggling;
+    }
+
+    FString Summary = FString::Printf(TEXT("%d planets: %d in conflict, %d economically struggling, %d active galactic events."),
+                                      PlanetTable.Num(), NumAtWar, NumStruggling, ActiveEvents.Num());
+
+    for (const FGalacticEvent& Event : ActiveEvents)
+    {
+        Summary += FString::Printf(TEXT("\n- %s (%s): %s"), *Event.Title, *Event.EventType, *FString::Join(Event.AffectedPlanets, TEXT(", ")));
+    }
+
+    return Summary;
+}
+
+FString UWorldStateSimulator::GenerateAIDMWorldContext(const FString& PlanetName) const
+{
+    const int32 Row = FindPlanetRow(PlanetName);
+    if (Row == INDEX_NONE)
+    {
+        return FString();
+    }
+
+    FString Context = FString::Printf(TEXT("Planet %s is controlled by %s. Political state: %s. Economy: %s. Weather: %s. Security %.0f%%, civilian morale %.0f%%."),
+                                      *PlanetTable.Names[Row], *PlanetTable.ControllingFaction[Row],
+                                      *DescribeEnum(StaticEnum<EPlanetState>(), static_cast<int64>(PlanetTable.PoliticalState[Row])),
+                                      *DescribeEnum(StaticEnum<EEconomicState>(), static_cast<int64>(PlanetTable.EconomicCondition[Row])),
+                                      *DescribeEnum(StaticEnum<EWeatherPattern>(), static_cast<int64>(PlanetTable.WeatherCondition[Row])),
+                                      PlanetTable.Security[Row] * 100.0f, PlanetTable.Morale[Row] * 100.0f);
+
+    for (const FGalacticEvent& Event : ActiveEvents)
+    {
+        if (Event.AffectedPlanets.Contains(PlanetName))
+        {
+            Context += FString::Printf(TEXT(" Ongoing: %s."), *Event.Title);
+        }
+    }
+
+    if (PlanetTable.RecentHistory[Row].Num() > 0)
+    {
+        Context += FString::Printf(TEXT(" Recent history: %s."), *FString::Join(PlanetTable.RecentHistory[Row], TEXT("; ")));
+    }
+
+    return Context;
+}
+
+void UWorldStateSimulator::SetSimulationSpeed(float SpeedMultiplier)
+{
+    SimulationSpeed = FMath::Max(SpeedMultiplier, 0.01f);
+    RestartSimulationTimer();
+}
+
+void UWorldStateSimulator::SetAutomaticSimulationEnabled(bool bEnabled)
+{
+    bAutomaticSimulation = bEnabled;
+    RestartSimulationTimer();
+}
+
+void UWorldStateSimulator::LoadPlanetStatesFromCampaign()
+{
+    if (!CampaignLoaderRef || !CampaignLoaderRef->IsCampaignLoaded())
+    {
+        return;
+    }
+
+    // Planets already in the table keep their simulated state; new ones start from campaign data
+    for (const FPlanetData& Planet : CampaignLoaderRef->GetCurrentCampaign().Planets)
+    {
+        if (Planet.Name.IsEmpty() || PlanetTable.FindRow(Planet.Name) != INDEX_NONE)
+        {
+            continue;
+        }
+
+        FPlanetWorldState State;
+        State.PlanetName = Planet.Name;
+        if (!Planet.Government.IsEmpty())
+        {
+            State.ControllingFaction = Planet.Government;
+        }
+
+        const float Population = FCString::Atof(*Planet.Population);
+        if (Population > 0.0f)
+        {
+            State.Population = Population;
+        }
+
+        PlanetTable.AddPlanet(State);
+    }
+
+    RefreshPlanetStatesView();
+}
+
+void UWorldStateSimulator::LoadEventTemplates()
+{
+    // StateEffects are the total change over the event's lifetime (see BuildEventEffects)
+    EventTemplates.Reset();
+    EventTemplates.Add(MakeEventTemplate(TEXT("war"), TEXT("Open Warfare"), 72.0f, { { TEXT("Security"), -0.3f }, { TEXT("Morale"), -0.2f }, { TEXT("Economy"), -0.2f } }));
+    EventTemplates.Add(MakeEventTemplate(TEXT("trade"), TEXT("Trade Boom"), 48.0f, { { TEXT("Economy"), 0.15f }, { TEXT("Morale"), 0.05f } }));
+    EventTemplates.Add(MakeEventTemplate(TEXT("disaster"), TEXT("Natural Disaster"), 36.0f, { { TEXT("Economy"), -0.25f }, { TEXT("Morale"), -0.15f }, { TEXT("Population"), -0.02f } }));
+    EventTemplates.Add(MakeEventTemplate(TEXT("discovery"), TEXT("Archaeological Discovery"), 24.0f, { { TEXT("Economy"), 0.1f }, { TEXT("Morale"), 0.1f } }));
+    EventTemplates.Add(MakeEventTemplate(TEXT("uprising"), TEXT("Civil Unrest"), 48.0f, { { TEXT("Security"), -0.2f }, { TEXT("Morale"), -0.1f } }));
+}
+
+void UWorldStateSimulator::ProcessActiveEvents()
+{
+    TBitArray<> ChangedRows(false, PlanetTable.Num());
+    if (ExpireFinishedEvents(ChangedRows) == 0)
+    {
+        return;
+    }
+
+    NotifyChangedRows(ChangedRows);
+}
+
+void UWorldStateSimulator::GenerateRandomEvents()
+{
+    // Rolls come from the last table step; started exactly like a fast-forward step, then announced
+    const int32 FirstNewEvent = ActiveEvents.Num();
+    TBitArray<> ChangedRows(false, PlanetTable.Num());
+    StartRolledEvents(StepResultScratch.EventRolls, ChangedRows);
+
+    for (int32 EventIndex = FirstNewEvent; EventIndex < ActiveEvents.Num(); ++EventIndex)
+    {
+        // Copy: listeners may trigger more events
+        const FGalacticEvent Event = ActiveEvents[EventIndex];
+        OnGalacticEventTriggeredEvent(Event);
+        OnGalacticEventTriggered.Broadcast(Event);
+    }
+
+    NotifyChangedRows(ChangedRows);
+}
+
+void UWorldStateSimulator::ApplyEventEffects(const FGalacticEvent& Event)
+{
+    // Numeric effects are spread over the event's duration by UpdatePlanets; here the planets only learn about it
+    for (const FString& PlanetName : Event.AffectedPlanets)
+    {
+        const int32 Row = FindPlanetRow(PlanetName);
+        if (Row != INDEX_NONE)
+        {
+            const FPlanetWorldState OldState = PlanetTable.GetRow(Row);
+            PlanetTable.ActiveEvents[Row].AddUnique(Event.EventID);
+            NotifyPlanetChanged(Row, OldState);
+        }
+    }
+}
+
+void UWorldStateSimulator::UpdatePlanets(float DeltaHours)
+{
+    BuildEventEffects(DeltaHours, EffectScratch);
+
+    // Blueprint adjustments ride along as extra effect sources, only when a Blueprint implements the hook
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UWorldStateSimulator, CalculateCustomPlanetChanges)))
+    {
+        for (int32 Row = 0; Row < PlanetTable.Num(); ++Row)
+        {
+            const TMap<FString, float> Changes = CalculateCustomPlanetChanges(PlanetTable.GetRow(Row), DeltaHours);
+            if (Changes.Num() > 0)
+            {
+                FPlanetEffectSource& Source = EffectScratch.AddDefaulted_GetRef();
+                Source.Effect = FPlanetStateEffect::FromStateChanges(Changes);
+                Source.Rows = { Row };
+            }
+        }
+    }
+
+    // Only the economic condition is reported as a change; keep the old one for the Blueprint event
+    const TArray<EEconomicState> PreviousConditions = PlanetTable.EconomicCondition;
+
+    const FPlanetSimulationStepParams Params = MakeStepParams(DeltaHours);
+    PlanetTable.Step(Params, EffectScratch, StepResultScratch);
+    ++SimulationStepIndex; // The clock now reads the end of this step
+
+    for (const int32 Row : StepResultScratch.ChangedRows)
+    {
+        FPlanetWorldState OldState = PlanetTable.GetRow(Row);
+        OldState.EconomicCondition = PreviousConditions[Row];
+        NotifyPlanetChanged(Row, OldState);
+    }
+
+    GenerateRandomEvents();
+}
+
+FPlanetSimulationStepParams UWorldStateSimulator::MakeStepParams(float DeltaHours) const
+{
+    FPlanetSimulationStepParams Params;
+    Params.DeltaHours = DeltaHours;
+    Params.CurrentTime = GetSimulationHours() + DeltaHours;
+    Params.Seed = static_cast<uint32>(SimulationSeed);
+    Params.StepIndex = SimulationStepIndex;
+    Params.EventChancePerHour = RandomEventChancePerHour;
+    Params.bParallel = bParallelSimulation;
+    return Params;
+}
+
+int32 UWorldStateSimulator::FindPlanetRow(const FString& PlanetName) const
+{
+    return PlanetTable.FindRow(PlanetName);
+}
+
+int32 UWorldStateSimulator::FindPlanetRow(FAIDMId PlanetSymbol) const
+{
+    return PlanetTable.FindRow(PlanetSymbol);
+}
+
+void UWorldStateSimulator::NotifyPlanetChanged(int32 Row, const FPlanetWorldState& OldState)
+{
+    const FPlanetWorldState NewState = PlanetTable.GetRow(Row);
+    if (PlanetStates.IsValidIndex(Row))
+    {
+        PlanetStates[Row] = NewState;
+    }
+
+    OnPlanetStateChangedEvent(NewState.PlanetName, OldState, NewState);
+    OnPlanetStateChanged.Broadcast(NewState);
+}
+
+void UWorldStateSimulator::NotifyChangedRows(const TBitArray<>& ChangedRows)
+{
+    for (TConstSetBitIterator<> It(ChangedRows); It; ++It)
+    {
+        // Copy: NotifyPlanetChanged overwrites the view entry before the Blueprint event sees it
+        const int32 Row = It.GetIndex();
+        const FPlanetWorldState OldState = PlanetStates.IsValidIndex(Row) ? PlanetStates[Row] : PlanetTable.GetRow(Row);
+        NotifyPlanetChanged(Row, OldState);
+    }
+}
+
+void UWorldStateSimulator::RefreshPlanetStatesView()
+{
+    PlanetStates = PlanetTable.GetAllRows();
+}
+
+void UWorldStateSimulator::RestartSimulationTimer()
+{
+    UGameInstance* GameInstance = GetGameInstance();
+    if (!GameInstance)
+    {
+        return;
+    }
+
+    FTimerManager& TimerManager = GameInstance->GetTimerManager();
+    TimerManager.ClearTimer(SimulationTimer);
+
+    if (bAutomaticSimulation && CampaignLoaderRef)
+    {
+        const float Period = FMath::Max(UpdateInterval, 0.01f) * RealSecondsPerGameHour / FMath::Max(SimulationSpeed, 0.01f);
+        TimerManager.SetTimer(SimulationTimer, this, &UWorldStateSimulator::UpdateWorldSimulation, Period, true);
+    }
+}
+
+void UWorldStateSimulator::HandleSymbolsReset()
+{
+    // Rows keep their state; only the interned names change. A newly loaded campaign adds its planets.
+    PlanetTable.RefreshSymbols();
+    LoadPlanetStatesFromCampaign();
+}
+
+FString UWorldStateSimulator::GenerateEventID()
+{
+    return FString::Printf(TEXT("event_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+void UWorldStateSimulator::OnMemoryAdded(const FNarrativeMemory& Memory)
+{
+    if (Memory.Importance < EMemoryImportance::Important)
+    {
+        return;
+    }
+
+    // Location is "Planet" or "Planet/Layout"
+    FString PlanetName = Memory.Location;
+    Memory.Location.Split(TEXT("/"), &PlanetName, nullptr);
+    if (FindPlanetRow(PlanetName) == INDEX_NONE)
+    {
+        return;
+    }
+
+    // Word of what the player did spreads: heroics lift morale, villainy and bloodshed unsettle the planet
+    TMap<FString, float> StateChanges;
+    StateChanges.Add(TEXT("Morale"), Memory.AlignmentImpact * 0.05f);
+    if (Memory.EventType == EMemoryEventType::Combat)
+    {
+        StateChanges.Add(TEXT("Security"), -0.03f);
+    }
+
+    UpdatePlanetState(PlanetName, StateChanges);
+}
+
+void UWorldStateSimulator::OnFactionRelationshipChanged(const FString& FactionA, const FString& FactionB)
+{
+    if (!FactionSystemRef || bFastForwarding)
+    {
+        return;
+    }
+
+    const FAIDMSymbolTable& Symbols = FAIDMSymbolTable::Get();
+    const FAIDMId SymbolA = Symbols.Find(EAIDMSymbolKind::Faction, FactionA);
+    const FAIDMId SymbolB = Symbols.Find(EAIDMSymbolKind::Faction, FactionB);
+    if (!SymbolA.IsValid() || !SymbolB.IsValid())
+    {
+        return;
+    }
+
+    const bool bAtWar = FactionSystemRef->AreFactionsAtWar(SymbolA, SymbolB);
+
+    // Planets both factions hold are where a war breaks out, or where a ceasefire is felt first
+    const FTerritoryControlIndex& TerritoryIndex = FactionSystemRef->GetTerritoryIndex();
+    TArray<int32, TInlineAllocator<8>> ContestedRows;
+    for (const FAIDMId Territory : TerritoryIndex.GetTerritories(SymbolA))
+    {
+        const int32 Row = FindPlanetRow(Territory);
+        if (Row != INDEX_NONE && TerritoryIndex.IsControlledBy(Territory, SymbolB))
+        {
+            ContestedRows.Add(Row);
+        }
+    }
+
+    for (const int32 Row : ContestedRows)
+    {
+        const EPlanetState PoliticalState = PlanetTable.PoliticalState[Row];
+        const EPlanetState NewState = bAtWar ? EPlanetState::War
+            : PoliticalState == EPlanetState::War ? EPlanetState::Tense : PoliticalState;
+        if (NewState != PoliticalState)
+        {
+            const FPlanetWorldState OldState = PlanetTable.GetRow(Row);
+            PlanetTable.SetPoliticalState(Row, NewState);
+            NotifyPlanetChanged(Row, OldState);
+        }
+    }
+}
@@ -0,0 +1,884 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Timeline/CampaignTimelineComponent.h"
+#include "Timeline/TimelineSaveChunk.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Misc/Guid.h"
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    // Seconds between replay steps; each step plays every event the replay cursor has passed
+    constexpr float ReplayTickInterval = 0.1f;
+
+    // Events at or above this importance count as story milestones whatever their type
+    constexpr int32 MilestoneImportance = 4;
+
+    float GetEventTimestamp(const FTimelineEvent& Event)
+    {
+        return Event.Timestamp;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShareable(new FJsonValueString(String)));
+        }
+        return Values;
+    }
+
+    void FromJsonArray(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TArray<FString>& OutStrings)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (Object->TryGetArrayField(Field, Values))
+        {
+            OutStrings.Reserve(Values->Num());
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                OutStrings.Add(Value->AsString());
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> ToJsonObject(const TMap<FString, FString>& Map)
+    {
+        TSharedPtr<FJsonObject> Object = MakeShareable(new FJsonObject);
+        for (const TPair<FString, FString>& Entry : Map)
+        {
+            Object->SetStringField(Entry.Key, Entry.Value);
+        }
+        return Object;
+    }
+
+    void FromJsonObject(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TMap<FString, FString>& OutMap)
+    {
+        const TSharedPtr<FJsonObject>* MapObject;
+        if (Object->TryGetObjectField(Field, MapObject))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*MapObject)->Values)
+            {
+                OutMap.Add(Entry.Key, Entry.Value->AsString());
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> EventToJson(const FTimelineEvent& Event)
+    {
+        TSharedPtr<FJsonObject> EventObject = MakeShareable(new FJsonObject);
+        EventObject->SetStringField(TEXT("id"), Event.EventID);
+        EventObject->SetNumberField(TEXT("event_type"), static_cast<int32>(Event.EventType));
+        EventObject->SetStringField(TEXT("title"), Event.Title);
+        EventObject->SetStringField(TEXT("description"), Event.Description);
+        EventObject->SetNumberField(TEXT("timestamp"), Event.Timestamp);
+        EventObject->SetStringField(TEXT("location"), Event.Location);
+        EventObject->SetArrayField(TEXT("participants"), ToJsonArray(Event.ParticipantIDs));
+        EventObject->SetObjectField(TEXT("data"), ToJsonObject(Event.EventData));
+        EventObject->SetNumberField(TEXT("alignment_impact"), Event.AlignmentImpact);
+        EventObject->SetNumberField(TEXT("importance"), Event.ImportanceLevel);
+        EventObject->SetArrayField(TEXT("consequences"), ToJsonArray(Event.Consequences));
+        EventObject->SetBoolField(TEXT("is_replayable"), Event.bIsReplayable);
+        EventObject->SetStringField(TEXT("replay_data"), Event.ReplayData);
+        return EventObject;
+    }
+
+    FTimelineEvent EventFromJson(const TSharedPtr<FJsonObject>& EventObject)
+    {
+        FTimelineEvent Event;
+        EventObject->TryGetStringField(TEXT("id"), Event.EventID);
+
+        int32 EventTypeValue = 0;
+        if (EventObject->TryGetNumberField(TEXT("event_type"), EventTypeValue))
+        {
+            Event.EventType = static_cast<ETimelineEventType>(FMath::Clamp(EventTypeValue, 0, static_cast<int32>(ETimelineEventType::Custom)));
+        }
+
+        EventObject->TryGetStringField(TEXT("title"), Event.Title);
+        EventObject->TryGetStringField(TEXT("description"), Event.Description);
+        EventObject->TryGetNumberField(TEXT("timestamp"), Event.Timestamp);
+        EventObject->TryGetStringField(TEXT("location"), Event.Location);
+        FromJsonArray(EventObject, TEXT("participants"), Event.ParticipantIDs);
+        FromJsonObject(EventObject, TEXT("data"), Event.EventData);
+        EventObject->TryGetNumberField(TEXT("alignment_impact"), Event.AlignmentImpact);
+        EventObject->TryGetNumberField(TEXT("importance"), Event.ImportanceLevel);
+        FromJsonArray(EventObject, TEXT("consequences"), Event.Consequences);
+        EventObject->TryGetBoolField(TEXT("is_replayable"), Event.bIsReplayable);
+        EventObject->TryGetStringField(TEXT("replay_data"), Event.ReplayData);
+        return Event;
+    }
+
+    TSharedPtr<FJsonObject> SnapshotToJson(const FWorldStateSnapshot& Snapshot)
+    {
+        TSharedPtr<FJsonObject> SnapshotObject = MakeShareable(new FJsonObject);
+        SnapshotObject->SetStringField(TEXT("id"), Snapshot.SnapshotID);
+        SnapshotObject->SetNumberField(TEXT("timestamp"), Snapshot.Timestamp);
+        SnapshotObject->SetStringField(TEXT("name"), Snapshot.SnapshotName);
+        SnapshotObject->SetNumberField(TEXT("planet_index"), Snapshot.CurrentPlanetIndex);
+        SnapshotObject->SetStringField(TEXT("layout"), Snapshot.CurrentLayout);
+        SnapshotObject->SetArrayField(TEXT("active_quests"), ToJsonArray(Snapshot.ActiveQuests));
+        SnapshotObject->SetArrayField(TEXT("completed_quests"), ToJsonArray(Snapshot.CompletedQuests));
+        SnapshotObject->SetArrayField(TEXT("recruited_companions"), ToJsonArray(Snapshot.RecruitedCompanions));
+
+        TSharedPtr<FJsonObject> LoyaltyObject = MakeShareable(new FJsonObject);
+        for (const TPair<FString, int32>& Entry : Snapshot.CompanionLoyalty)
+        {
+            LoyaltyObject->SetNumberField(Entry.Key, Entry.Value);
+        }
+        SnapshotObject->SetObjectField(TEXT("companion_loyalty"), LoyaltyObject);
+
+        TSharedPtr<FJsonObject> FlagsObject = MakeShareable(new FJsonObject);
+        for (const TPair<FString, bool>& Entry : Snapshot.StoryFlags)
+        {
+            FlagsObject->SetBoolField(Entry.Key, Entry.Value);
+        }
+        SnapshotObject->SetObjectField(TEXT("story_flags"), FlagsObject);
+
+        SnapshotObject->SetStringField(TEXT("alignment"), Snapshot.PlayerAlignment);
+        SnapshotObject->SetNumberField(TEXT("level"), Snapshot.PlayerLevel);
+        SnapshotObject->SetArrayField(TEXT("inventory"), ToJsonArray(Snapshot.PlayerInventory));
+        SnapshotObject->SetObjectField(TEXT("custom"), ToJsonObject(Snapshot.CustomData));
+        return SnapshotObject;
+    }
+
+    FWorldStateSnapshot SnapshotFromJson(const TSharedPtr<FJsonObject>& SnapshotObject)
+    {
+        FWorldStateSnapshot Snapshot;
+        SnapshotObject->TryGetStringField(TEXT("id"), Snapshot.SnapshotID);
+        SnapshotObject->TryGetNumberField(TEXT("timestamp"), Snapshot.Timestamp);
+        SnapshotObject->TryGetStringField(TEXT("name"), Snapshot.SnapshotName);
+        SnapshotObject->TryGetNumberField(TEXT("planet_index"), Snapshot.CurrentPlanetIndex);
+        SnapshotObject->TryGetStringField(TEXT("layout"), Snapshot.CurrentLayout);
+        FromJsonArray(SnapshotObject, TEXT("active_quests"), Snapshot.ActiveQuests);
+        FromJsonArray(SnapshotObject, TEXT("completed_quests"), Snapshot.CompletedQuests);
+        FromJsonArray(SnapshotObject, TEXT("recruited_companions"), Snapshot.RecruitedCompanions);
+
+        const TSharedPtr<FJsonObject>* LoyaltyObject;
+        if (SnapshotObject->TryGetObjectField(TEXT("companion_loyalty"), LoyaltyObject))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*LoyaltyObject)->Values)
+            {
+                Snapshot.CompanionLoyalty.Add(Entry.Key, static_cast<int32>(Entry.Value->AsNumber()));
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* FlagsObject;
+        if (SnapshotObject->TryGetObjectField(TEXT("story_flags"), FlagsObject))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*FlagsObject)->Values)
+            {
+                Snapshot.StoryFlags.Add(Entry.Key, Entry.Value->AsBool());
+            }
+        }
+
+        SnapshotObject->TryGetStringField(TEXT("alignment"), Snapshot.PlayerAlignment);
+        SnapshotObject->TryGetNumberField(TEXT("level"), Snapshot.PlayerLevel);
+        FromJsonArray(SnapshotObject, TEXT("inventory"), Snapshot.PlayerInventory);
+        FromJsonObject(SnapshotObject, TEXT("custom"), Snapshot.CustomData);
+        return Snapshot;
+    }
+
+    /** Timeline type for a narrative memory; quest and companion memories are recorded from their managers instead */
+    ETimelineEventType TimelineTypeForMemory(EMemoryEventType EventType)
+    {
+        switch (EventType)
+        {
+            case EMemoryEventType::MoralChoice: return ETimelineEventType::MoralChoice;
+            case EMemoryEventType::Combat:      return ETimelineEventType::CombatEncounter;
+            case EMemoryEventType::Dialogue:    return ETimelineEventType::DialogueChoice;
+            case EMemoryEventType::Exploration: return ETimelineEventType::PlanetVisited;
+            case EMemoryEventType::Story:       return ETimelineEventType::StoryMilestone;
+            default:                            return ETimelineEventType::Custom;
+        }
+    }
+}
+
+UCampaignTimelineComponent::UCampaignTimelineComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = true;
+
+    // Initialize default settings
+    bAutoCreateSnapshots = true;
+    SnapshotInterval = 300.0f;
+    MaxTimelineEvents = 1000;
+    MaxSnapshots = 20;
+
+    CurrentGameTime = 0.0f;
+    QuestManagerRef = nullptr;
+    CompanionManagerRef = nullptr;
+    NarrativeMemoryRef = nullptr;
+    bReplayPaused = false;
+    ReplayStartTime = 0.0f;
+    ReplayCursor = 0.0f;
+    LastSnapshotTime = 0.0f;
+}
+
+void UCampaignTimelineComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    CurrentGameTime = GetTimelineTime();
+    LastSnapshotTime = CurrentGameTime;
+
+    if (bAutoCreateSnapshots && SnapshotInterval > 0.0f)
+    {
+        GetWorld()->GetTimerManager().SetTimer(SnapshotTimer, FTimerDelegate::CreateWeakLambda(this, [this]()
+        {
+            CreateWorldStateSnapshot(TEXT("Auto Snapshot"));
+        }), SnapshotInterval, true);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Initialized"));
+}
+
+void UCampaignTimelineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(SnapshotTimer);
+        World->GetTimerManager().ClearTimer(ReplayTimer);
+    }
+
+    BindTrackedComponents(false);
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UCampaignTimelineComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    CurrentGameTime = GetTimelineTime();
+}
+
+void UCampaignTimelineComponent::InitializeTimeline(UQuestManagerComponent* QuestManager,
+                                                    UCompanionManagerComponent* CompanionManager,
+                                                    UNarrativeMemoryComponent* NarrativeMemory)
+{
+    BindTrackedComponents(false);
+
+    QuestManagerRef = QuestManager;
+    CompanionManagerRef = CompanionManager;
+    NarrativeMemoryRef = NarrativeMemory;
+
+    BindTrackedComponents(true);
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Tracking quests %s, companions %s, memories %s"),
+           QuestManagerRef ? TEXT("on") : TEXT("off"), CompanionManagerRef ? TEXT("on") : TEXT("off"),
+           NarrativeMemoryRef ? TEXT("on") : TEXT("off"));
+}
+
+void UCampaignTimelineComponent::AddTimelineEvent(const FTimelineEvent& Event)
+{
+    FTimelineEvent NewEvent = Event;
+    if (NewEvent.EventID.IsEmpty())
+    {
+        NewEvent.EventID = GenerateEventID();
+    }
+    if (NewEvent.Timestamp <= 0.0f)
+    {
+        NewEvent.Timestamp = GetTimelineTime();
+    }
+    NewEvent.ImportanceLevel = FMath::Clamp(NewEvent.ImportanceLevel, 1, 5);
+
+    // Events nearly always arrive in order, so this is an append; equal timestamps keep arrival order
+    const int32 InsertAt = Algo::UpperBoundBy(TimelineEvents, NewEvent.Timestamp, &GetEventTimestamp);
+    const FTimelineEvent& Added = TimelineEvents.Insert_GetRef(MoveTemp(NewEvent), InsertAt);
+    SaveRevision.MarkChanged();
+
+    OnTimelineEventAdded.Broadcast(Added);
+    OnTimelineEventAddedEvent(Added);
+
+    // Trim after broadcasting; handlers receive the event even if it is the one trimmed
+    CleanupOldEvents();
+}
+
+FWorldStateSnapshot UCampaignTimelineComponent::CreateWorldStateSnapshot(const FString& SnapshotName)
+{
+    FWorldStateSnapshot Snapshot = CaptureCurrentWorldState(SnapshotName);
+    WorldStateSnapshots.Add(Snapshot);
+    LastSnapshotTime = Snapshot.Timestamp;
+    SaveRevision.MarkChanged();
+    CleanupOldSnapshots();
+
+    OnWorldStateSnapshot.Broadcast(Snapshot);
+    OnWorldStateSnapshotEvent(Snapshot);
+
+    UE_LOG(LogTemp, Verbose, TEXT("CampaignTimelineComponent: Created snapshot %s (%s)"), *Snapshot.SnapshotName, *Snapshot.SnapshotID);
+    return Snapshot;
+}
+
+bool UCampaignTimelineComponent::RestoreWorldState(const FWorldStateSnapshot& Snapshot)
+{
+    if (Snapshot.SnapshotID.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CampaignTimelineComponent: Cannot restore a snapshot that was never captured"));
+        return false;
+    }
+
+    // Quests have no rewind; the companion roster and loyalty are what the managers can restore
+    if (CompanionManagerRef)
+    {
+        for (const FString& Name : Snapshot.RecruitedCompanions)
+        {
+            if (!CompanionManagerRef->IsCompanionRecruited(Name))
+            {
+                CompanionManagerRef->RecruitCompanion(Name);
+            }
+        }
+
+        for (const TPair<FString, int32>& Entry : Snapshot.CompanionLoyalty)
+        {
+            const int32 CurrentPoints = CompanionManagerRef->GetActiveCompanion(Entry.Key).LoyaltyPoints;
+            if (CompanionManagerRef->IsCompanionRecruited(Entry.Key) && CurrentPoints != Entry.Value)
+            {
+                CompanionManagerRef->AdjustCompanionLoyalty(Entry.Key, Entry.Value - CurrentPoints,
+                                                            FString::Printf(TEXT("Restored %s"), *Snapshot.SnapshotName));
+            }
+        }
+    }
+
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UCampaignTimelineComponent, RestoreCustomWorldState)))
+    {
+        RestoreCustomWorldState(Snapshot, Snapshot.CustomData);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Restored snapshot %s"), *Snapshot.SnapshotName);
+    return true;
+}
+
+FString UCampaignTimelineComponent::StartReplaySession(float StartTime, float EndTime, float PlaybackSpeed)
+{
+    StopReplaySession();
+
+    const int32 First = Algo::LowerBoundBy(TimelineEvents, StartTime, &GetEventTimestamp);
+    const int32 Last = Algo::UpperBoundBy(TimelineEvents, EndTime, &GetEventTimestamp);
+
+    ReplayQueue.Reset(FMath::Max(Last - First, 0));
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        ReplayQueue.Add(TimelineEvents[Index]);
+    }
+
+    CurrentReplaySession = FReplaySession();
+    CurrentReplaySession.SessionID = GenerateSessionID();
+    CurrentReplaySession.SessionName = FString::Printf(TEXT("Replay %.0fs - %.0fs"), StartTime, EndTime);
+    CurrentReplaySession.StartTimestamp = StartTime;
+    CurrentReplaySession.EndTimestamp = FMath::Max(EndTime, StartTime);
+    CurrentReplaySession.PlaybackSpeed = FMath::Max(PlaybackSpeed, 0.01f);
+    CurrentReplaySession.bIsPlaying = true;
+    CurrentReplaySession.EventIDs.Reserve(ReplayQueue.Num());
+    for (const FTimelineEvent& Event : ReplayQueue)
+    {
+        CurrentReplaySession.EventIDs.Add(Event.EventID);
+    }
+
+    bReplayPaused = false;
+    ReplayStartTime = GetTimelineTime();
+    ReplayCursor = CurrentReplaySession.StartTimestamp;
+    GetWorld()->GetTimerManager().SetTimer(ReplayTimer, this, &UCampaignTimelineComponent::ProcessReplayTick, ReplayTickInterval, true);
+
+    OnReplayStarted.Broadcast(CurrentReplaySession);
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Replaying %d events at %.2fx"), ReplayQueue.Num(), CurrentReplaySession.PlaybackSpeed);
+    return CurrentReplaySession.SessionID;
+}
+
+void UCampaignTimelineComponent::StopReplaySession()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ReplayTimer);
+    }
+
+    if (CurrentReplaySession.bIsPlaying)
+    {
+        UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Stopped replay %s after %d events"),
+               *CurrentReplaySession.SessionID, CurrentReplaySession.CurrentEventIndex);
+    }
+
+    CurrentReplaySession.bIsPlaying = false;
+    bReplayPaused = false;
+    ReplayQueue.Reset();
+}
+
+void UCampaignTimelineComponent::PauseReplaySession(bool bPause)
+{
+    if (!CurrentReplaySession.bIsPlaying || bReplayPaused == bPause)
+    {
+        return;
+    }
+
+    bReplayPaused = bPause;
+    if (bPause)
+    {
+        GetWorld()->GetTimerManager().ClearTimer(ReplayTimer);
+    }
+    else
+    {
+        GetWorld()->GetTimerManager().SetTimer(ReplayTimer, this, &UCampaignTimelineComponent::ProcessReplayTick, ReplayTickInterval, true);
+    }
+}
+
+void UCampaignTimelineComponent::SeekReplayToTime(float Timestamp)
+{
+    if (!CurrentReplaySession.bIsPlaying)
+    {
+        return;
+    }
+
+    // Seeking skips the events in between; the next step plays from the new position
+    ReplayCursor = FMath::Clamp(Timestamp, CurrentReplaySession.StartTimestamp, CurrentReplaySession.EndTimestamp);
+    CurrentReplaySession.CurrentEventIndex = Algo::LowerBoundBy(ReplayQueue, ReplayCursor, &GetEventTimestamp);
+}
+
+TArray<FTimelineEvent> UCampaignTimelineComponent::GetEventsInTimeRange(float StartTime, float EndTime) const
+{
+    const int32 First = Algo::LowerBoundBy(TimelineEvents, StartTime, &GetEventTimestamp);
+    const int32 Last = Algo::UpperBoundBy(TimelineEvents, EndTime, &GetEventTimestamp);
+
+    TArray<FTimelineEvent> Result;
+    if (Last > First)
+    {
+        Result.Append(TimelineEvents.GetData() + First, Last - First);
+    }
+    return Result;
+}
+
+TArray<FTimelineEvent> UCampaignTimelineComponent::GetEventsByType(ETimelineEventType EventType) const
+{
+    return TimelineEvents.FilterByPredicate([EventType](const FTimelineEvent& Event)
+    {
+        return Event.EventType == EventType;
+    });
+}
+
+TArray<FTimelineEvent> UCampaignTimelineComponent::GetStoryMilestones() const
+{
+    return TimelineEvents.FilterByPredicate([](const FTimelineEvent& Event)
+    {
+        return Event.EventType == ETimelineEventType::StoryMilestone || Event.ImportanceLevel >= MilestoneImportance;
+    });
+}
+
+TMap<FString, int32> UCampaignTimelineComponent::GetCampaignStatistics() const
+{
+    TMap<FString, int32> Statistics;
+    Statistics.Add(TEXT("TotalEvents"), TimelineEvents.Num());
+    Statistics.Add(TEXT("TotalSnapshots"), WorldStateSnapshots.Num());
+
+    const UEnum* EventTypeEnum = StaticEnum<ETimelineEventType>();
+    int32 Milestones = 0;
+    int32 ReplayableEvents = 0;
+    for (const FTimelineEvent& Event : TimelineEvents)
+    {
+        Statistics.FindOrAdd(FString::Printf(TEXT("Type_%s"), *EventTypeEnum->GetNameStringByValue(static_cast<int64>(Event.EventType))))++;
+        if (Event.EventType == ETimelineEventType::StoryMilestone || Event.ImportanceLevel >= MilestoneImportance)
+        {
+            Milestones++;
+        }
+        if (Event.bIsReplayable)
+        {
+            ReplayableEvents++;
+        }
+    }
+
+    Statistics.Add(TEXT("StoryMilestones"), Milestones);
+    Statistics.Add(TEXT("ReplayableEvents"), ReplayableEvents);
+    Statistics.Add(TEXT("CampaignSeconds"), TimelineEvents.Num() > 0
+        ? FMath::FloorToInt(TimelineEvents.Last().Timestamp - TimelineEvents[0].Timestamp)
+        : 0);
+    return Statistics;
+}
+
+FString UCampaignTimelineComponent::ExportTimelineData() const
+{
+    TSharedPtr<FJsonObject> ExportObject = MakeShareable(new FJsonObject);
+
+    TArray<TSharedPtr<FJsonValue>> EventsArray;
+    EventsArray.Reserve(TimelineEvents.Num());
+    for (const FTimelineEvent& Event : TimelineEvents)
+    {
+        EventsArray.Add(MakeShareable(new FJsonValueObject(EventToJson(Event))));
+    }
+    ExportObject->SetArrayField(TEXT("events"), EventsArray);
+
+    TArray<TSharedPtr<FJsonValue>> SnapshotsArray;
+    SnapshotsArray.Reserve(WorldStateSnapshots.Num());
+    for (const FWorldStateSnapshot& Snapshot : WorldStateSnapshots)
+    {
+        SnapshotsArray.Add(MakeShareable(new FJsonValueObject(SnapshotToJson(Snapshot))));
+    }
+    ExportObject->SetArrayField(TEXT("snapshots"), SnapshotsArray);
+
+    // Serialize to string
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ExportObject.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool UCampaignTimelineComponent::ImportTimelineData(const FString& TimelineData)
+{
+    if (TimelineData.IsEmpty())
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(TimelineData);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("CampaignTimelineComponent: Failed to parse timeline data"));
+        return false;
+    }
+
+    TArray<FTimelineEvent> ImportedEvents;
+    const TArray<TSharedPtr<FJsonValue>>* EventsArray;
+    if (JsonObject->TryGetArrayField(TEXT("events"), EventsArray))
+    {
+        ImportedEvents.Reserve(EventsArray->Num());
+        for (const TSharedPtr<FJsonValue>& EventValue : *EventsArray)
+        {
+            const TSharedPtr<FJsonObject>* EventObject;
+            if (EventValue->TryGetObject(EventObject))
+            {
+                ImportedEvents.Add(EventFromJson(*EventObject));
+            }
+        }
+    }
+
+    TArray<FWorldStateSnapshot> ImportedSnapshots;
+    const TArray<TSharedPtr<FJsonValue>>* SnapshotsArray;
+    if (JsonObject->TryGetArrayField(TEXT("snapshots"), SnapshotsArray))
+    {
+        ImportedSnapshots.Reserve(SnapshotsArray->Num());
+        for (const TSharedPtr<FJsonValue>& SnapshotValue : *SnapshotsArray)
+        {
+            const TSharedPtr<FJsonObject>* SnapshotObject;
+            if (SnapshotValue->TryGetObject(SnapshotObject))
+            {
+                ImportedSnapshots.Add(SnapshotFromJson(*SnapshotObject));
+            }
+        }
+    }
+
+    // Hand-edited exports may be out of order; the range queries need time order
+    ImportedEvents.StableSort([](const FTimelineEvent& A, const FTimelineEvent& B) { return A.Timestamp < B.Timestamp; });
+
+    StopReplaySession();
+    TimelineEvents = MoveTemp(ImportedEvents);
+    WorldStateSnapshots = MoveTemp(ImportedSnapshots);
+    CleanupOldEvents();
+    CleanupOldSnapshots();
+    SaveRevision.MarkChanged();
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Imported %d events and %d snapshots"), TimelineEvents.Num(), WorldStateSnapshots.Num());
+    return true;
+}
+
+void UCampaignTimelineComponent::WriteSaveChunk(FSaveGameContainer& Container) const
+{
+    if (!SaveRevision.NeedsWrite(Container, SaveContainer::TimelineChunk))
+    {
+        return;
+    }
+
+    TimelineSaveChunk::Write(TimelineEvents, WorldStateSnapshots, Container);
+    SaveRevision.MarkSynced(Container);
+}
+
+bool UCampaignTimelineComponent::ReadSaveChunk(const FSaveGameContainer& Container)
+{
+    TArray<FTimelineEvent> LoadedEvents;
+    TArray<FWorldStateSnapshot> LoadedSnapshots;
+    if (!TimelineSaveChunk::Read(Container, LoadedEvents, LoadedSnapshots))
+    {
+        return false;
+    }
+
+    StopReplaySession();
+    TimelineEvents = MoveTemp(LoadedEvents);
+    WorldStateSnapshots = MoveTemp(LoadedSnapshots);
+    SaveRevision.MarkSynced(Container);
+
+    UE_LOG(LogTemp, Log, TEXT("CampaignTimelineComponent: Loaded %d events and %d snapshots from save chunk"),
+           TimelineEvents.Num(), WorldStateSnapshots.Num());
+    return true;
+}
+
+float UCampaignTimelineComponent::GetTimelineTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void UCampaignTimelineComponent::BindTrackedComponents(bool bBind)
+{
+    if (QuestManagerRef)
+    {
+        if (bBind)
+        {
+            QuestManagerRef->OnQuestStarted.AddUniqueDynamic(this, &UCampaignTimelineComponent::OnQuestStarted);
+            QuestManagerRef->OnQuestCompleted.AddUniqueDynamic(this, &UCampaignTimelineComponent::OnQuestCompleted);
+        }
+        else
+        {
+            QuestManagerRef->OnQuestStarted.RemoveDynamic(this, &UCampaignTimelineComponent::OnQuestStarted);
+            QuestManagerRef->OnQuestCompleted.RemoveDynamic(this, &UCampaignTimelineComponent::OnQuestCompleted);
+        }
+    }
+
+    if (CompanionManagerRef)
+    {
+        if (bBind)
+        {
+            CompanionManagerRef->OnCompanionRecruited.AddUniqueDynamic(this, &UCampaignTimelineComponent::OnCompanionRecruited);
+            CompanionManagerRef->OnCompanionLoyaltyChanged.AddUniqueDynamic(this, &UCampaignTimelineComponent::OnCompanionLoyaltyChanged);
+        }
+        else
+        {
+            CompanionManagerRef->OnCompanionRecruited.RemoveDynamic(this, &UCampaignTimelineComponent::OnCompanionRecruited);
+            CompanionManagerRef->OnCompanionLoyaltyChanged.RemoveDynamic(this, &UCampaignTimelineComponent::OnCompanionLoyaltyChanged);
+        }
+    }
+
+    if (NarrativeMemoryRef)
+    {
+        if (bBind)
+        {
+            NarrativeMemoryRef->OnMemoryAdded.AddUniqueDynamic(this, &UCampaignTimelineComponent::OnMemoryAdded);
+        }
+        else
+        {
+            NarrativeMemoryRef->OnMemoryAdded.RemoveDynamic(this, &UCampaignTimelineComponent::OnMemoryAdded);
+        }
+    }
+}
+
+FString UCampaignTimelineComponent::GenerateEventID()
+{
+    return FString::Printf(TEXT("evt_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+FString UCampaignTimelineComponent::GenerateSnapshotID()
+{
+    return FString::Printf(TEXT("snap_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+FString UCampaignTimelineComponent::GenerateSessionID()
+{
+    return FString::Printf(TEXT("replay_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+}
+
+void UCampaignTimelineComponent::CleanupOldEvents()
+{
+    // Oldest first; events are in time order
+    const int32 Excess = TimelineEvents.Num() - FMath::Max(MaxTimelineEvents, 1);
+    if (Excess > 0)
+    {
+        TimelineEvents.RemoveAt(0, Excess, EAllowShrinking::No);
+        SaveRevision.MarkChanged();
+    }
+}
+
+void UCampaignTimelineComponent::CleanupOldSnapshots()
+{
+    const int32 Excess = WorldStateSnapshots.Num() - FMath::Max(MaxSnapshots, 1);
+    if (Excess > 0)
+    {
+        WorldStateSnapshots.RemoveAt(0, Excess, EAllowShrinking::No);
+        SaveRevision.MarkChanged();
+    }
+}
+
+void UCampaignTimelineComponent::ProcessReplayTick()
+{
+    if (!CurrentReplaySession.bIsPlaying || bReplayPaused)
+    {
+        return;
+    }
+
+    ReplayCursor += ReplayTickInterval * CurrentReplaySession.PlaybackSpeed;
+
+    while (CurrentReplaySession.bIsPlaying && ReplayQueue.IsValidIndex(CurrentReplaySession.CurrentEventIndex) &&
+           ReplayQueue[CurrentReplaySession.CurrentEventIndex].Timestamp <= ReplayCursor)
+    {
+        // Copy: a handler may stop the replay, which empties the queue
+        const FTimelineEvent Event = ReplayQueue[CurrentReplaySession.CurrentEventIndex++];
+        PlayReplayEvent(Event);
+    }
+
+    if (CurrentReplaySession.bIsPlaying &&
+        (CurrentReplaySession.CurrentEventIndex >= ReplayQueue.Num() || ReplayCursor >= CurrentReplaySession.EndTimestamp))
+    {
+        StopReplaySession();
+    }
+}
+
+void UCampaignTimelineComponent::PlayReplayEvent(const FTimelineEvent& Event)
+{
+    OnReplayEventPlayed.Broadcast(Event);
+    OnReplayEventPlayedEvent(Event);
+
+    UE_LOG(LogTemp, Verbose, TEXT("CampaignTimelineComponent: Replayed %s at %.1fs"), *Event.Title, Event.Timestamp);
+}
+
+FWorldStateSnapshot UCampaignTimelineComponent::CaptureCurrentWorldState(const FString& SnapshotName)
+{
+    FWorldStateSnapshot Snapshot;
+    Snapshot.SnapshotID = GenerateSnapshotID();
+    Snapshot.SnapshotName = SnapshotName;
+    Snapshot.Timestamp = GetTimelineTime();
+
+    if (QuestManagerRef)
+    {
+        // Journal order: the newest quest says where the player is working now
+        const TArray<FActiveQuest> ActiveQuests = QuestManagerRef->GetActiveQuests();
+        for (const FActiveQuest& Quest : ActiveQuests)
+        {
+            Snapshot.ActiveQuests.Add(Quest.QuestID);
+        }
+        if (ActiveQuests.Num() > 0)
+        {
+            Snapshot.CurrentPlanetIndex = ActiveQuests.Last().PlanetIndex;
+            Snapshot.CurrentLayout = ActiveQuests.Last().LayoutName;
+        }
+
+        for (const FActiveQuest& Quest : QuestManagerRef->GetCompletedQuests())
+        {
+            Snapshot.CompletedQuests.Add(Quest.QuestID);
+        }
+    }
+
+    if (CompanionManagerRef)
+    {
+        for (const FActiveCompanion& Companion : CompanionManagerRef->GetRecruitedCompanions())
+        {
+            Snapshot.RecruitedCompanions.Add(Companion.CompanionData.Name);
+            Snapshot.CompanionLoyalty.Add(Companion.CompanionData.Name, Companion.LoyaltyPoints);
+        }
+    }
+
+    if (NarrativeMemoryRef)
+    {
+        Snapshot.PlayerAlignment = NarrativeMemoryRef->GetPlayerAlignmentSummary();
+    }
+
+    // Story milestones double as flags, so a restore can tell which beats had happened
+    for (const FTimelineEvent& Event : TimelineEvents)
+    {
+        if (Event.EventType == ETimelineEventType::StoryMilestone)
+        {
+            Snapshot.StoryFlags.Add(Event.Title, true);
+        }
+    }
+
+    // Blueprint override; an unimplemented event would return an empty map, so only call it if it exists
+    if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UCampaignTimelineComponent, CaptureCustomWorldState)))
+    {
+        Snapshot.CustomData = CaptureCustomWorldState(Snapshot);
+    }
+
+    return Snapshot;
+}
+
+void UCampaignTimelineComponent::OnQuestStarted(const FActiveQuest& Quest)
+{
+    FTimelineEvent Event;
+    Event.EventType = ETimelineEventType::QuestStarted;
+    Event.Title = FString::Printf(TEXT("Started quest: %s"), *Quest.QuestData.Title);
+    Event.Description = Quest.QuestData.Description;
+    Event.Timestamp = Quest.StartTime;
+    Event.Location = Quest.LayoutName;
+    if (!Quest.QuestGiverName.IsEmpty())
+    {
+        Event.ParticipantIDs.Add(Quest.QuestGiverName);
+    }
+    Event.EventData.Add(TEXT("QuestID"), Quest.QuestID);
+    Event.EventData.Add(TEXT("PlanetIndex"), FString::FromInt(Quest.PlanetIndex));
+    Event.ImportanceLevel = 2;
+    Event.bIsReplayable = true;
+    Event.ReplayData = Quest.QuestID;
+    AddTimelineEvent(Event);
+}
+
+void UCampaignTimelineComponent::OnQuestCompleted(const FActiveQuest& Quest)
+{
+    FTimelineEvent Event;
+    Event.EventType = ETimelineEventType::QuestCompleted;
+    Event.Title = FString::Printf(TEXT("Completed quest: %s"), *Quest.QuestData.Title);
+    Event.Description = Quest.QuestData.Description;
+    Event.Timestamp = Quest.CompletionTime;
+    Event.Location = Quest.LayoutName;
+    if (!Quest.QuestGiverName.IsEmpty())
+    {
+        Event.ParticipantIDs.Add(Quest.QuestGiverName);
+    }
+    Event.EventData.Add(TEXT("QuestID"), Quest.QuestID);
+    Event.EventData.Add(TEXT("PlanetIndex"), FString::FromInt(Quest.PlanetIndex));
+    Event.ImportanceLevel = 3;
+    Event.bIsReplayable = true;
+    Event.ReplayData = Quest.QuestID;
+    AddTimelineEvent(Event);
+}
+
+void UCampaignTimelineComponent::OnCompanionRecruited(const FActiveCompanion& Companion)
+{
+    const FString& Name = Companion.CompanionData.Name;
+
+    FTimelineEvent Event;
+    Event.EventType = ETimelineEventType::CompanionRecruited;
+    Event.Title = FString::Printf(TEXT("%s joined the crew"), *Name);
+    Event.ParticipantIDs.Add(Name);
+    Event.EventData.Add(TEXT("Companion"), Name);
+    Event.ImportanceLevel = 3;
+    AddTimelineEvent(Event);
+}
+
+void UCampaignTimelineComponent::OnCompanionLoyaltyChanged(const FActiveCompanion& Companion)
+{
+    const FString& Name = Companion.CompanionData.Name;
+    const FString Loyalty = StaticEnum<ECompanionLoyalty>()->GetNameStringByValue(static_cast<int64>(Companion.Loyalty));
+
+    FTimelineEvent Event;
+    Event.EventType = ETimelineEventType::CompanionLoyalty;
+    Event.Title = FString::Printf(TEXT("%s's loyalty changed"), *Name);
+    Event.ParticipantIDs.Add(Name);
+    Event.EventData.Add(TEXT("Companion"), Name);
+    Event.EventData.Add(TEXT("Loyalty"), Loyalty);
+    Event.EventData.Add(TEXT("LoyaltyPoints"), FString::FromInt(Companion.LoyaltyPoints));
+    Event.ImportanceLevel = 2;
+    AddTimelineEvent(Event);
+}
+
+void UCampaignTimelineComponent::OnMemoryAdded(const FNarrativeMemory& Memory)
+{
+    // The narrative component's own quest and companion memories repeat events recorded above
+    if (Memory.Tags.Contains(TEXT("quest")) || Memory.Tags.Contains(TEXT("companion")))
+    {
+        return;
+    }
+
+    FTimelineEvent Event;
+    Event.EventType = TimelineTypeForMemory(Memory.EventType);
+    Event.Title = Memory.Title;
+    Event.Description = Memory.Description;
+    Event.Timestamp = Memory.Timestamp;
+    Event.Location = Memory.Location;
+    Event.ParticipantIDs = Memory.ParticipantNPCs;
+    Event.EventData = Memory.ContextData;
+    Event.EventData.Add(TEXT("MemoryID"), Memory.MemoryID);
+    Event.AlignmentImpact = Memory.AlignmentImpact;
+    Event.ImportanceLevel = FMath::Clamp(static_cast<int32>(Memory.Importance), 1, 5);
+    Event.Consequences = Memory.Consequences;
+    AddTimelineEvent(Event);
+}
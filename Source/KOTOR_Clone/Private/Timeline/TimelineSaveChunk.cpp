@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Timeline/TimelineSaveChunk.h"
+#include "Timeline/CampaignTimelineComponent.h"
+#include "AIDM/SaveGameContainer.h"
+
+void TimelineSaveChunk::Write(const TArray<FTimelineEvent>& Events, const TArray<FWorldStateSnapshot>& Snapshots, FSaveGameContainer& Container)
+{
+    FSaveChunkWriter Writer;
+
+    Writer.WriteVarU32(Events.Num());
+    for (const FTimelineEvent& Event : Events)
+    {
+        Writer.WriteString(Event.EventID);
+        Writer.WriteU8(static_cast<uint8>(Event.EventType));
+        Writer.WriteString(Event.Title);
+        Writer.WriteString(Event.Description);
+        Writer.WriteTimestamp(Event.Timestamp);
+        Writer.WriteString(Event.Location);
+        Writer.WriteStringArray(Event.ParticipantIDs);
+        Writer.WriteStringMap(Event.EventData);
+        Writer.WriteF32(Event.AlignmentImpact);
+        Writer.WriteVarI32(Event.ImportanceLevel);
+        Writer.WriteStringArray(Event.Consequences);
+        Writer.WriteBool(Event.bIsReplayable);
+        Writer.WriteString(Event.ReplayData);
+    }
+
+    Writer.WriteVarU32(Snapshots.Num());
+    for (const FWorldStateSnapshot& Snapshot : Snapshots)
+    {
+        Writer.WriteString(Snapshot.SnapshotID);
+        Writer.WriteTimestamp(Snapshot.Timestamp);
+        Writer.WriteString(Snapshot.SnapshotName);
+        Writer.WriteVarI32(Snapshot.CurrentPlanetIndex);
+        Writer.WriteString(Snapshot.CurrentLayout);
+        Writer.WriteStringArray(Snapshot.ActiveQuests);
+        Writer.WriteStringArray(Snapshot.CompletedQuests);
+        Writer.WriteStringArray(Snapshot.RecruitedCompanions);
+
+        Writer.WriteVarU32(Snapshot.CompanionLoyalty.Num());
+        for (const TPair<FString, int32>& Entry : Snapshot.CompanionLoyalty)
+        {
+            Writer.WriteString(Entry.Key);
+            Writer.WriteVarI32(Entry.Value);
+        }
+
+        Writer.WriteVarU32(Snapshot.StoryFlags.Num());
+        for (const TPair<FString, bool>& Entry : Snapshot.StoryFlags)
+        {
+            Writer.WriteString(Entry.Key);
+            Writer.WriteBool(Entry.Value);
+        }
+
+        Writer.WriteString(Snapshot.PlayerAlignment);
+        Writer.WriteVarI32(Snapshot.PlayerLevel);
+        Writer.WriteStringArray(Snapshot.PlayerInventory);
+        Writer.WriteStringMap(Snapshot.CustomData);
+    }
+
+    TArray<uint8> Payload;
+    Writer.Finalize(Payload);
+    Container.SetChunk(SaveContainer::TimelineChunk, Version, MoveTemp(Payload));
+}
+
+bool TimelineSaveChunk::Read(const FSaveGameContainer& Container, TArray<FTimelineEvent>& OutEvents, TArray<FWorldStateSnapshot>& OutSnapshots)
+{
+    TArray<uint8> Payload;
+    if (!Container.GetChunk(SaveContainer::TimelineChunk, Version, Payload))
+    {
+        return false;
+    }
+
+    FSaveChunkReader Reader(Payload);
+
+    TArray<FTimelineEvent> Events;
+    Events.SetNum(Reader.ReadCount());
+    for (FTimelineEvent& Event : Events)
+    {
+        Event.EventID = Reader.ReadString();
+        const uint8 EventTypeValue = Reader.ReadU8();
+        Event.EventType = EventTypeValue <= static_cast<uint8>(ETimelineEventType::Custom) ? static_cast<ETimelineEventType>(EventTypeValue) : ETimelineEventType::Custom;
+        Event.Title = Reader.ReadString();
+        Event.Description = Reader.ReadString();
+        Event.Timestamp = Reader.ReadTimestamp();
+        Event.Location = Reader.ReadString();
+        Reader.ReadStringArray(Event.ParticipantIDs);
+        Reader.ReadStringMap(Event.EventData);
+        Event.AlignmentImpact = Reader.ReadF32();
+        Event.ImportanceLevel = Reader.ReadVarI32();
+        Reader.ReadStringArray(Event.Consequences);
+        Event.bIsReplayable = Reader.ReadBool();
+        Event.ReplayData = Reader.ReadString();
+    }
+
+    TArray<FWorldStateSnapshot> Snapshots;
+    Snapshots.SetNum(Reader.ReadCount());
+    for (FWorldStateSnapshot& Snapshot : Snapshots)
+    {
+        Snapshot.SnapshotID = Reader.ReadString();
+        Snapshot.Timestamp = Reader.ReadTimestamp();
+        Snapshot.SnapshotName = Reader.ReadString();
+        Snapshot.CurrentPlanetIndex = Reader.ReadVarI32();
+        Snapshot.CurrentLayout = Reader.ReadString();
+        Reader.ReadStringArray(Snapshot.ActiveQuests);
+        Reader.ReadStringArray(Snapshot.CompletedQuests);
+        Reader.ReadStringArray(Snapshot.RecruitedCompanions);
+
+        const int32 NumLoyalty = Reader.ReadCount();
+        for (int32 Index = 0; Index < NumLoyalty && !Reader.HasError(); ++Index)
+        {
+            FString Companion = Reader.ReadString();
+            Snapshot.CompanionLoyalty.Add(MoveTemp(Companion), Reader.ReadVarI32());
+        }
+
+        const int32 NumFlags = Reader.ReadCount();
+        for (int32 Index = 0; Index < NumFlags && !Reader.HasError(); ++Index)
+        {
+            FString Flag = Reader.ReadString();
+            Snapshot.StoryFlags.Add(MoveTemp(Flag), Reader.ReadBool());
+        }
+
+        Snapshot.PlayerAlignment = Reader.ReadString();
+        Snapshot.PlayerLevel = Reader.ReadVarI32();
+        Reader.ReadStringArray(Snapshot.PlayerInventory);
+        Reader.ReadStringMap(Snapshot.CustomData);
+    }
+
+    if (!Reader.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("TimelineSaveChunk: Timeline chunk is corrupt"));
+        return false;
+    }
+
+    OutEvents = MoveTemp(Events);
+    OutSnapshots = MoveTemp(Snapshots);
+    return true;
+}
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "UI/DialogueWidget.h"
+#include "AIDM/AIDMGameplayEventSubsystem.h"
+#include "Audio/VoiceSynthesisComponent.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/VerticalBox.h"
@@ -11,6 +13,7 @@ UDialogueWidget::UDialogueWidget(const FObjectInitializer& ObjectInitializer)
 {
     bIsDialogueActive = false;
     CurrentQuestManager = nullptr;
+    VoiceSynthesis = nullptr;
 }
 
 void UDialogueWidget::NativeConstruct()
@@ -79,6 +82,12 @@ void UDialogueWidget::EndDialogue()
     bIsDialogueActive = false;
     CurrentQuestManager = nullptr;
     
+    // Responses that can no longer be picked
+    if (VoiceSynthesis)
+    {
+        VoiceSynthesis->CancelPrefetches();
+    }
+    
     // Clear options
     ClearOptionButtons();
     CurrentOptions.Empty();
@@ -109,6 +118,12 @@ void UDialogueWidget::SelectDialogueOption(int32 OptionIndex)
         DialogueText->SetText(FText::FromString(SelectedOption.ResponseText));
     }
     
+    // Speak the response (usually already prefetched)
+    if (VoiceSynthesis && !SelectedOption.ResponseText.IsEmpty())
+    {
+        VoiceSynthesis->SpeakNPCDialogue(CurrentNPCData, SelectedOption.ResponseText);
+    }
+    
     // Handle quest starting
     if (SelectedOption.bStartsQuest && CurrentQuestManager)
     {
@@ -129,6 +144,17 @@ void UDialogueWidget::SelectDialogueOption(int32 OptionIndex)
     // Broadcast events
     OnDialogueOptionSelected.Broadcast(OptionIndex, SelectedOption);
     OnDialogueOptionSelectedEvent(OptionIndex, SelectedOption);
+
+    // Quest objectives keyed to talking with this NPC advance through the event bus
+    if (UAIDMGameplayEventSubsystem* EventBus = UAIDMGameplayEventSubsystem::Get(this))
+    {
+        FAIDMGameplayEvent Event;
+        Event.Type = EAIDMGameplayEventType::DialogueOptionSelected;
+        Event.TargetID = CurrentNPCData.Name;
+        Event.TargetName = CurrentNPCData.Name;
+        Event.Instigator = GetOwningPlayerPawn();
+        EventBus->Publish(Event);
+    }
     
     // End dialogue if option specifies
     if (SelectedOption.bEndsDialogue)
@@ -215,6 +241,40 @@ void UDialogueWidget::GenerateDialogueOptions()
             CreateOptionButton(CurrentOptions[i], i);
         }
     }
+    
+    PrefetchOptionResponses();
+}
+
+void UDialogueWidget::SetVoiceSynthesis(UVoiceSynthesisComponent* VoiceComponent)
+{
+    VoiceSynthesis = VoiceComponent;
+    
+    if (bIsDialogueActive)
+    {
+        PrefetchOptionResponses();
+    }
+}
+
+void UDialogueWidget::PrefetchOptionResponses()
+{
+    if (!VoiceSynthesis)
+    {
+        return;
+    }
+    
+    // Drop prefetches for the previous set of options before queueing the new ones
+    VoiceSynthesis->CancelPrefetches();
+    
+    TArray<FString> Responses;
+    for (const FDialogueOption& Option : CurrentOptions)
+    {
+        if (IsOptionAvailable(Option) && !Option.ResponseText.IsEmpty())
+        {
+            Responses.Add(Option.ResponseText);
+        }
+    }
+    
+    VoiceSynthesis->PrefetchNPCDialogue(CurrentNPCData, Responses);
 }
 
 void UDialogueWidget::CreateOptionButton(const FDialogueOption& Option, int32 OptionIndex)
@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIDM/AIDMGameplayEvents.h"
+#include "Enemies/EnemyActor.h"
+#include "Loot/LootPickupSystem.h"
+#include "AIDMGameplayEventSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAIDMGameplayEvent, const FAIDMGameplayEvent&, Event);
+
+/**
+ * AIDM Gameplay Event Bus - typed, push-based gameplay events for quest tracking and other listeners.
+ *
+ * Enemy deaths and loot pickups are forwarded from the actors' own delegates (bound once when the
+ * actor enters the world); the AI Director publishes layout changes directly, and the dialogue UI
+ * publishes DialogueOptionSelected through Publish().
+ * Each event is dispatched once, to the listeners of its type only - nothing polls per frame.
+ */
+UCLASS()
+class KOTOR_CLONE_API UAIDMGameplayEventSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    /**
+     * Get the event bus for the world of a context object
+     * @return Null outside game worlds
+     */
+    static UAIDMGameplayEventSubsystem* Get(const UObject* WorldContextObject);
+
+    /**
+     * Publish a gameplay event to every listener of its type
+     * @param Event The event to dispatch (Type must not be None)
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM Events")
+    void Publish(const FAIDMGameplayEvent& Event);
+
+    /**
+     * Native listeners for one event type (AddUObject / RemoveAll)
+     */
+    FOnAIDMGameplayEventNative& OnEvent(EAIDMGameplayEventType Type);
+
+    // Fires for every event, after the native listeners
+    UPROPERTY(BlueprintAssignable, Category = "AIDM Events")
+    FOnAIDMGameplayEvent OnGameplayEvent;
+
+private:
+    FOnAIDMGameplayEventNative NativeListeners[static_cast<int32>(EAIDMGameplayEventType::Count)];
+
+    FDelegateHandle ActorSpawnedHandle;
+
+    // Event source binding
+    void BindEventSource(AActor* Actor);
+
+    UFUNCTION()
+    void HandleEnemyDeath(AEnemyActor* Enemy);
+
+    UFUNCTION()
+    void HandleLootPickedUp(const FLootItemData& LootItem, AActor* Collector);
+};
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDMGameplayEvents.generated.h"
+
+/**
+ * Gameplay events published on the AIDM event bus (UAIDMGameplayEventSubsystem)
+ */
+UENUM(BlueprintType)
+enum class EAIDMGameplayEventType : uint8
+{
+    None                    UMETA(DisplayName = "None"),
+    EnemyKilled             UMETA(DisplayName = "Enemy Killed"),
+    LootPickedUp            UMETA(DisplayName = "Loot Picked Up"),
+    DialogueOptionSelected  UMETA(DisplayName = "Dialogue Option Selected"),
+    LayoutEntered           UMETA(DisplayName = "Layout Entered"),
+
+    Count                   UMETA(Hidden)
+};
+
+/**
+ * A single gameplay event.
+ * Listeners match on TargetID first and TargetName second, so quest data that only
+ * knows an entity by display name (e.g. FActiveQuest::QuestGiverName) still matches.
+ */
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FAIDMGameplayEvent
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "AIDM Event")
+    EAIDMGameplayEventType Type;
+
+    UPROPERTY(BlueprintReadWrite, Category = "AIDM Event")
+    FString TargetID; // Enemy ID, item ID, NPC ID or layout name
+
+    UPROPERTY(BlueprintReadWrite, Category = "AIDM Event")
+    FString TargetName; // Display name (enemy, item, NPC) or planet name for layouts
+
+    UPROPERTY(BlueprintReadWrite, Category = "AIDM Event")
+    int32 Count; // Objective progress this event is worth (e.g. stack size for loot)
+
+    UPROPERTY(BlueprintReadWrite, Category = "AIDM Event")
+    AActor* Instigator; // Killer, collector or speaker (may be null)
+
+    FAIDMGameplayEvent()
+    {
+        Type = EAIDMGameplayEventType::None;
+        TargetID = TEXT("");
+        TargetName = TEXT("");
+        Count = 1;
+        Instigator = nullptr;
+    }
+};
+
+/** Native listener signature; one multicast per event type */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAIDMGameplayEventNative, const FAIDMGameplayEvent& /*Event*/);
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "AIDMSymbolTable.generated.h"
+
+/**
+ * Namespaces for interned AIDM identifiers.
+ * Each kind has its own dense index space, so an ID can double as an array index.
+ */
+UENUM(BlueprintType)
+enum class EAIDMSymbolKind : uint8
+{
+    Quest       UMETA(DisplayName = "Quest"),
+    Companion   UMETA(DisplayName = "Companion"),
+    Faction     UMETA(DisplayName = "Faction"),
+    Memory      UMETA(DisplayName = "Memory"),
+    Planet      UMETA(DisplayName = "Planet"),
+    NPC         UMETA(DisplayName = "NPC"),
+    Layout      UMETA(DisplayName = "Layout"),
+
+    Count       UMETA(Hidden)
+};
+
+/**
+ * Interned AIDM identifier - an index into the campaign symbol table.
+ * Compares and hashes as an integer. IDs are only meaningful for the campaign session
+ * that created them; persist the string (FAIDMSymbolTable::ToString) instead.
+ */
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FAIDMId
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AIDM")
+    int32 Index;
+
+    FAIDMId()
+        : Index(INDEX_NONE)
+    {
+    }
+
+    explicit FAIDMId(int32 InIndex)
+        : Index(InIndex)
+    {
+    }
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+
+    bool operator==(const FAIDMId& Other) const { return Index == Other.Index; }
+    bool operator!=(const FAIDMId& Other) const { return Index != Other.Index; }
+
+    friend uint32 GetTypeHash(const FAIDMId& Id) { return ::GetTypeHash(Id.Index); }
+};
+
+/**
+ * Campaign-scoped symbol table mapping AIDM entity names (quest IDs, companion names,
+ * faction IDs, memory IDs, planet names, ...) to dense integer IDs.
+ *
+ * Matching is case-insensitive, like the FString comparisons it replaces. Strings are
+ * never removed while a campaign is running; Reset() drops everything whenever a campaign
+ * is loaded or the session ends (UCampaignLoaderSubsystem), and holders of cached IDs
+ * re-intern them from OnReset().
+ */
+class KOTOR_CLONE_API FAIDMSymbolTable
+{
+public:
+    /** Global table shared by every AIDM subsystem */
+    static FAIDMSymbolTable& Get();
+
+    /**
+     * Get the ID for a name, adding it if it has not been seen yet
+     * @return Invalid ID for an empty name
+     */
+    FAIDMId Intern(EAIDMSymbolKind Kind, const FString& Name);
+
+    /**
+     * Get the ID for a name without adding it.
+     * A miss means no entity with that name was ever registered, so lookups can bail early.
+     */
+    FAIDMId Find(EAIDMSymbolKind Kind, const FString& Name) const;
+
+    /** Name an ID was interned from (empty for invalid IDs) */
+    FString ToString(EAIDMSymbolKind Kind, FAIDMId Id) const;
+
+    /** Number of symbols interned for a kind (IDs are 0..Num-1) */
+    int32 Num(EAIDMSymbolKind Kind) const;
+
+    /** Drop every symbol; IDs handed out before the reset become stale */
+    void Reset();
+
+    /** Broadcast on the calling thread after Reset(), once the table is empty and unlocked */
+    FSimpleMulticastDelegate& OnReset() { return ResetDelegate; }
+
+    /**
+     * Save-format support: all names of a kind, indexed by ID.
+     * Write this alongside any data that stores raw ID indices.
+     */
+    TArray<FString> ExportSymbols(EAIDMSymbolKind Kind) const;
+
+    /**
+     * Save-format support: re-intern names written by ExportSymbols.
+     * @param SavedSymbols Names in the order they were exported
+     * @param OutRemap Receives the live ID for each saved index (OutRemap[SavedIndex])
+     */
+    void ImportSymbols(EAIDMSymbolKind Kind, const TArray<FString>& SavedSymbols, TArray<FAIDMId>& OutRemap);
+
+private:
+    struct FKindTable
+    {
+        TArray<FString> Names;
+        TMap<FString, int32> Lookup;
+    };
+
+    FKindTable Tables[static_cast<int32>(EAIDMSymbolKind::Count)];
+
+    /** Readers (Find/ToString) may run on simulation worker threads */
+    mutable FRWLock Lock;
+
+    FSimpleMulticastDelegate ResetDelegate;
+};
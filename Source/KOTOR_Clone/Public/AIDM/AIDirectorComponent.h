@@ -52,6 +52,70 @@ struct KOTOR_CLONE_API FAIDirectorSpawnData
     }
 };
 
+/**
+ * Actor pool statistics (spawned content reused across layout changes)
+ */
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FAIDirectorPoolStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Actor Pool")
+    int32 Hits; // Spawns served from the pool
+
+    UPROPERTY(BlueprintReadOnly, Category = "Actor Pool")
+    int32 Misses; // Spawns that had to call SpawnActor
+
+    UPROPERTY(BlueprintReadOnly, Category = "Actor Pool")
+    int32 Released; // Actors deactivated into the pool
+
+    UPROPERTY(BlueprintReadOnly, Category = "Actor Pool")
+    int32 Discarded; // Actors destroyed because their class pool was full
+
+    UPROPERTY(BlueprintReadOnly, Category = "Actor Pool")
+    int32 PooledActors; // Inactive actors currently held
+
+    FAIDirectorPoolStats()
+    {
+        Hits = 0;
+        Misses = 0;
+        Released = 0;
+        Discarded = 0;
+        PooledActors = 0;
+    }
+};
+
+/**
+ * Queued spawn for time-sliced layout population.
+ * Kinds are declared in spawn priority order (lower spawns first).
+ */
+enum class EAIDirectorSpawnKind : uint8
+{
+    Enemy,
+    NPC,
+    Loot
+};
+
+struct FAIDirectorSpawnRequest
+{
+    EAIDirectorSpawnKind Kind = EAIDirectorSpawnKind::Loot;
+    int32 DataIndex = INDEX_NONE;       // Into the current planet's NPC or enemy array
+    int32 SpawnPointIndex = INDEX_NONE; // Into RegisteredSpawnPoints (reserved while queued)
+    float DistanceSq = 0.0f;            // To the player when queued
+};
+
+/**
+ * Inactive actors of one class waiting to be reused
+ */
+USTRUCT()
+struct KOTOR_CLONE_API FAIDirectorPooledActorList
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<AActor*> Actors;
+};
+
 /**
  * Event delegates for AI Director
  */
@@ -59,6 +123,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCampaignLoaded, const FCampaignPl
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlanetChanged, int32, OldPlanetIndex, int32, NewPlanetIndex);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLayoutChanged, const FString&, OldLayout, const FString&, NewLayout);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnContentSpawned, AActor*, SpawnedActor);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLayoutContentSpawned, const FString&, LayoutName, int32, SpawnedCount);
 
 /**
  * AI Director Component - Manages dynamic content spawning and campaign progression
@@ -87,6 +152,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Director")
     bool InitializeWithCampaign(const FString& CampaignFilePath);
 
+    /**
+     * Initialize the AI Director with a campaign loaded off the game thread.
+     * OnCampaignLoaded fires once the load finishes.
+     * @param CampaignFilePath Path to the campaign JSON file
+     * @return True if the async load was started
+     */
+    UFUNCTION(BlueprintCallable, Category = "AI Director")
+    bool InitializeWithCampaignAsync(const FString& CampaignFilePath);
+
     /**
      * Change to a specific planet
      * @param PlanetIndex Index of the planet to change to
@@ -111,18 +185,46 @@ public:
     void RegisterSpawnPoint(const FAIDirectorSpawnData& SpawnPoint);
 
     /**
-     * Spawn content for the current layout
+     * Spawn content for the current layout.
+     * With time slicing on, content is queued (enemies first, nearest to the player first)
+     * and spawned over the following frames; OnLayoutContentSpawned fires when done.
      * @param bForceRespawn If true, will respawn content even if already spawned
      */
     UFUNCTION(BlueprintCallable, Category = "AI Director")
     void SpawnContentForCurrentLayout(bool bForceRespawn = false);
 
+    /**
+     * Drop queued spawns that have not happened yet
+     */
+    UFUNCTION(BlueprintCallable, Category = "AI Director")
+    void CancelPendingSpawns();
+
+    /**
+     * Check if layout content is still streaming in
+     * @return True while spawns are queued
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Director")
+    bool IsSpawningContent() const { return PendingSpawns.Num() > 0; }
+
     /**
      * Clear all spawned content
      */
     UFUNCTION(BlueprintCallable, Category = "AI Director")
     void ClearAllSpawnedContent();
 
+    /**
+     * Destroy every inactive pooled actor
+     */
+    UFUNCTION(BlueprintCallable, Category = "AI Director")
+    void EmptyActorPool();
+
+    /**
+     * Get actor pool hit/miss statistics
+     * @return Current pool statistics
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Director")
+    FAIDirectorPoolStats GetPoolStats() const { return PoolStats; }
+
     /**
      * Get the current planet data
      * @return Current planet data
@@ -130,6 +232,12 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AI Director")
     FPlanetData GetCurrentPlanetData() const;
 
+    /**
+     * Copy-free access to the current planet for C++ callers
+     * @return Current planet in the loader's campaign, nullptr if not initialized
+     */
+    const FPlanetData* FindCurrentPlanetData() const;
+
     /**
      * Get the current layout data
      * @return Current layout data
@@ -165,6 +273,9 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "AI Director Events")
     FOnContentSpawned OnContentSpawned;
 
+    UPROPERTY(BlueprintAssignable, Category = "AI Director Events")
+    FOnLayoutContentSpawned OnLayoutContentSpawned;
+
 protected:
     // Campaign loader subsystem reference
     UPROPERTY()
@@ -221,6 +332,27 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Auto Spawn")
     bool bAutoSpawnLoot;
 
+    // Spawn budget settings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Spawn Budget")
+    bool bTimeSliceSpawning;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Spawn Budget", meta = (ClampMin = "0.1"))
+    float SpawnBudgetMs; // Spawning time allowed per frame (at least one spawn always happens)
+
+    // Actor pool settings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Actor Pool")
+    bool bUseActorPool;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Actor Pool")
+    int32 MaxPooledActorsPerClass;
+
+    // Inactive spawned actors by class
+    UPROPERTY()
+    TMap<UClass*, FAIDirectorPooledActorList> ActorPool;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI Director|Actor Pool")
+    FAIDirectorPoolStats PoolStats;
+
     // Debug settings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Director|Debug")
     bool bDebugMode;
@@ -229,16 +361,41 @@ protected:
     bool bShowSpawnPointDebug;
 
 private:
+    // Shared tail of sync/async initialization once the campaign is in the loader
+    void FinishCampaignInitialization();
+
+    // Announce CurrentLayoutName on the gameplay event bus
+    void PublishLayoutEntered() const;
+
+    // Async load completion from the campaign loader
+    UFUNCTION()
+    void HandleCampaignAsyncLoadFinished(const FString& JsonFilePath, bool bSuccess);
+
+    // Spawn queue (time-sliced layout population), lowest priority first so requests pop off the back
+    TArray<FAIDirectorSpawnRequest> PendingSpawns;
+    int32 SpawnedThisLayout;
+
+    // Bumped whenever the queue is cancelled or cleared, so a batch can tell its data views went stale
+    uint32 SpawnQueueSerial = 0;
+
     // Internal spawning methods
-    void SpawnNPCsForLayout();
-    void SpawnEnemiesForLayout();
-    void SpawnLootForLayout();
+    void QueueNPCsForLayout();
+    void QueueEnemiesForLayout();
+    void QueueLootForLayout();
     void SpawnQuestsForLayout();
+    void ProcessSpawnQueue(double BudgetSeconds);
+    APawn* SpawnNPCAt(const FNPCData& NPCData, const FAIDirectorSpawnData& SpawnPoint);
+    APawn* SpawnEnemyAt(const FCampaignEnemyData& EnemyData, const FAIDirectorSpawnData& SpawnPoint);
+    AActor* SpawnLootAt(const FAIDirectorSpawnData& SpawnPoint);
+    FVector GetSpawnPriorityOrigin() const;
 
     // Helper methods
     TSubclassOf<APawn> GetNPCClassForSpecies(const FString& Species) const;
     TSubclassOf<APawn> GetEnemyClassForSpecies(const FString& Species) const;
-    FAIDirectorSpawnData* FindAvailableSpawnPoint(const FString& SpawnType, const FString& LayoutName);
+    int32 FindAvailableSpawnPointIndex(const FString& SpawnType, const FString& LayoutName) const;
+    AActor* AcquirePooledActor(UClass* ActorClass, const FVector& Location, const FRotator& Rotation);
+    void ReleasePooledActor(AActor* Actor);
+    void SetPooledActorActive(AActor* Actor, bool bActive) const;
     void SetupSpawnedActor(AActor* SpawnedActor, const FString& ActorType, const void* Data);
 
     // Debug helpers
@@ -5,12 +5,12 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Engine/DataTable.h"
-#include "Dom/JsonObject.h"
 #include "CampaignLoaderSubsystem.generated.h"
 
 // Forward declarations
 class UDataTable;
-class FJsonObject;
+struct FCookedCampaignSourceInfo;
+struct FCampaignAsyncLoadState;
 
 /**
  * Data structures for AIDM campaign data
@@ -45,58 +45,6 @@ struct KOTOR_CLONE_API FMapLayout
     }
 };
 
-USTRUCT(BlueprintType)
-struct KOTOR_CLONE_API FPlanetData
-{
-    GENERATED_BODY()
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString Name;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString Biome;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString Climate;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString Population;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString Government;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    TArray<FMapLayout> Layouts;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString MainQuest;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    TArray<FString> SideQuests;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString DifficultyTier;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    int32 PlanetIndex;
-
-    UPROPERTY(BlueprintReadOnly, Category = "Planet")
-    FString LoreDescription;
-
-    FPlanetData()
-    {
-        Name = TEXT("");
-        Biome = TEXT("");
-        Climate = TEXT("");
-        Population = TEXT("");
-        Government = TEXT("");
-        MainQuest = TEXT("");
-        DifficultyTier = TEXT("");
-        PlanetIndex = 0;
-        LoreDescription = TEXT("");
-    }
-};
-
 USTRUCT(BlueprintType)
 struct KOTOR_CLONE_API FQuestData
 {
@@ -234,6 +182,65 @@ struct KOTOR_CLONE_API FCampaignEnemyData
     }
 };
 
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FPlanetData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString Biome;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString Climate;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString Population;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString Government;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    TArray<FMapLayout> Layouts;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString MainQuest;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    TArray<FString> SideQuests;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString DifficultyTier;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    int32 PlanetIndex;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    FString LoreDescription;
+
+    // NPCs on this planet, grouped by FNPCData::Location (layout name) at load time
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    TArray<FNPCData> NPCs;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Planet")
+    TArray<FCampaignEnemyData> Enemies;
+
+    FPlanetData()
+    {
+        Name = TEXT("");
+        Biome = TEXT("");
+        Climate = TEXT("");
+        Population = TEXT("");
+        Government = TEXT("");
+        MainQuest = TEXT("");
+        DifficultyTier = TEXT("");
+        PlanetIndex = 0;
+        LoreDescription = TEXT("");
+    }
+};
+
 USTRUCT(BlueprintType)
 struct KOTOR_CLONE_API FLootItem
 {
@@ -393,6 +400,21 @@ struct KOTOR_CLONE_API FCampaignPlan
     }
 };
 
+/**
+ * Contiguous run of NPC indices (into FPlanetData::NPCs) that share a layout
+ */
+struct FCampaignLocationRange
+{
+    int32 Start = 0;
+    int32 Num = 0;
+};
+
+/**
+ * Async campaign loading events
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnCampaignLoadProgress, int64, BytesRead, int64, TotalBytes, int32, PlanetsParsed);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCampaignAsyncLoadFinished, const FString&, JsonFilePath, bool, bSuccess);
+
 /**
  * Subsystem for loading and managing AIDM campaign data
  */
@@ -414,6 +436,47 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AIDM")
     bool LoadCampaign(const FString& JsonFilePath);
 
+    /**
+     * Load a campaign on a worker task. File I/O and parsing happen off the game thread;
+     * the finished campaign replaces the current one in a single move on the game thread
+     * right before OnCampaignAsyncLoadFinished fires.
+     * @param JsonFilePath Path to the JSON file (relative to Content directory)
+     * @return False if another async load is already in progress
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM")
+    bool LoadCampaignAsync(const FString& JsonFilePath);
+
+    /**
+     * Cancel the in-flight async load. The current campaign is left untouched and
+     * OnCampaignAsyncLoadFinished fires with bSuccess = false.
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM")
+    void CancelAsyncLoad();
+
+    /**
+     * Check if an async load is running
+     * @return True while a LoadCampaignAsync request has not finished
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AIDM")
+    bool IsAsyncLoadInProgress() const { return ActiveAsyncLoad.IsValid(); }
+
+    /**
+     * Convert a campaign JSON file to the cooked binary format.
+     * The parsed campaign also becomes the current campaign.
+     * @param JsonFilePath Path to the JSON file (relative to Content directory)
+     * @return True if the cooked file was written
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM")
+    bool CookCampaign(const FString& JsonFilePath);
+
+    /**
+     * Get the cooked campaign path for a JSON campaign
+     * @param JsonFilePath Path to the JSON file (relative to Content directory)
+     * @return Absolute path of the cooked file under Saved/CookedCampaigns
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AIDM")
+    FString GetCookedCampaignPath(const FString& JsonFilePath) const;
+
     /**
      * Get the currently loaded campaign data
      * @return The loaded campaign plan
@@ -436,6 +499,14 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "AIDM")
     FPlanetData GetPlanetData(int32 PlanetIndex) const;
 
+    /**
+     * Copy-free planet lookup for C++ callers
+     * Pointers stay valid until the next campaign load.
+     * @param PlanetIndex Index of the planet
+     * @return Planet in the current campaign, nullptr if no campaign is loaded or the index is invalid
+     */
+    const FPlanetData* FindPlanetData(int32 PlanetIndex) const;
+
     /**
      * Get NPCs for a specific planet and layout
      * @param PlanetIndex Index of the planet
@@ -453,6 +524,36 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AIDM")
     TArray<FCampaignEnemyData> GetEnemiesForPlanet(int32 PlanetIndex) const;
 
+    /**
+     * Allocation-free view of the NPCs at a planet and layout, as indices into FPlanetData::NPCs
+     * in authored order. Views stay valid until the next campaign load.
+     * @param PlanetIndex Index of the planet
+     * @param LayoutName Name of the layout
+     * @return Indices into GetNPCsForPlanetView(PlanetIndex), empty if none
+     */
+    TArrayView<const int32> GetNPCIndicesForLocationView(int32 PlanetIndex, FName LayoutName) const;
+
+    /**
+     * Allocation-free view of all NPCs on a planet, in authored order
+     * @param PlanetIndex Index of the planet
+     * @return View into the planet's NPC array, empty if none
+     */
+    TArrayView<const FNPCData> GetNPCsForPlanetView(int32 PlanetIndex) const;
+
+    /**
+     * Allocation-free view of the enemies for a planet
+     * @param PlanetIndex Index of the planet
+     * @return View into the planet's enemy array, empty if none
+     */
+    TArrayView<const FCampaignEnemyData> GetEnemiesForPlanetView(int32 PlanetIndex) const;
+
+    // Async load events (always broadcast on the game thread)
+    UPROPERTY(BlueprintAssignable, Category = "AIDM Events")
+    FOnCampaignLoadProgress OnCampaignLoadProgress;
+
+    UPROPERTY(BlueprintAssignable, Category = "AIDM Events")
+    FOnCampaignAsyncLoadFinished OnCampaignAsyncLoadFinished;
+
 protected:
     // Current loaded campaign
     UPROPERTY(BlueprintReadOnly, Category = "AIDM")
@@ -462,41 +563,40 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "AIDM")
     bool bCampaignLoaded;
 
-    // Cached NPC data by location
-    UPROPERTY()
     /*
      * NOTE:
      * UPROPERTY/UHT does not support a nested container (e.g.  TMap<Key, TArray<Value>>).
-     * To keep the header tool happy we flatten the data into a single array.  At runtime
-     * helper methods filter/group this array by location as required.
+     * NPCs and enemies therefore live in FPlanetData::NPCs/Enemies, and this non-reflected
+     * side index maps (PlanetIndex, LayoutName) to the run of NPCs for that layout.
+     * Rebuilt once per campaign load by BuildLocationIndex().
      */
-    TArray<FNPCData> CachedNPCData;
+    TMap<TPair<int32, FName>, FCampaignLocationRange> NPCLocationIndex;
 
-    // Cached enemy data by planet
-    UPROPERTY()
-    /*
-     * NOTE:
-     * UPROPERTY/UHT does not support a nested container (e.g.  TMap<Key, TArray<Value>>).
-     *     TMap<int32, TArray<FCampaignEnemyData>>
-     * helper methods filter/group this array by location as required.
-     */
-    TArray<FCampaignEnemyData> CachedEnemyData;
+    // Each planet's NPC indices grouped by layout, planet after planet; NPCLocationIndex ranges
+    // point into this, so the campaign's own NPC arrays keep their authored order
+    TArray<int32> NPCLocationOrder;
+
+    // Load from / write to the cooked binary cache instead of parsing JSON when possible
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AIDM|Cooked Campaigns")
+    bool bUseCookedCampaigns;
 
 private:
-    // JSON parsing helpers
-    bool ParseCampaignFromJson(const TSharedPtr<FJsonObject>& JsonObject);
-    bool ParsePlanetData(const TSharedPtr<FJsonObject>& JsonObject, FPlanetData& OutPlanet);
-    bool ParseNPCData(const TSharedPtr<FJsonObject>& JsonObject, FNPCData& OutNPC);
-    bool ParseEnemyData(const TSharedPtr<FJsonObject>& JsonObject, FCampaignEnemyData& OutEnemy);
-    bool ParseLootItem(const TSharedPtr<FJsonObject>& JsonObject, FLootItem& OutItem);
-    bool ParseBossData(const TSharedPtr<FJsonObject>& JsonObject, FBossData& OutBoss);
-    bool ParseQuestData(const TSharedPtr<FJsonObject>& JsonObject, FQuestData& OutQuest);
-    bool ParseMapLayout(const TSharedPtr<FJsonObject>& JsonObject, FMapLayout& OutLayout);
-    bool ParseCampaignConfig(const TSharedPtr<FJsonObject>& JsonObject, FCampaignConfig& OutConfig);
-
-    // Helper to convert JSON array to TArray<FString>
-    TArray<FString> JsonArrayToStringArray(const TArray<TSharedPtr<FJsonValue>>& JsonArray);
-    
-    // Helper to convert JSON object to TMap<FString, int32>
-    TMap<FString, int32> JsonObjectToIntMap(const TSharedPtr<FJsonObject>& JsonObject);
+    // Cooked campaign helpers (static so the async worker can use them)
+    static bool ReadCookedCampaign(const FString& FullJsonPath, const FString& CookedPath, FCampaignPlan& OutPlan);
+    static bool WriteCookedCampaign(const FString& CookedPath, const FCampaignPlan& Plan, const FCookedCampaignSourceInfo& Source);
+    static bool LoadJsonCampaign(const FString& FullJsonPath, TArray<uint8>& OutFileBytes, FCampaignPlan& OutPlan,
+                                 const TFunction<bool(int64, int64, int32)>& Progress = TFunction<bool(int64, int64, int32)>());
+
+    // Install a freshly loaded campaign and start a new symbol scope for it
+    void CommitCampaign(FCampaignPlan&& LoadedPlan);
+
+    // Group planet NPC indices by layout and rebuild NPCLocationIndex
+    void BuildLocationIndex();
+
+    // Async load helpers
+    static void ExecuteAsyncLoad(const TSharedRef<FCampaignAsyncLoadState, ESPMode::ThreadSafe>& State, TWeakObjectPtr<UCampaignLoaderSubsystem> WeakThis);
+    void CompleteAsyncLoad(const TSharedRef<FCampaignAsyncLoadState, ESPMode::ThreadSafe>& State);
+
+    // In-flight async load, null when idle
+    TSharedPtr<FCampaignAsyncLoadState, ESPMode::ThreadSafe> ActiveAsyncLoad;
 };
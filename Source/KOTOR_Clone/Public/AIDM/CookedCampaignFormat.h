@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/CampaignLoaderSubsystem.h"
+
+/**
+ * Cooked campaign format - a versioned binary snapshot of an FCampaignPlan.
+ *
+ * The file is designed to be memory-mapped and decoded in a single forward pass
+ * without building an intermediate JSON DOM.
+ *
+ * Layout (little endian):
+ *   FCookedCampaignHeader
+ *   String table : uint32 Offsets[StringCount + 1] followed by the UTF-8 bytes of every string
+ *   Payload      : campaign records, every string stored as a uint32 index into the string table
+ */
+namespace CookedCampaign
+{
+    /** 'KCMP' */
+    static constexpr uint32 Magic = 0x504D434B;
+
+    /** Bump whenever the payload layout changes; older files are treated as stale */
+    static constexpr uint32 Version = 2;
+
+    /** Extension used for cooked campaign files */
+    static const TCHAR* const FileExtension = TEXT(".kcampaign");
+}
+
+/**
+ * Fixed-size header at the start of every cooked campaign file
+ */
+struct FCookedCampaignHeader
+{
+    uint32 Magic = 0;
+    uint32 Version = 0;
+
+    /** Content hash of the JSON the file was cooked from */
+    uint64 SourceHash = 0;
+
+    /** Size and timestamp of the JSON when cooked (cheap staleness check before hashing) */
+    int64 SourceSize = 0;
+    int64 SourceTimestampTicks = 0;
+
+    uint32 StringCount = 0;
+    uint32 StringTableOffset = 0;
+    uint32 PayloadOffset = 0;
+    uint32 PayloadSize = 0;
+};
+
+/**
+ * Identity of the JSON file a cooked campaign was built from
+ */
+struct FCookedCampaignSourceInfo
+{
+    uint64 Hash = 0;
+    int64 Size = 0;
+    int64 TimestampTicks = 0;
+};
+
+/**
+ * Reader/writer for the cooked campaign format
+ */
+class KOTOR_CLONE_API FCookedCampaignFormat
+{
+public:
+    /**
+     * Serialize a campaign plan to the cooked binary format
+     * @param Plan Campaign to serialize
+     * @param Source Identity of the JSON the plan was parsed from
+     * @param OutBytes Receives the cooked file contents
+     */
+    static void Write(const FCampaignPlan& Plan, const FCookedCampaignSourceInfo& Source, TArray<uint8>& OutBytes);
+
+    /**
+     * Validate and read the header of a cooked campaign
+     * @return False if the buffer is too small, has the wrong magic or an unsupported version
+     */
+    static bool ReadHeader(const uint8* Data, int64 Size, FCookedCampaignHeader& OutHeader);
+
+    /**
+     * Decode a cooked campaign directly from memory (typically a mapped file region)
+     * @param Data Start of the cooked file
+     * @param Size Size of the cooked file in bytes
+     * @param OutPlan Receives the decoded campaign
+     * @return True if the whole payload decoded without running out of bounds
+     */
+    static bool Read(const uint8* Data, int64 Size, FCampaignPlan& OutPlan);
+
+    /**
+     * Content hash used to detect stale cooked files
+     */
+    static uint64 HashSource(const uint8* Data, int64 Size);
+
+    /**
+     * Check whether a cooked header still matches its source JSON.
+     * Size + timestamp are compared first; only on a mismatch is the JSON read and hashed,
+     * so touching a file without changing it does not invalidate the cache.
+     * @param Header Header of the cooked file
+     * @param JsonFilePath Absolute path of the source JSON
+     * @param bOutNeedsRestamp Set when the content hash matched but the size/timestamp did not;
+     *                         the caller should RestampSource so later loads skip the hash again
+     * @return True if the cooked data is up to date (or the source JSON no longer exists)
+     */
+    static bool IsUpToDate(const FCookedCampaignHeader& Header, const FString& JsonFilePath, bool& bOutNeedsRestamp);
+
+    /**
+     * Rewrite the source size and timestamp in a cooked file's header, leaving the payload untouched
+     * @param CookedPath Absolute path of the cooked file
+     * @param Header Header currently stored in the cooked file
+     * @param JsonFilePath Absolute path of the source JSON
+     * @return True if the header was rewritten
+     */
+    static bool RestampSource(const FString& CookedPath, const FCookedCampaignHeader& Header, const FString& JsonFilePath);
+
+    /**
+     * Gather size, timestamp and content hash for a JSON file already loaded into memory
+     */
+    static FCookedCampaignSourceInfo MakeSourceInfo(const FString& JsonFilePath, const TArray<uint8>& JsonBytes);
+};
@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "AIDM/CampaignLoaderSubsystem.h"
+#include "AIDM/AIDMSymbolTable.h"
+#include "AIDM/AIDMGameplayEvents.h"
+#include "AIDM/SaveGameContainer.h"
 #include "QuestManagerComponent.generated.h"
 
 /**
@@ -43,6 +46,12 @@ struct KOTOR_CLONE_API FQuestObjective
     UPROPERTY(BlueprintReadWrite, Category = "Quest Objective")
     int32 RequiredProgress;
 
+    UPROPERTY(BlueprintReadWrite, Category = "Quest Objective")
+    FString TargetID; // Enemy, item, NPC or layout this objective tracks (empty = manual updates only)
+
+    UPROPERTY(BlueprintReadWrite, Category = "Quest Objective")
+    EAIDMGameplayEventType TriggerEvent; // Event type that advances it (None = AdvanceObjectivesForTarget only)
+
     FQuestObjective()
     {
         Description = TEXT("");
@@ -50,6 +59,7 @@ struct KOTOR_CLONE_API FQuestObjective
         bIsOptional = false;
         CurrentProgress = 0;
         RequiredProgress = 1;
+        TriggerEvent = EAIDMGameplayEventType::None;
     }
 };
 
@@ -64,6 +74,10 @@ struct KOTOR_CLONE_API FActiveQuest
     UPROPERTY(BlueprintReadOnly, Category = "Quest")
     FString QuestID;
 
+    // Interned QuestID used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Quest")
+    FAIDMId QuestSymbol;
+
     UPROPERTY(BlueprintReadOnly, Category = "Quest")
     FQuestData QuestData;
 
@@ -76,6 +90,10 @@ struct KOTOR_CLONE_API FActiveQuest
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     float StartTime;
 
+    // Journal position; unlike StartTime it keeps counting across save/load and never ties
+    UPROPERTY(BlueprintReadOnly, Category = "Quest")
+    int32 StartSequence;
+
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     float CompletionTime;
 
@@ -88,15 +106,35 @@ struct KOTOR_CLONE_API FActiveQuest
     UPROPERTY(BlueprintReadWrite, Category = "Quest")
     FString LayoutName;
 
+    // Required (non-optional) objectives not yet completed
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Quest")
+    int32 RemainingObjectives;
+
     FActiveQuest()
     {
         QuestID = TEXT("");
         State = EQuestState::NotStarted;
         StartTime = 0.0f;
+        StartSequence = 0;
         CompletionTime = 0.0f;
         QuestGiverName = TEXT("");
         PlanetIndex = -1;
         LayoutName = TEXT("");
+        RemainingObjectives = 0;
+    }
+};
+
+/**
+ * Reference to one objective of an active quest (entry in the objective target index)
+ */
+struct FQuestObjectiveRef
+{
+    FAIDMId QuestSymbol;
+    int32 ObjectiveIndex = INDEX_NONE;
+
+    bool operator==(const FQuestObjectiveRef& Other) const
+    {
+        return QuestSymbol == Other.QuestSymbol && ObjectiveIndex == Other.ObjectiveIndex;
     }
 };
 
@@ -121,6 +159,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     /**
@@ -161,6 +200,28 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Quest Manager")
     bool UpdateQuestObjective(const FString& QuestID, int32 ObjectiveIndex, int32 Progress = 1);
 
+    /**
+     * Bind an objective to a target so it advances from gameplay events and AdvanceObjectivesForTarget
+     * @param QuestID The ID of the quest
+     * @param ObjectiveIndex Index of the objective to bind
+     * @param TargetID Enemy, item, NPC or layout ID (or display name) the objective tracks
+     * @param TriggerEvent Event type that advances the objective (None = AdvanceObjectivesForTarget only)
+     * @return True if the objective was bound
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Manager")
+    bool SetObjectiveTarget(const FString& QuestID, int32 ObjectiveIndex, const FString& TargetID,
+                            EAIDMGameplayEventType TriggerEvent = EAIDMGameplayEventType::None);
+
+    /**
+     * Add progress to every incomplete objective bound to a target.
+     * Cost is proportional to the number of matching objectives, not the number of active quests.
+     * @param TargetID Enemy, item, NPC or layout name
+     * @param Progress Amount of progress to add
+     * @return Number of objectives updated
+     */
+    UFUNCTION(BlueprintCallable, Category = "Quest Manager")
+    int32 AdvanceObjectivesForTarget(const FString& TargetID, int32 Progress = 1);
+
     /**
      * Get an active quest by ID
      * @param QuestID The quest ID to find
@@ -171,7 +232,7 @@ public:
 
     /**
      * Get all active quests
-     * @return Array of all active quests
+     * @return Array of all active quests, in the order they were started
      */
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Quest Manager")
     TArray<FActiveQuest> GetActiveQuests() const;
@@ -228,6 +289,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Quest Manager")
     bool LoadQuestData(const FString& SaveData);
 
+    /**
+     * Write quest data into its chunk of a binary save container (JSON remains the export format)
+     * Skips encoding entirely if the journal did not change since it was last written to or read from this container
+     */
+    void WriteSaveChunk(FSaveGameContainer& Container) const;
+
+    /**
+     * Load quest data from a binary save container
+     * @return True if the quest chunk was present and decoded
+     */
+    bool ReadSaveChunk(const FSaveGameContainer& Container);
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Quest Events")
     FOnQuestStarted OnQuestStarted;
@@ -258,16 +331,42 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Quest Manager")
     int32 NextQuestID;
 
+    // Start sequence the next started quest receives
+    UPROPERTY(BlueprintReadOnly, Category = "Quest Manager")
+    int32 NextStartSequence;
+
     // Debug settings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Quest Manager|Debug")
     bool bDebugMode;
 
 private:
+    // Quest symbol -> slot in ActiveQuests
+    TMap<FAIDMId, int32> ActiveQuestIndex;
+
+    // Symbols of every quest in CompletedQuests
+    TSet<FAIDMId> CompletedQuestIndex;
+
+    // Per trigger event type: objective TargetID -> incomplete objectives of active quests tracking it
+    TMultiMap<FString, FQuestObjectiveRef> ObjectiveTargetIndex[static_cast<int32>(EAIDMGameplayEventType::Count)];
+
+    // Bumped by every change to the saved journal
+    FSaveChunkRevision SaveRevision;
+
     // Helper methods
     FString GenerateQuestID();
     FActiveQuest* FindActiveQuest(const FString& QuestID);
+    const FActiveQuest* FindActiveQuest(const FString& QuestID) const;
+    int32 FindActiveQuestSlot(const FString& QuestID) const;
+    void AddActiveQuest(FActiveQuest&& Quest);
+    FActiveQuest RemoveActiveQuest(int32 Slot);
+    bool AdvanceObjective(int32 Slot, int32 ObjectiveIndex, int32 Progress);
+    int32 AdvanceObjectives(const TArray<FQuestObjectiveRef>& Matches, int32 Progress);
+    void IndexObjective(FAIDMId QuestSymbol, int32 ObjectiveIndex, const FQuestObjective& Objective);
+    void UnindexObjective(FAIDMId QuestSymbol, int32 ObjectiveIndex, const FQuestObjective& Objective);
+    void HandleGameplayEvent(const FAIDMGameplayEvent& Event);
+    void HandleSymbolsReset();
     void CreateDefaultObjectives(FActiveQuest& Quest);
-    bool AreAllObjectivesCompleted(const FActiveQuest& Quest) const;
+    int32 CountRemainingObjectives(const FActiveQuest& Quest) const;
     void LogQuestEvent(const FString& Event, const FActiveQuest& Quest) const;
 
 public:
@@ -0,0 +1,269 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Save game container - a versioned, chunked binary save file.
+ *
+ * Every subsystem (narrative memory, quests, companions, timeline) owns one chunk with its
+ * own version, so subsystems can change their layout independently. JSON stays available
+ * through each component's JSON save/export functions for debugging and tools.
+ *
+ * Layout (little endian):
+ *   FSaveContainerHeader
+ *   FSaveChunkEntry[ChunkCount]
+ *   Chunk data    : each chunk's payload, zlib-compressed when that makes it smaller
+ *
+ * Chunk payload (FSaveChunkWriter):
+ *   String table  : varint count, then varint byte length + UTF-8 bytes per string
+ *   Body          : varints (zigzag for signed values), strings as varint string table indices,
+ *                   timestamps quantized to whole milliseconds and written as zigzag deltas
+ *                   from the previous one
+ */
+namespace SaveContainer
+{
+    /** 'KSAV' */
+    static constexpr uint32 Magic = 0x5641534B;
+
+    /** Bump whenever the header or chunk table layout changes; chunk payloads carry their own versions */
+    static constexpr uint32 Version = 1;
+
+    /** Resolution of FSaveChunkWriter::WriteTimestamp; game time finer than a millisecond is not kept */
+    static constexpr double TimestampTicksPerSecond = 1000.0;
+
+    /** Extension used for binary save files */
+    static const TCHAR* const FileExtension = TEXT(".ksave");
+
+    constexpr uint32 MakeChunkId(char A, char B, char C, char D)
+    {
+        return static_cast<uint32>(static_cast<uint8>(A))
+            | (static_cast<uint32>(static_cast<uint8>(B)) << 8)
+            | (static_cast<uint32>(static_cast<uint8>(C)) << 16)
+            | (static_cast<uint32>(static_cast<uint8>(D)) << 24);
+    }
+
+    static constexpr uint32 NarrativeMemoryChunk = MakeChunkId('N', 'M', 'E', 'M');
+    static constexpr uint32 QuestChunk = MakeChunkId('Q', 'U', 'S', 'T');
+    static constexpr uint32 CompanionChunk = MakeChunkId('C', 'M', 'P', 'N');
+    static constexpr uint32 TimelineChunk = MakeChunkId('T', 'M', 'L', 'N');
+    static constexpr uint32 NPCMemoryChunk = MakeChunkId('N', 'P', 'C', 'M');
+}
+
+/**
+ * Fixed-size header at the start of every save container
+ */
+struct FSaveContainerHeader
+{
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    uint32 ChunkCount = 0;
+    uint32 Reserved = 0;
+};
+
+/**
+ * Chunk table entry
+ */
+struct FSaveChunkEntry
+{
+    enum : uint32
+    {
+        Compressed = 1 << 0
+    };
+
+    uint32 Id = 0;
+    uint32 ChunkVersion = 0;
+    uint32 Flags = 0;
+    uint32 Offset = 0;     // From the start of the file
+    uint32 StoredSize = 0; // Bytes in the file
+    uint32 RawSize = 0;    // Bytes once decompressed
+    uint32 Crc = 0;        // Of the decompressed payload
+};
+
+/**
+ * Encodes one chunk payload
+ */
+class KOTOR_CLONE_API FSaveChunkWriter
+{
+public:
+    void WriteU8(uint8 Value) { Body.Add(Value); }
+    void WriteBool(bool bValue) { Body.Add(bValue ? 1 : 0); }
+    void WriteF32(float Value) { Body.Append(reinterpret_cast<const uint8*>(&Value), sizeof(Value)); }
+    void WriteVarU32(uint32 Value);
+    void WriteVarI32(int32 Value);
+
+    /** Rounded to the millisecond; cheapest when timestamps are written in chronological order */
+    void WriteTimestamp(float Value);
+
+    /** Strings are deduplicated into the chunk's string table */
+    void WriteString(const FString& Value);
+    void WriteStringArray(const TArray<FString>& Values);
+    void WriteStringMap(const TMap<FString, FString>& Values);
+
+    /** Prepend the string table and move the finished payload out */
+    void Finalize(TArray<uint8>& OutPayload);
+
+private:
+    struct FCaseSensitiveKeyFuncs : TDefaultMapKeyFuncs<FString, uint32, false>
+    {
+        static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+        static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+    };
+
+    static void AppendVarU32(TArray<uint8>& Out, uint32 Value);
+    static void AppendVarU64(TArray<uint8>& Out, uint64 Value);
+
+    TArray<uint8> Body;
+    TArray<FString> Strings;
+    TMap<FString, uint32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs> StringIndices;
+    int64 LastTimestampTicks = 0;
+};
+
+/**
+ * Bounds-checked forward reader over one chunk payload.
+ * Any out-of-range access or bad string index latches bError and returns default values.
+ */
+class KOTOR_CLONE_API FSaveChunkReader
+{
+public:
+    explicit FSaveChunkReader(TConstArrayView<uint8> InPayload);
+
+    uint8 ReadU8();
+    bool ReadBool() { return ReadU8() != 0; }
+    float ReadF32();
+    uint32 ReadVarU32();
+    int32 ReadVarI32();
+    float ReadTimestamp();
+    FString ReadString();
+    void ReadStringArray(TArray<FString>& OutValues);
+    void ReadStringMap(TMap<FString, FString>& OutValues);
+
+    /** Element count that cannot exceed the remaining bytes (every element takes at least one) */
+    int32 ReadCount();
+
+    bool HasError() const { return bError; }
+
+    /** True once the whole payload was consumed without error */
+    bool IsComplete() const { return !bError && Cursor == Payload.Num(); }
+
+private:
+    uint64 ReadVarU64();
+
+    TConstArrayView<uint8> Payload;
+    int32 Cursor = 0;
+    TArray<FString> Strings;
+    int64 LastTimestampTicks = 0;
+    bool bError = false;
+};
+
+/**
+ * In-memory save container.
+ *
+ * SetChunk only marks a chunk dirty when its payload actually changed (by size and CRC), and
+ * Write compresses only dirty chunks - clean chunks are copied through in their stored form.
+ * Read parses just the chunk table; each chunk is decompressed and checked when GetChunk asks
+ * for it, so a load can restore the subsystems it needs now and defer the rest.
+ */
+class KOTOR_CLONE_API FSaveGameContainer
+{
+public:
+    FSaveGameContainer() { Reset(); }
+
+    void Reset();
+
+    /**
+     * Store a chunk payload
+     * @param ChunkVersion Layout version of the payload; bump it whenever the layout changes, and
+     *                     keep the chunk's reader able to decode every version that has shipped
+     * @return True if the chunk is new or its payload changed
+     */
+    bool SetChunk(uint32 ChunkId, uint32 ChunkVersion, TArray<uint8>&& Payload);
+
+    void RemoveChunk(uint32 ChunkId);
+
+    bool HasChunk(uint32 ChunkId) const { return FindChunk(ChunkId) != nullptr; }
+    bool IsChunkDirty(uint32 ChunkId) const;
+
+    /** True if anything changed since the last Write or Read */
+    bool IsDirty() const;
+
+    /**
+     * Decode a chunk payload
+     * @param MaxChunkVersion Newest chunk version the caller understands (see SetChunk)
+     * @param OutChunkVersion Optional; receives the version the chunk was written with
+     * @return False if the chunk is missing, corrupt or newer than MaxChunkVersion
+     */
+    bool GetChunk(uint32 ChunkId, uint32 MaxChunkVersion, TArray<uint8>& OutPayload, uint32* OutChunkVersion = nullptr) const;
+
+    /** Serialize the container, compressing any dirty chunks first */
+    void Write(TArray<uint8>& OutBytes);
+
+    /**
+     * Parse a serialized container; chunk payloads stay compressed until GetChunk
+     * @return False if the header or chunk table is invalid
+     */
+    bool Read(TConstArrayView<uint8> Bytes);
+
+    bool SaveToFile(const FString& FilePath);
+    bool LoadFromFile(const FString& FilePath);
+
+    /** Compression is on by default; chunks that do not shrink are always stored raw */
+    void SetCompressionEnabled(bool bEnabled) { bCompressionEnabled = bEnabled; }
+
+    /** Changes whenever the chunks are replaced wholesale (Reset, Read); unique across containers */
+    uint32 GetGeneration() const { return Generation; }
+
+private:
+    struct FChunk
+    {
+        uint32 Id = 0;
+        uint32 Version = 0;
+        uint32 RawSize = 0;
+        uint32 Crc = 0;
+        bool bCompressed = false;
+        bool bDirty = false;
+        TArray<uint8> Data; // Raw payload while dirty, stored (possibly compressed) form afterwards
+    };
+
+    FChunk* FindChunk(uint32 ChunkId);
+    const FChunk* FindChunk(uint32 ChunkId) const;
+
+    void EncodeChunk(FChunk& Chunk) const;
+
+    TArray<FChunk> Chunks;
+    uint32 Generation = 0;
+    bool bChunksRemoved = false;
+    bool bCompressionEnabled = true;
+};
+
+/**
+ * Per-subsystem change counter that lets a clean subsystem skip encoding its chunk.
+ *
+ * The owner calls MarkChanged whenever saved state changes and checks NeedsWrite before
+ * encoding. A successful write or read syncs the revision with that container, so a save
+ * that follows a load or an unchanged save costs nothing for this subsystem.
+ */
+class FSaveChunkRevision
+{
+public:
+    void MarkChanged() { ++Revision; }
+
+    /** False if the container already holds the chunk for the current state */
+    bool NeedsWrite(const FSaveGameContainer& Container, uint32 ChunkId) const
+    {
+        return Revision != SyncedRevision || Container.GetGeneration() != SyncedGeneration || !Container.HasChunk(ChunkId);
+    }
+
+    /** The container's chunk now matches the current state; const so const WriteSaveChunk can call it */
+    void MarkSynced(const FSaveGameContainer& Container) const
+    {
+        SyncedRevision = Revision;
+        SyncedGeneration = Container.GetGeneration();
+    }
+
+private:
+    uint32 Revision = 0;
+    mutable uint32 SyncedRevision = 0;
+    mutable uint32 SyncedGeneration = 0; // Container generations start at 1, so nothing is synced initially
+};
@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+
+/**
+ * Voice audio disk cache - content-addressed store of synthesized dialogue audio.
+ *
+ * Every blob lives in Saved/VoiceCache/<CacheKey>.pcm, where the key is the MD5 of the
+ * synthesis inputs (text, voice and pitch), so a repeated line is a disk read instead of
+ * a TTS round trip. Blobs are stored exactly as the provider produced them.
+ *
+ * Layout of the index file (little endian):
+ *   uint32 Magic, uint32 Version, int32 EntryCount
+ *   EntryCount x { FString Key, int64 SizeBytes, int32 SampleRate, int32 NumChannels },
+ *   most recently used first
+ *
+ * The cache is bounded by bytes and evicts least recently used blobs first. Blob writes run
+ * on a worker thread; everything else (index, eviction) is game thread only.
+ */
+namespace VoiceAudioDiskCache
+{
+    /** 'VCIX' */
+    static constexpr uint32 Magic = 0x58494356;
+
+    /** Bump whenever the index layout changes; older indices are discarded with their blobs */
+    static constexpr uint32 Version = 1;
+
+    /** Extension used for cached audio blobs */
+    static const TCHAR* const BlobExtension = TEXT(".pcm");
+
+    /** Name of the index file inside the cache directory */
+    static const TCHAR* const IndexFileName = TEXT("VoiceCache.idx");
+}
+
+/**
+ * Index record for one cached blob
+ */
+struct FVoiceAudioCacheEntry
+{
+    int64 SizeBytes = 0;
+    int32 SampleRate = 44100;
+    int32 NumChannels = 1;
+};
+
+/**
+ * Process-wide voice audio cache shared by every UVoiceSynthesisComponent
+ */
+class KOTOR_CLONE_API FVoiceAudioDiskCache
+{
+public:
+    /** Get the shared cache (loads the index on first use) */
+    static FVoiceAudioDiskCache& Get();
+
+    /**
+     * Set the byte budget, evicting immediately if the cache is already over it
+     * @param InMaxBytes Maximum total size of all blobs
+     */
+    void SetMaxBytes(int64 InMaxBytes);
+
+    /** True if a fully written blob exists for the key (does not affect recency) */
+    bool Contains(const FString& Key) const;
+
+    /**
+     * Look up a blob and mark it as most recently used
+     * @param Key Cache key
+     * @param OutEntry Receives the blob's format and size
+     * @return False if the key is not cached or its blob is still being written
+     */
+    bool FindAndTouch(const FString& Key, FVoiceAudioCacheEntry& OutEntry);
+
+    /**
+     * Add a blob, evicting least recently used blobs to stay within budget.
+     * The blob is written asynchronously and becomes visible once the write finishes.
+     * @param Key Cache key
+     * @param Data Audio bytes (moved into the write task)
+     * @param SampleRate Sample rate of the audio
+     * @param NumChannels Channel count of the audio
+     */
+    void Store(const FString& Key, TArray<uint8> Data, int32 SampleRate, int32 NumChannels);
+
+    /**
+     * Drop a blob whose file turned out to be missing or truncated
+     */
+    void Invalidate(const FString& Key);
+
+    /** Delete every blob and the index */
+    void Clear();
+
+    /** Write the index if it changed since the last flush */
+    void Flush();
+
+    /** Absolute path of the blob for a key */
+    FString GetBlobPath(const FString& Key) const;
+
+    int32 Num() const { return Entries.Num(); }
+    int64 GetTotalBytes() const { return TotalBytes; }
+    int64 GetMaxBytes() const { return MaxBytes; }
+
+private:
+    FVoiceAudioDiskCache();
+
+    void LoadIndex();
+    void RemoveOrphanedBlobs();
+    void EvictToFit(int64 IncomingBytes);
+    void RemoveEntry(const FString& Key);
+    void OnBlobWritten(const FString& Key, bool bSucceeded);
+
+    FString CacheDirectory;
+
+    // Key -> entry, ordered by recency
+    TLruCache<FString, FVoiceAudioCacheEntry> Entries;
+
+    // Keys whose blob is queued or being written
+    TSet<FString> PendingWrites;
+
+    int64 TotalBytes;
+    int64 MaxBytes;
+    bool bIndexDirty;
+};
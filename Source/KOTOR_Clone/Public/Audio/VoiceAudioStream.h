@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Voice audio stream - 16-bit PCM handed from a producer (HTTP thread) to a consumer
+ * (the audio render thread, via USoundWaveProcedural underflow) while it is still arriving.
+ *
+ * Every received byte is kept so the finished clip can be cached without re-downloading;
+ * the consumer only advances a read offset. Reads are always a whole number of samples.
+ */
+class KOTOR_CLONE_API FVoiceAudioStream
+{
+public:
+    /**
+     * Append received bytes (producer side)
+     */
+    void Append(const uint8* Data, int64 NumBytes);
+
+    /**
+     * Mark the stream as complete (or failed); the consumer drains what it has and stops
+     */
+    void Finish();
+
+    /**
+     * Copy up to MaxBytes of unread audio (consumer side)
+     * @param OutData Receives the audio, resized to the bytes read
+     * @param MaxBytes Upper bound, rounded down to whole samples
+     * @return Bytes read
+     */
+    int32 Read(TArray<uint8>& OutData, int32 MaxBytes);
+
+    /** True once the stream is finished and every byte has been read */
+    bool IsDrained() const;
+
+    /** Copy every byte received so far */
+    void CopyReceived(TArray<uint8>& OutData) const;
+
+    int64 GetNumReceived() const;
+
+private:
+    mutable FCriticalSection Lock;
+    TArray<uint8> Received;
+    int64 ReadOffset = 0;
+    bool bFinished = false;
+};
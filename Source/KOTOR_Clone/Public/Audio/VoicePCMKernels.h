@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Voice PCM kernels - block-oriented synthesis and conversion routines for the voice pipeline.
+ *
+ * Every kernel works on plain contiguous buffers with no per-sample branches or calls, so the
+ * hot loops run four samples per instruction (VectorRegister4Float) or auto-vectorize.
+ * Buffers may be unaligned; tails that are not a multiple of four are handled with scalar code.
+ *
+ * Benchmark: console command "Voice.BenchmarkPCM [Seconds]" compares the kernels against the
+ * scalar per-sample path they replace and logs samples/sec for both.
+ */
+namespace VoicePCM
+{
+    /**
+     * Render a sine oscillator
+     * @param Out Destination samples
+     * @param NumSamples Samples to render
+     * @param Frequency Oscillator frequency (Hz)
+     * @param SampleRate Output sample rate (Hz)
+     * @param Amplitude Peak amplitude (1.0 = full scale)
+     * @param InOutPhase Phase in radians; advanced so consecutive blocks join seamlessly
+     */
+    KOTOR_CLONE_API void GenerateSine(float* Out, int32 NumSamples, float Frequency, float SampleRate, float Amplitude, float& InOutPhase);
+
+    /**
+     * Multiply a buffer by a linear gain ramp (StartGain on the first sample, EndGain after the last)
+     */
+    KOTOR_CLONE_API void ApplyGainRamp(float* Buffer, int32 NumSamples, float StartGain, float EndGain);
+
+    /**
+     * Dest += Source * Gain
+     */
+    KOTOR_CLONE_API void MixInto(float* Dest, const float* Source, int32 NumSamples, float Gain);
+
+    /**
+     * Linear-interpolation resample
+     * @param In Source samples
+     * @param NumIn Source sample count
+     * @param Out Destination samples
+     * @param NumOut Destination sample count (sets the ratio)
+     */
+    KOTOR_CLONE_API void ResampleLinear(const float* In, int32 NumIn, float* Out, int32 NumOut);
+
+    /**
+     * Convert float samples in [-1, 1] to 16-bit PCM, clamping out-of-range values
+     */
+    KOTOR_CLONE_API void FloatToInt16(const float* In, int16* Out, int32 NumSamples);
+
+    /**
+     * Convert 16-bit PCM to float samples in [-1, 1)
+     */
+    KOTOR_CLONE_API void Int16ToFloat(const int16* In, float* Out, int32 NumSamples);
+
+    /**
+     * Render a faded sine tone straight into its final 16-bit buffer, a block at a time
+     * through a small float scratch buffer (no full-length intermediate)
+     * @param Out Destination PCM
+     * @param NumSamples Samples to render
+     * @param Frequency Tone frequency (Hz)
+     * @param SampleRate Output sample rate (Hz)
+     * @param Amplitude Peak amplitude (1.0 = full scale)
+     * @param FadeSamples Linear fade-in and fade-out length, avoids clicks at the clip edges
+     */
+    KOTOR_CLONE_API void RenderTone(int16* Out, int32 NumSamples, float Frequency, float SampleRate, float Amplitude, int32 FadeSamples);
+
+    /** Samples processed per block when rendering through a float scratch buffer */
+    static constexpr int32 BlockSize = 1024;
+}
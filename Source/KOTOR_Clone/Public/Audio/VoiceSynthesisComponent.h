@@ -8,8 +8,14 @@
 #include "Sound/SoundWave.h"
 #include "Engine/Engine.h"
 #include "AIDM/CampaignLoaderSubsystem.h"
+#include "Companions/CompanionBanterEngine.h"
 #include "VoiceSynthesisComponent.generated.h"
 
+// Forward declarations
+class FVoiceAudioStream;
+class USoundWaveProcedural;
+class IHttpRequest;
+
 /**
  * TTS Provider types
  */
@@ -23,6 +29,17 @@ enum class ETTSProvider : uint8
     MockTTS         UMETA(DisplayName = "Mock TTS (Testing)")
 };
 
+/**
+ * TTS request priority; higher priorities are dispatched to the provider first
+ */
+UENUM(BlueprintType)
+enum class ETTSRequestPriority : uint8
+{
+    Prefetch        UMETA(DisplayName = "Prefetch"),
+    Normal          UMETA(DisplayName = "Normal"),
+    Immediate       UMETA(DisplayName = "Immediate (About To Play)")
+};
+
 /**
  * Voice profile data for NPCs
  */
@@ -92,14 +109,72 @@ struct KOTOR_CLONE_API FTTSRequest
     UPROPERTY(BlueprintReadWrite, Category = "TTS")
     bool bCacheAudio;
 
+    UPROPERTY(BlueprintReadWrite, Category = "TTS")
+    ETTSRequestPriority Priority;
+
     FTTSRequest()
     {
         Text = TEXT("");
         RequestID = TEXT("");
         bCacheAudio = true;
+        Priority = ETTSRequestPriority::Normal;
     }
 };
 
+/**
+ * TTS scheduler counters
+ */
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FTTSSchedulerStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 Dispatched; // Requests sent to the provider
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 Coalesced; // Requests that joined an identical queued or in-flight request
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 Prefetched; // Prefetches queued
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 CancelledPrefetches; // Prefetches dropped before dispatch
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 Queued; // Requests waiting for a free slot
+
+    UPROPERTY(BlueprintReadOnly, Category = "TTS Scheduler")
+    int32 InFlight; // Requests the provider is working on
+
+    FTTSSchedulerStats()
+    {
+        Dispatched = 0;
+        Coalesced = 0;
+        Prefetched = 0;
+        CancelledPrefetches = 0;
+        Queued = 0;
+        InFlight = 0;
+    }
+};
+
+/**
+ * One unit of provider work; every request with the same cache key shares it
+ */
+struct FTTSSynthesisJob
+{
+    FTTSRequest Request; // Sent to the provider, RequestID set to the cache key
+    TArray<FString> WaitingRequestIDs; // Empty for pure prefetches
+    ETTSRequestPriority Priority = ETTSRequestPriority::Normal;
+    uint64 Sequence = 0; // FIFO order within a priority
+    bool bInFlight = false;
+    bool bLoadingFromDisk = false; // Reading a disk cache blob; not counted against MaxConcurrentRequests
+
+    // Streaming HTTP providers: audio received so far and the request it arrives on
+    TSharedPtr<FVoiceAudioStream, ESPMode::ThreadSafe> Stream;
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+};
+
 /**
  * Voice synthesis events
  */
@@ -141,7 +216,8 @@ public:
     FString SynthesizeSpeech(const FTTSRequest& Request);
 
     /**
-     * Play synthesized audio
+     * Play synthesized audio. If the request is still being synthesized it is promoted to
+     * Immediate priority and playback starts as soon as the audio arrives.
      * @param RequestID The request ID from synthesis
      * @param AudioComponent Audio component to play through (optional)
      */
@@ -173,6 +249,43 @@ public:
     FString SpeakNPCDialogue(const FNPCData& NPCData, const FString& DialogueText, 
                             UAudioComponent* AudioComponent = nullptr);
 
+    /**
+     * Synthesize a line in the background so it is cached before it is needed
+     * @param Text The text to synthesize
+     * @param VoiceProfile Voice to synthesize with
+     * @return False if the line is already cached or caching is disabled
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voice Synthesis")
+    bool PrefetchSpeech(const FString& Text, const FVoiceProfile& VoiceProfile);
+
+    /**
+     * Prefetch lines an NPC may speak next (e.g. the responses to every dialogue option).
+     * Lines are resolved exactly like SpeakNPCDialogue, so the prefetched audio is a cache hit.
+     * @param NPCData NPC that would speak the lines
+     * @param Lines Candidate lines
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voice Synthesis")
+    void PrefetchNPCDialogue(const FNPCData& NPCData, const TArray<FString>& Lines);
+
+    /**
+     * Drop queued prefetches nobody is waiting for (e.g. when the dialogue options change)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voice Synthesis")
+    void CancelPrefetches();
+
+    /**
+     * Prefetch every line of a banter conversation as soon as it starts
+     * @param BanterEngine Banter engine to listen to
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voice Synthesis")
+    void RegisterBanterEngine(UCompanionBanterEngine* BanterEngine);
+
+    /**
+     * Get scheduler counters
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Voice Synthesis")
+    FTTSSchedulerStats GetSchedulerStats() const;
+
     /**
      * Check if audio is cached for a specific text and voice
      * @param Text The text to check
@@ -184,9 +297,10 @@ public:
 
     /**
      * Clear audio cache
+     * @param bIncludeDiskCache Also delete the audio cached on disk (shared by every component)
      */
     UFUNCTION(BlueprintCallable, Category = "Voice Synthesis")
-    void ClearAudioCache();
+    void ClearAudioCache(bool bIncludeDiskCache = false);
 
     /**
      * Get available voice profiles
@@ -227,7 +341,26 @@ protected:
     bool bEnableAudioCaching;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis")
-    int32 MaxCacheSize; // Maximum number of cached audio files
+    int32 MaxCacheSize; // Maximum number of sound waves kept in memory
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis")
+    bool bEnableDiskCache; // Persist synthesized audio under Saved/VoiceCache across sessions
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis", meta = (ClampMin = "0"))
+    int32 MaxDiskCacheMB; // Disk cache budget; least recently used audio is evicted first
+
+    // Scheduler settings
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis|Scheduler", meta = (ClampMin = "1"))
+    int32 MaxConcurrentRequests; // Provider requests allowed in flight at once
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis|Scheduler")
+    bool bEnablePrefetch;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis|Scheduler", meta = (ClampMin = "0.0"))
+    float MockLatency; // Simulated MockTTS round trip in seconds (0 = synchronous)
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis")
+    bool bStreamPlayback; // Start playing HTTP provider audio on its first chunk instead of the full clip
 
     // Voice profiles
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Synthesis")
@@ -244,10 +377,33 @@ protected:
     UPROPERTY()
     TMap<FString, USoundWave*> AudioCache;
 
+    // AudioCache keys, least recently used first
+    TArray<FString> AudioCacheOrder;
+
     // Active requests
     UPROPERTY()
     TMap<FString, FTTSRequest> ActiveRequests;
 
+    // Scheduler state: cache key -> job
+    TMap<FString, FTTSSynthesisJob> SynthesisJobs;
+    int32 NumInFlightJobs;
+    uint64 NextJobSequence;
+    bool bIsPumpingSynthesisQueue;
+    FTTSSchedulerStats SchedulerStats;
+
+    // Requests PlaySynthesizedAudio was called for before their audio arrived
+    TMap<FString, TWeakObjectPtr<UAudioComponent>> PendingPlayback;
+
+    // Procedural waves playing a response that is still downloading (cache key -> wave)
+    UPROPERTY()
+    TMap<FString, USoundWaveProcedural*> StreamingWaves;
+
+    // Audio component the current line is playing on
+    TWeakObjectPtr<UAudioComponent> PlaybackAudioComponent;
+
+    // Banter engine whose speakers are prefetched; resolves speaker names to companions
+    TWeakObjectPtr<UCompanionBanterEngine> RegisteredBanterEngine;
+
     // Audio component for playback
     UPROPERTY()
     UAudioComponent* DefaultAudioComponent;
@@ -266,19 +422,46 @@ private:
     void SynthesizeWithOpenTTS(const FTTSRequest& Request);
     void SynthesizeWithLocalTTS(const FTTSRequest& Request);
     void SynthesizeWithMockTTS(const FTTSRequest& Request);
+    void CompleteMockTTS(const FTTSRequest& Request);
+
+    // Scheduler
+    void EnqueueSynthesis(const FString& CacheKey, const FTTSRequest& Request, const FString& WaitingRequestID);
+    void PumpSynthesisQueue();
+    void DispatchToProvider(const FTTSRequest& ProviderRequest);
+    void CompleteSynthesisJob(const FString& CacheKey, USoundWave* SoundWave);
+    void FailSynthesisJob(const FString& CacheKey, const FString& ErrorMessage);
+    FString ResolveNPCDialogueText(const FNPCData& NPCData, const FString& DialogueText);
+
+    // Disk cache hits: the blob is read on a worker thread, then promoted into the memory cache
+    bool StartDiskCacheLoad(const FString& CacheKey, const FTTSRequest& Request, const FString& WaitingRequestID);
+    void HandleDiskCacheLoaded(const FString& CacheKey, TArray<uint8> AudioData, int32 SampleRate, int32 NumChannels);
+    void StartPlayback(const FString& RequestID, USoundWave* SoundWave, UAudioComponent* AudioComponent);
+
+    // Streaming playback
+    void AttachResponseStream(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const FString& CacheKey);
+    void HandleStreamStarted(const FString& CacheKey);
+    USoundWaveProcedural* GetOrCreateStreamingWave(const FString& CacheKey);
+    void HandleProceduralWaveDrained(const USoundWave* SoundWave);
+
+    UFUNCTION()
+    void HandleBanterStarted(const FBanterConversation& Conversation);
+    FNPCData ResolveBanterSpeaker(const FString& SpeakerName) const;
 
     // Helper methods
     FString GenerateRequestID();
-    FString GenerateCacheKey(const FString& Text, const FVoiceProfile& VoiceProfile);
-    USoundWave* CreateSoundWaveFromData(const TArray<uint8>& AudioData);
-    void OnAudioPlaybackFinished();
+    FString GenerateCacheKey(const FString& Text, const FVoiceProfile& VoiceProfile) const;
+    USoundWave* CreateSoundWaveFromData(const TArray<uint8>& AudioData, int32 SampleRate = 44100, int32 NumChannels = 1);
+    void OnAudioPlaybackFinished(UAudioComponent* AudioComponent);
 
     // HTTP request handling
-    void HandleHTTPResponse(class FHttpRequestPtr Request, class FHttpResponsePtr Response, bool bWasSuccessful, FString RequestID);
+    void HandleHTTPResponse(class FHttpRequestPtr Request, class FHttpResponsePtr Response, bool bWasSuccessful, FString CacheKey);
 
     // Audio cache management
-    void AddToCache(const FString& CacheKey, USoundWave* SoundWave);
+    void AddToCache(const FString& CacheKey, USoundWave* SoundWave, TArray<uint8> AudioData,
+                    int32 SampleRate = 44100, int32 NumChannels = 1);
+    void AddToMemoryCache(const FString& CacheKey, USoundWave* SoundWave);
     USoundWave* GetFromCache(const FString& CacheKey);
+    void TouchCacheEntry(const FString& CacheKey);
     void CleanupCache();
 
 public:
@@ -6,9 +6,11 @@
 #include "Components/ActorComponent.h"
 #include "Companions/CompanionManagerComponent.h"
 #include "Narrative/NarrativeMemoryComponent.h"
-#include "Audio/VoiceSynthesisComponent.h"
 #include "CompanionBanterEngine.generated.h"
 
+// Forward declarations
+class UVoiceSynthesisComponent;
+
 /**
  * Banter types
  */
@@ -312,6 +314,9 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Companion Banter")
     TArray<FCompanionRelationship> GetAllCompanionRelationships() const { return CompanionRelationships; }
 
+    /** Companion manager the banter participants are looked up in */
+    UCompanionManagerComponent* GetCompanionManager() const { return CompanionManagerRef; }
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Banter Events")
     FOnBanterStarted OnBanterStarted;
@@ -7,6 +7,8 @@
 #include "GameFramework/Pawn.h"
 #include "AIDM/CampaignLoaderSubsystem.h"
 #include "AIDM/QuestManagerComponent.h"
+#include "AIDM/AIDMSymbolTable.h"
+#include "AIDM/SaveGameContainer.h"
 #include "CompanionManagerComponent.generated.h"
 
 /**
@@ -120,6 +122,10 @@ struct KOTOR_CLONE_API FActiveCompanion
     UPROPERTY(BlueprintReadWrite, Category = "Companion")
     FCompanionData CompanionData;
 
+    // Interned CompanionData.Name used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Companion")
+    FAIDMId CompanionSymbol;
+
     UPROPERTY(BlueprintReadWrite, Category = "Companion")
     ECompanionLoyalty Loyalty;
 
@@ -181,6 +187,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -311,6 +318,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Companion Manager")
     bool LoadCompanionData(const FString& SaveData);
 
+    /**
+     * Write companion data into its chunk of a binary save container (JSON remains the export format)
+     * Skips encoding entirely if no companion changed since the chunk was last written to or read from this container
+     */
+    void WriteSaveChunk(FSaveGameContainer& Container) const;
+
+    /**
+     * Load companion data from a binary save container
+     * @return True if the companion chunk was present and decoded
+     */
+    bool ReadSaveChunk(const FSaveGameContainer& Container);
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Companion Events")
     FOnCompanionRecruited OnCompanionRecruited;
@@ -358,10 +377,17 @@ protected:
     UQuestManagerComponent* QuestManagerRef;
 
 private:
+    // Companion symbol -> slot in ActiveCompanions (companions are never un-recruited, so slots are stable)
+    TMap<FAIDMId, int32> ActiveCompanionSlots;
+
+    // Bumped by every change to recruitment, party, orders or loyalty
+    FSaveChunkRevision SaveRevision;
+
     // Helper methods
     FActiveCompanion* FindActiveCompanion(const FString& CompanionName);
     const FActiveCompanion* FindActiveCompanion(const FString& CompanionName) const;
     void LoadCompanionsFromCampaign();
+    void HandleSymbolsReset();
     void SpawnCompanionPawn(FActiveCompanion& Companion);
     void DespawnCompanionPawn(FActiveCompanion& Companion);
     ECompanionLoyalty CalculateLoyaltyLevel(int32 LoyaltyPoints) const;
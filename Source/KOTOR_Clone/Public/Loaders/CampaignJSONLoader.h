@@ -20,7 +20,8 @@ enum class EJSONParseResult : uint8
     InvalidJSON         UMETA(DisplayName = "Invalid JSON"),
     MissingRequiredData UMETA(DisplayName = "Missing Required Data"),
     VersionMismatch     UMETA(DisplayName = "Version Mismatch"),
-    CorruptedData       UMETA(DisplayName = "Corrupted Data")
+    CorruptedData       UMETA(DisplayName = "Corrupted Data"),
+    Cancelled           UMETA(DisplayName = "Cancelled")
 };
 
 /**
@@ -162,8 +163,8 @@ public:
     FString ConvertCampaignToJSON(const FCampaignPlan& CampaignData, bool bPrettyPrint = true);
 
     /**
-     * Validate JSON campaign data
-     * @param JSONObject JSON object to validate
+     * Validate JSON campaign data without keeping the parsed campaign
+     * @param JSONString JSON string to validate
      * @return Validation result
      */
     UFUNCTION(BlueprintCallable, Category = "Campaign JSON Loader")
@@ -206,6 +207,14 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Campaign JSON Loader")
     FCampaignPlan GetLastLoadedCampaign() const { return LastLoadedCampaign; }
 
+    /**
+     * Get the validation result collected by the last load
+     * Loads parse and validate in a single pass, so there is no need to call ValidateJSONCampaign first
+     * @return Errors and warnings from the last LoadCampaignFromFile/LoadCampaignFromString
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Campaign JSON Loader")
+    FJSONValidationResult GetLastValidationResult() const { return LastValidationResult; }
+
     /**
      * Check if campaign file exists
      * @param FilePath Path to check
@@ -246,6 +255,9 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Campaign Data")
     FCampaignPlan LastLoadedCampaign;
 
+    UPROPERTY(BlueprintReadOnly, Category = "Campaign Data")
+    FJSONValidationResult LastValidationResult;
+
     UPROPERTY(BlueprintReadOnly, Category = "Campaign Data")
     TArray<FCampaignFileMetadata> AvailableCampaigns;
 
@@ -294,6 +306,9 @@ private:
     bool SaveStringToFile(const FString& Content, const FString& FilePath);
     FCampaignFileMetadata ExtractMetadataFromFile(const FString& FilePath);
     
+    // Shared completion for the streaming load paths
+    EJSONParseResult FinishCampaignLoad(const FString& SourceName, EJSONParseResult Result, FCampaignPlan& CampaignData, bool bValidateData);
+
     // Utility methods
     void LoadDefaultSettings();
     void StartAutoRefresh();
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Loaders/CampaignJSONLoader.h"
+
+/**
+ * Campaign JSON Stream Reader - single-pass campaign parser built on the TJsonReader token stream.
+ *
+ * Unlike FJsonSerializer::Deserialize no DOM is built: tokens are written straight into
+ * FCampaignPlan and validation errors/warnings are collected in the same pass. File input is
+ * streamed through an FArchive, so the only transient state is the planet currently being parsed.
+ */
+class KOTOR_CLONE_API FCampaignJSONStreamReader
+{
+public:
+    /**
+     * Progress callback invoked after each planet is parsed.
+     * Receives bytes consumed so far, total bytes (0 for in-memory input) and planets parsed.
+     * Return false to cancel the parse. May be called from a worker thread.
+     */
+    using FProgressCallback = TFunction<bool(int64 BytesRead, int64 TotalBytes, int32 PlanetsParsed)>;
+
+    /**
+     * Parse and validate a campaign file in one pass
+     * @param FilePath Absolute path to the JSON campaign file
+     * @param OutPlan Receives the parsed campaign
+     * @param OutValidation Receives errors and warnings found while parsing
+     * @param Progress Optional progress/cancellation callback
+     * @return Parse result (Cancelled if Progress returned false)
+     */
+    static EJSONParseResult ReadFromFile(const FString& FilePath, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation,
+                                         const FProgressCallback& Progress = FProgressCallback());
+
+    /**
+     * Parse and validate campaign file bytes that are already in memory. Lets callers that also
+     * need the raw bytes (e.g. to hash them for the cooked cache) read the file only once.
+     * @param FileBytes UTF-8 contents of a campaign file
+     * @param OutPlan Receives the parsed campaign
+     * @param OutValidation Receives errors and warnings found while parsing
+     * @param Progress Optional progress/cancellation callback
+     * @return Parse result (Cancelled if Progress returned false)
+     */
+    static EJSONParseResult ReadFromBytes(TConstArrayView<uint8> FileBytes, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation,
+                                          const FProgressCallback& Progress = FProgressCallback());
+
+    /**
+     * Parse and validate a campaign held in memory in one pass
+     * @param JSONString JSON string containing campaign data
+     * @param OutPlan Receives the parsed campaign
+     * @param OutValidation Receives errors and warnings found while parsing
+     * @return Parse result
+     */
+    static EJSONParseResult ReadFromString(const FString& JSONString, FCampaignPlan& OutPlan, FJSONValidationResult& OutValidation);
+};
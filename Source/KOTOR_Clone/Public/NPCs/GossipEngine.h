@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/AIDMSymbolTable.h"
+
+// Forward declarations
+struct FGossipPropagation;
+enum class EMemoryReliability : uint8;
+
+/** Directed edge of the social graph: who an NPC may pass gossip to */
+struct FGossipEdge
+{
+    int32 Target = INDEX_NONE;       // Node slot
+    int32 Relationship = INDEX_NONE; // Index into the owner's FSocialRelationship array
+    float TrustLevel = 0.5f;
+    float GossipProbability = 0.3f;
+};
+
+/** A rumor arriving at an NPC, handed to the caller in delivery order */
+struct FGossipDelivery
+{
+    int32 Rumor = INDEX_NONE;        // Caller-defined key (e.g. interned MemoryID of the original)
+    int32 SourceNode = INDEX_NONE;
+    int32 TargetNode = INDEX_NONE;
+    int32 Relationship = INDEX_NONE; // Edge it travelled along
+    float Time = 0.0f;
+    EMemoryReliability Reliability = {};
+    uint8 Hops = 0;
+};
+
+struct FGossipEngineSettings
+{
+    uint32 Seed = 0;
+    float MinDelay = 5.0f;   // Seconds for a fully trusted friend to pass a rumor on
+    float MaxDelay = 60.0f;  // ... and for a stranger
+    int32 MaxHops = 4;       // Rumors stop spreading after this many retellings
+};
+
+/**
+ * Incremental gossip engine for UNPCMemoryMatrixComponent.
+ *
+ * NPCs are nodes of a sparse social graph (per-node adjacency lists). Pending retellings sit
+ * in a binary heap ordered by (time, sequence); Process pops at most a fixed number of them
+ * per call, so a frame's cost is bounded no matter how large the town is. Each delivered
+ * rumor schedules rolls only for the receiver's neighbours, never a scan of all NPCs.
+ *
+ * Every roll uses its own random stream seeded from (Seed, sequence number), and sequence
+ * numbers are assigned in pop order, so a run replays exactly for the same seed and inputs
+ * regardless of how the work was split across frames.
+ */
+class KOTOR_CLONE_API FGossipEngine
+{
+public:
+    void Reset();
+    void SetSettings(const FGossipEngineSettings& InSettings) { Settings = InSettings; }
+    const FGossipEngineSettings& GetSettings() const { return Settings; }
+
+    /** Find or create the node for an NPC */
+    int32 AddNode(FAIDMId NPC);
+    int32 FindNode(FAIDMId NPC) const;
+    FAIDMId GetNPC(int32 Node) const { return NodeNPCs[Node]; }
+    int32 NumNodes() const { return NodeNPCs.Num(); }
+
+    /** Add or update the directed edge From -> To */
+    void SetEdge(int32 FromNode, int32 ToNode, int32 Relationship, float TrustLevel, float GossipProbability);
+
+    /** Add or update edges in both directions */
+    void SetMutualEdge(int32 NodeA, int32 NodeB, int32 Relationship, float TrustLevel, float GossipProbability);
+
+    TConstArrayView<FGossipEdge> GetEdges(int32 Node) const;
+
+    /**
+     * An NPC learned something first-hand; roll retellings to their neighbours
+     * @return False if the NPC already knew the rumor
+     */
+    bool SeedRumor(int32 Node, int32 Rumor, EMemoryReliability Reliability, float Time);
+
+    /**
+     * Deliver due rumors (Time <= CurrentTime), at most MaxDeliveries of them
+     * @return Number delivered; the rest stay queued for the next call
+     */
+    int32 Process(float CurrentTime, int32 MaxDeliveries, TFunctionRef<void(const FGossipDelivery&)> OnDelivered);
+
+    bool HasHeard(int32 Node, int32 Rumor) const { return Heard.Contains(MakeKey(Node, Rumor)); }
+    int32 NumPending() const { return Pending.Num(); }
+
+    /** Record that an NPC knows a rumor without scheduling retellings (restoring a save) */
+    void MarkHeard(int32 Node, int32 Rumor) { AddHeard(Node, Rumor); }
+
+    /**
+     * Forget rumors nobody remembers any more: drops who has heard them and any queued retellings.
+     * Keeps the heard set proportional to the rumors still alive, and lets a key be reused.
+     */
+    void RetireRumors(TConstArrayView<int32> Rumors);
+
+    /** Queued retellings in heap order (for saving) */
+    void GetPending(TArray<FGossipDelivery>& OutPending) const;
+
+    /** Queue a saved retelling again; it keeps its time and gets a fresh sequence number */
+    void RestorePending(const FGossipDelivery& Delivery);
+
+    /** Expand a delivery into the Blueprint-facing struct */
+    FGossipPropagation ToPropagation(const FGossipDelivery& Delivery, const FString& MemoryID) const;
+
+private:
+    struct FPendingGossip
+    {
+        float Time;
+        uint32 Sequence;
+        int32 Rumor;
+        int32 SourceNode;
+        int32 TargetNode;
+        int32 Relationship;
+        EMemoryReliability Reliability;
+        uint8 Hops;
+
+        bool operator<(const FPendingGossip& Other) const
+        {
+            return Time != Other.Time ? Time < Other.Time : Sequence < Other.Sequence;
+        }
+    };
+
+    static uint64 MakeKey(int32 Node, int32 Rumor) { return (static_cast<uint64>(static_cast<uint32>(Node)) << 32) | static_cast<uint32>(Rumor); }
+
+    /** Mark (Node, Rumor) as heard @return False if it already was */
+    bool AddHeard(int32 Node, int32 Rumor);
+
+    /** Roll a retelling along each outgoing edge of Node */
+    void ScheduleRetellings(int32 Node, int32 Rumor, EMemoryReliability Reliability, uint8 Hops, float Time);
+
+    FGossipEngineSettings Settings;
+
+    TArray<FAIDMId> NodeNPCs;
+    TMap<FAIDMId, int32> NodeByNPC;
+
+    // Most NPCs know a handful of others
+    TArray<TArray<FGossipEdge, TInlineAllocator<4>>> Adjacency;
+
+    TArray<FPendingGossip> Pending; // Binary heap
+    TSet<uint64> Heard;             // (node, rumor) pairs already delivered or seeded
+    TMap<int32, TArray<int32, TInlineAllocator<4>>> ListenersByRumor; // Rumor -> nodes in Heard, for RetireRumors
+    uint32 NextSequence = 0;
+};
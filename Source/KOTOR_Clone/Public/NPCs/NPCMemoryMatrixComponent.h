@@ -6,6 +6,9 @@
 #include "Components/ActorComponent.h"
 #include "Narrative/NarrativeMemoryComponent.h"
 #include "Politics/FactionDiplomacySystem.h"
+#include "NPCs/NPCMemoryStore.h"
+#include "NPCs/GossipEngine.h"
+#include "AIDM/SaveGameContainer.h"
 #include "NPCMemoryMatrixComponent.generated.h"
 
 /**
@@ -49,6 +52,10 @@ struct KOTOR_CLONE_API FNPCMemoryEntry
     UPROPERTY(BlueprintReadWrite, Category = "NPC Memory")
     FString MemoryID;
 
+    // Interned MemoryID used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "NPC Memory")
+    FAIDMId MemorySymbol;
+
     UPROPERTY(BlueprintReadWrite, Category = "NPC Memory")
     ENPCMemoryType MemoryType;
 
@@ -195,6 +202,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -310,6 +318,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "NPC Memory")
     void SetGossipPropagationEnabled(bool bEnabled);
 
+    /** Indexed memory storage (handles are stable until the memory is removed) */
+    const FNPCMemoryStore& GetMemoryStore() const { return MemoryStore; }
+
+    /**
+     * Write every NPC memory and pending retelling into its chunk of a binary save container.
+     * This is the serialized form of MemoryStore and GossipEngine, which are not reflected.
+     * Skips encoding entirely if neither changed since the chunk was last written to or read from this container.
+     */
+    void WriteSaveChunk(FSaveGameContainer& Container) const;
+
+    /**
+     * Replace NPC memories and pending gossip with the contents of a binary save container
+     * @return True if the NPC memory chunk was present and decoded
+     */
+    bool ReadSaveChunk(const FSaveGameContainer& Container);
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "NPC Memory Events")
     FOnNPCMemoryAdded OnNPCMemoryAdded;
@@ -321,22 +345,15 @@ public:
     FOnNPCReactionTriggered OnNPCReactionTriggered;
 
 protected:
-    // Memory data
-    UPROPERTY(BlueprintReadOnly, Category = "NPC Memory")
-    /*
-     * NOTE:
-     * UPROPERTY/UHT cannot serialise nested containers such as
-     *     TMap<FString, TArray<FNPCMemoryEntry>>
-     * We therefore store all items in a single flat array and, at runtime,
-     * helper functions filter/group by FString when needed.
-     */
-    TArray<FNPCMemoryEntry>NPCMemories; // NPCID -> Memories
+    // Memory data: indexed by NPC, (NPC, subject) and (NPC, event); not reflected, see FNPCMemoryStore
+    FNPCMemoryStore MemoryStore;
 
     UPROPERTY(BlueprintReadOnly, Category = "NPC Memory")
     TArray<FSocialRelationship> SocialRelationships;
 
-    UPROPERTY(BlueprintReadOnly, Category = "NPC Memory")
-    TArray<FGossipPropagation> PendingGossip;
+    // Social graph and pending retellings; rebuilt from SocialRelationships, see FGossipEngine.
+    // Rumors are keyed by the interned MemoryID, which hearsay shares with the original.
+    FGossipEngine GossipEngine;
 
     // Component references
     UPROPERTY()
@@ -352,6 +369,12 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Settings")
     float GossipPropagationInterval; // Seconds between gossip checks
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Settings")
+    int32 MaxGossipDeliveriesPerTick; // Work budget for ProcessPendingGossip
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Settings")
+    int32 GossipSeed; // Same seed and inputs replay the same gossip
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Settings")
     float MemoryDecayRate; // How fast memories fade
 
@@ -362,16 +385,25 @@ protected:
     FTimerHandle GossipTimer;
     FTimerHandle MemoryDecayTimer;
 
+    // Bumped whenever a memory is stored or forgotten, or the retelling queue changes
+    FSaveChunkRevision SaveRevision;
+
 private:
     // Helper methods
     FString GenerateMemoryID();
-    void ProcessMemoryDecay();
+    float GetMemoryTime() const; // World time memories are stamped and decayed with
+    void RestartTimers();
+    void HandleSymbolsReset(); // NPC and memory symbols are campaign-scoped; drop the old campaign's memories
+    void ProcessMemoryDecay(); // MemoryStore.ExpireMemories: drops whole decay buckets
     void ProcessPendingGossip();
-    TArray<FNPCMemoryEntry>* FindNPCMemories(const FString& NPCID);
+    TConstArrayView<int32> FindNPCMemories(const FString& NPCID) const;
+    TConstArrayView<int32> FindNPCMemories(FAIDMId NPCSymbol) const;
+    int32 FindNPCMemory(FAIDMId NPCSymbol, FAIDMId MemorySymbol) const; // Store handle of the NPC's copy, or INDEX_NONE
     FSocialRelationship* FindSocialRelationship(const FString& NPCID, const FString& RelatedNPCID);
-    TArray<FString> FindPotentialGossipTargets(const FString& SourceNPC, const FNPCMemoryEntry& Memory);
-    float CalculateGossipProbability(const FString& SourceNPC, const FString& TargetNPC, const FNPCMemoryEntry& Memory);
+    void RebuildGossipGraph();
+    void OnGossipDelivered(const FGossipDelivery& Delivery);
     void TrimOldMemories(const FString& NPCID);
+    void RetireForgottenRumors(); // Hand memories the store has fully forgotten to GossipEngine.RetireRumors
 
     // Event handlers
     UFUNCTION()
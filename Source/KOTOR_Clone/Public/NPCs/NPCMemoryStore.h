@@ -0,0 +1,210 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/AIDMSymbolTable.h"
+#include "Narrative/MemoryDecayBuckets.h"
+
+// Forward declarations
+struct FNPCMemoryEntry;
+enum class ENPCMemoryType : uint8;
+enum class EMemoryReliability : uint8;
+
+/**
+ * One NPC memory in compact form: fixed size, strings replaced by pool indices and
+ * interned IDs. Witnesses, which most memories do not have, live in a side table.
+ */
+struct FNPCMemoryRecord
+{
+    FAIDMId Owner;              // NPC holding the memory
+    FAIDMId Memory;             // Interned MemoryID
+    FAIDMId Source;             // NPC who told them (gossip), or invalid
+    int32 Subject = INDEX_NONE; // String pool indices
+    int32 Event = INDEX_NONE;
+    int32 Context = INDEX_NONE;
+    float Timestamp = 0.0f;
+    float EmotionalWeight = 0.0f;
+    float DecayRate = 0.0f;
+    uint32 Sequence = 0;        // Insertion order; the handle lists below are unordered
+    int32 OwnerSlot = INDEX_NONE;   // Position in the per-NPC and per-(NPC, subject) lists, for O(1) removal
+    int32 SubjectSlot = INDEX_NONE;
+    ENPCMemoryType Type = {};
+    EMemoryReliability Reliability = {};
+    bool bSharedWithOthers = false;
+    bool bHasWitnesses = false;
+};
+
+/**
+ * Indexed NPC memory store for UNPCMemoryMatrixComponent.
+ *
+ * Records live in a sparse array (stable handles, holes reused) and are reachable through:
+ *   - a per-NPC index,
+ *   - a per-(NPC, subject) index,
+ *   - a per-(NPC, event) count for "does this NPC know about X",
+ *   - a running opinion-of-player sum per NPC, decayed on read.
+ * Lookups are hash probes returning views; nothing scans other NPCs' memories. Each record knows
+ * its position in the handle lists, so removal swaps the last handle in and the lists are unordered;
+ * GetMemoriesOldestFirst sorts by insertion sequence when order matters.
+ *
+ * Reliability decays lazily (see MemoryDecay): the stored value is the one the memory was formed
+ * with, and readers pass the current time. A memory is forgotten once it would decay past Rumor;
+ * ExpireMemories drops those by whole decay bucket.
+ *
+ * Subject, event and context strings are pooled (case-insensitive) and never removed until Reset.
+ */
+class KOTOR_CLONE_API FNPCMemoryStore
+{
+public:
+    /** Subject string that counts toward an NPC's opinion of the player */
+    static const TCHAR* const PlayerSubject;
+
+    /** Drop every memory and pooled string */
+    void Reset();
+
+    /**
+     * Store a memory for an NPC
+     * @return Handle of the new record
+     */
+    int32 Add(FAIDMId Owner, const FNPCMemoryEntry& Entry);
+
+    /** Remove a record and unhook it from every index */
+    void Remove(int32 Handle);
+
+    /** Change a record's base reliability (e.g. a rumor confirmed), keeping the opinion sum and expiry in step */
+    void SetReliability(int32 Handle, EMemoryReliability NewReliability);
+
+    void MarkShared(int32 Handle) { Records[Handle].bSharedWithOthers = true; }
+
+    bool IsValidHandle(int32 Handle) const { return Records.IsValidIndex(Handle); }
+    const FNPCMemoryRecord& Get(int32 Handle) const { return Records[Handle]; }
+
+    /** Expand a record into the Blueprint-facing struct, with reliability decayed to Now */
+    FNPCMemoryEntry ToEntry(int32 Handle, float Now) const;
+
+    /** Forget every memory that has decayed past Rumor by Now; cost scales with the number forgotten */
+    int32 ExpireMemories(float Now);
+
+    /** Forget an NPC's oldest memories until at most MaxMemories remain */
+    int32 TrimOwner(FAIDMId Owner, int32 MaxMemories);
+
+    /** Handles of an NPC's memories (unordered) */
+    TConstArrayView<int32> GetMemories(FAIDMId Owner) const;
+
+    /** Handles of an NPC's memories in the order they were stored */
+    void GetMemoriesOldestFirst(FAIDMId Owner, TArray<int32>& OutHandles) const;
+
+    /** Handles of an NPC's memories about a subject (unordered) */
+    TConstArrayView<int32> GetMemoriesAbout(FAIDMId Owner, const FString& Subject) const;
+
+    /** True if the NPC has any memory of the event */
+    bool KnowsAbout(FAIDMId Owner, const FString& Event) const;
+
+    /**
+     * Reliability-weighted average emotional weight of the NPC's memories about the player (-1 to 1),
+     * with reliability decayed to Now. Applies the reliability drops due since the last read, so the
+     * cost scales with how many of the NPC's memories lost a level in between. Game thread only.
+     */
+    float GetOpinionOfPlayer(FAIDMId Owner, float Now) const;
+
+    /** Pooled string for an index (empty for INDEX_NONE) */
+    const FString& GetString(int32 StringIndex) const;
+
+    /** How much a memory of this reliability counts toward opinions */
+    static float GetReliabilityWeight(EMemoryReliability Reliability);
+
+    /** Reliability of a memory at time Now */
+    static EMemoryReliability GetEffectiveReliability(const FNPCMemoryRecord& Record, float Now);
+
+    /** Time at which a memory decays past Rumor (max float if it never does) */
+    static float GetExpiryTime(const FNPCMemoryRecord& Record);
+
+    /**
+     * Memories (interned MemoryIDs) whose last copy has been removed since the previous call.
+     * Lets the gossip engine retire rumors nobody remembers.
+     */
+    void TakeForgottenMemories(TArray<FAIDMId>& OutMemories);
+
+    /** Every NPC holding at least one memory (unordered) */
+    void GetOwners(TArray<FAIDMId>& OutOwners) const { ByOwner.GenerateKeyArray(OutOwners); }
+
+    int32 Num() const { return Records.Num(); }
+    int32 NumFor(FAIDMId Owner) const { return GetMemories(Owner).Num(); }
+
+private:
+    using FHandleList = TArray<int32, TInlineAllocator<4>>;
+
+    static uint64 MakeKey(FAIDMId Owner, int32 StringIndex) { return (static_cast<uint64>(static_cast<uint32>(Owner.Index)) << 32) | static_cast<uint32>(StringIndex); }
+
+    /** Emotionally charged memories fade up to twice as slowly */
+    static float GetDecayRate(const FNPCMemoryRecord& Record) { return Record.DecayRate * (1.0f - 0.5f * FMath::Min(FMath::Abs(Record.EmotionalWeight), 1.0f)); }
+
+    /** Unhook a record from every index; bFiled is false when the decay buckets already released it */
+    void RemoveRecord(int32 Handle, bool bFiled);
+
+    int32 InternString(const FString& String);
+    int32 FindString(const FString& String) const;
+    bool IsAboutPlayer(const FNPCMemoryRecord& Record) const { return Record.Subject != INDEX_NONE && Record.Subject == PlayerSubjectIndex; }
+
+    /** Memory about the player as counted in an opinion sum */
+    struct FCountedMemory
+    {
+        uint32 Serial = 0;  // Distinguishes re-counts (handle reuse, SetReliability) from stale steps
+        uint8 Level = 0;    // Reliability level the memory is counted at
+    };
+
+    /** The next reliability drop of one counted memory */
+    struct FOpinionStep
+    {
+        float Time = 0.0f;
+        int32 Handle = INDEX_NONE;
+        uint32 Serial = 0;
+        uint8 ToLevel = 0;
+
+        bool operator<(const FOpinionStep& Other) const { return Time < Other.Time; }
+    };
+
+    /**
+     * Opinion sums valid as of AsOf. Reliability only drops in whole levels at known times, so
+     * each counted memory has one pending step in a min-heap and a read pops the steps that are due.
+     */
+    struct FOpinion
+    {
+        float WeightedSum = 0.0f;
+        float TotalWeight = 0.0f;
+        float AsOf = 0.0f;
+        TMap<int32, FCountedMemory> Counted;
+        TArray<FOpinionStep> Steps;
+    };
+
+    void AddToOpinion(int32 Handle);
+    void RemoveFromOpinion(int32 Handle);
+    void ScheduleOpinionStep(FOpinion& Opinion, int32 Handle, const FCountedMemory& Counted) const;
+    void AdvanceOpinion(FOpinion& Opinion, float Now) const;
+
+    TSparseArray<FNPCMemoryRecord> Records;
+
+    // Handle -> witnesses, only for records with bHasWitnesses
+    TMap<int32, TArray<FAIDMId>> Witnesses;
+
+    TMap<FAIDMId, TArray<int32>> ByOwner;
+    TMap<uint64, FHandleList> ByOwnerSubject;
+    TMap<uint64, int32> EventCounts;
+
+    // Mutable: reads apply due decay steps in place
+    mutable TMap<FAIDMId, FOpinion> Opinions;
+    uint32 NextOpinionSerial = 0;
+    uint32 NextSequence = 0;
+
+    // Interned MemoryID -> number of NPCs holding a copy (hearsay shares the original's ID)
+    TMap<FAIDMId, int32> CopyCounts;
+    TArray<FAIDMId> ForgottenMemories;
+
+    FMemoryDecayBuckets DecayBuckets;
+    TArray<int32> ExpiredScratch;
+
+    int32 PlayerSubjectIndex = INDEX_NONE;
+
+    TArray<FString> Strings;
+    TMap<FString, int32> StringLookup;
+};
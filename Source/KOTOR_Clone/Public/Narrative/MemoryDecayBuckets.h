@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Lazy decay helpers shared by narrative and NPC memories.
+ * Decay rates are in levels per in-game hour; timestamps are in seconds. A memory's decayed
+ * importance/reliability is a pure function of its creation time, so nothing is rewritten
+ * on a timer - readers compute it, and only the expiry time is tracked.
+ */
+namespace MemoryDecay
+{
+    constexpr float SecondsPerHour = 3600.0f;
+
+    /** Whole levels a memory has lost by Now */
+    inline int32 GetLevelsLost(float Timestamp, float DecayRate, float Now)
+    {
+        const float AgeHours = FMath::Max(Now - Timestamp, 0.0f) / SecondsPerHour;
+        return DecayRate > 0.0f ? FMath::FloorToInt32(FMath::Min(AgeHours * DecayRate, 255.0f)) : 0;
+    }
+
+    /** Time at which a memory will have lost Levels levels, or never (max float) */
+    inline float GetTimeToLose(float Timestamp, float DecayRate, int32 Levels)
+    {
+        return DecayRate > 0.0f ? Timestamp + Levels / DecayRate * SecondsPerHour : TNumericLimits<float>::Max();
+    }
+}
+
+/**
+ * Timestamp buckets of memories waiting to expire.
+ *
+ * Handles are filed under floor(ExpiryTime / BucketSeconds). Expiring pops whole buckets off a
+ * min-heap of bucket keys, so the periodic cost is proportional to the number of memories that
+ * expire rather than the number stored. A memory may outlive its expiry time by up to one bucket.
+ * Each handle's position within its bucket is tracked so Remove is an O(1) swap.
+ */
+class KOTOR_CLONE_API FMemoryDecayBuckets
+{
+public:
+    explicit FMemoryDecayBuckets(float InBucketSeconds = 600.0f)
+        : BucketSeconds(InBucketSeconds)
+    {
+    }
+
+    void Reset();
+
+    /** File a handle under its expiry time (memories that never expire are ignored) */
+    void Add(int32 Handle, float ExpiryTime);
+
+    /** Unfile a handle; ExpiryTime must be the one it was added with */
+    void Remove(int32 Handle, float ExpiryTime);
+
+    /**
+     * Pop every bucket that ended at or before Now
+     * @return Number of handles appended to OutHandles
+     */
+    int32 PopExpired(float Now, TArray<int32>& OutHandles);
+
+    /**
+     * Pop up to MaxHandles of the soonest-expiring handles regardless of time (capacity trimming)
+     * @return Number of handles appended to OutHandles
+     */
+    int32 PopSoonest(int32 MaxHandles, TArray<int32>& OutHandles);
+
+    int32 Num() const { return NumHandles; }
+
+private:
+    static bool NeverExpires(float ExpiryTime) { return ExpiryTime >= TNumericLimits<float>::Max(); }
+    int32 GetBucket(float Time) const;
+
+    /** Discard heap keys whose bucket has been emptied by Remove */
+    void SkipEmptyBuckets();
+
+    /** Forget the positions of handles that were just popped */
+    void ClearPositions(TConstArrayView<int32> Handles);
+
+    float BucketSeconds;
+    TMap<int32, TArray<int32>> Buckets;
+    TArray<int32> BucketKeys; // Min-heap; may hold keys of buckets that Remove emptied
+    TArray<int32> Positions; // Handle -> index within its bucket, INDEX_NONE when unfiled
+    int32 NumHandles = 0;
+};
@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+struct FNarrativeMemory;
+struct FNarrativeContext;
+struct FActiveQuest;
+struct FActiveCompanion;
+
+/** Separately versioned sections of FNarrativeContext */
+enum class ENarrativeContextSection : uint8
+{
+    Memories,
+    Alignment,
+    Reputation,
+    Companions,
+    Quests,
+    Locations,
+
+    Count
+};
+
+/**
+ * Running aggregates behind UNarrativeMemoryComponent's cached FNarrativeContext.
+ *
+ * Memory, quest and companion events fold into the aggregates as they happen; Refresh only
+ * rewrites the context sections whose inputs changed since the last refresh and stamps each
+ * with its version, so prompt builders can re-serialize just the sections that moved.
+ * RelevantMemories depends on the caller's query and is not cached here; its version only
+ * records that the memory set changed.
+ */
+class KOTOR_CLONE_API FNarrativeContextAggregates
+{
+public:
+    void Reset();
+
+    /** Fold a memory in (Sign = 1) or back out (Sign = -1, on removal or before an update) */
+    void ApplyMemory(const FNarrativeMemory& Memory, int32 Sign);
+
+    void OnQuestStarted(const FActiveQuest& Quest);
+    void OnQuestEnded(const FActiveQuest& Quest); // Completed or failed
+    void OnCompanionChanged(const FActiveCompanion& Companion);
+
+    /** Rewrite the sections of Context that changed since the last refresh */
+    void Refresh(FNarrativeContext& Context);
+
+    bool IsDirty() const { return DirtySections != 0; }
+
+    /** Current alignment description, without waiting for a refresh */
+    FString GetAlignmentSummary() const;
+
+    /** How one NPC regards the player, from the memories they took part in ("unknown" if none) */
+    FString GetReputationWith(const FString& NPC) const;
+    int32 GetVersion(ENarrativeContextSection Section) const { return Versions[static_cast<int32>(Section)]; }
+
+private:
+    struct FReputationTally
+    {
+        float Sum = 0.0f;
+        int32 Count = 0;
+    };
+
+    /** Distinct locations kept for the location history, newest first */
+    static constexpr int32 MaxRecentLocations = 5;
+
+    void MarkDirty(ENarrativeContextSection Section);
+
+    FString BuildReputationSummary() const;
+
+    // Alignment: mean AlignmentImpact over all memories
+    double AlignmentSum = 0.0;
+    int32 AlignmentCount = 0;
+
+    // Reputation: EmotionalWeight of memories involving each NPC
+    TMap<FString, FReputationTally> ReputationByNPC;
+    FReputationTally OverallReputation;
+
+    TMap<FString, FString> CompanionStatus;
+    TArray<TPair<FString, FString>> ActiveQuests; // QuestID -> context line, in start order
+
+    TArray<FString, TInlineAllocator<MaxRecentLocations>> RecentLocations;
+
+    int32 Versions[static_cast<int32>(ENarrativeContextSection::Count)] = {};
+    uint32 DirtySections = 0;
+};
@@ -7,6 +7,9 @@
 #include "AIDM/CampaignLoaderSubsystem.h"
 #include "AIDM/QuestManagerComponent.h"
 #include "Companions/CompanionManagerComponent.h"
+#include "Narrative/NarrativeMemoryIndex.h"
+#include "Narrative/NarrativeContextAggregates.h"
+#include "AIDM/SaveGameContainer.h"
 #include "NarrativeMemoryComponent.generated.h"
 
 /**
@@ -133,11 +136,36 @@ struct KOTOR_CLONE_API FNarrativeContext
     UPROPERTY(BlueprintReadWrite, Category = "Context")
     TMap<FString, float> EmotionalState; // Current emotional context
 
+    // Section version stamps; a section only needs re-serializing when its stamp moves
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 MemoryVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 AlignmentVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 ReputationVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 CompanionVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 QuestVersion;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    int32 LocationVersion;
+
     FNarrativeContext()
     {
         PlayerAlignment = TEXT("neutral");
         ReputationSummary = TEXT("unknown");
         LocationHistory = TEXT("");
+        MemoryVersion = 0;
+        AlignmentVersion = 0;
+        ReputationVersion = 0;
+        CompanionVersion = 0;
+        QuestVersion = 0;
+        LocationVersion = 0;
     }
 };
 
@@ -161,6 +189,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -210,6 +239,14 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Narrative Memory")
     FNarrativeMemory GetMemory(const FString& MemoryID) const;
 
+    /**
+     * Get a memory's importance after decay
+     * @param MemoryID ID of the memory
+     * @return Importance as of now (Trivial if not found)
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Narrative Memory")
+    EMemoryImportance GetEffectiveImportance(const FString& MemoryID) const;
+
     /**
      * Search memories by criteria
      * @param EventType Filter by event type (optional)
@@ -281,6 +318,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Narrative Memory")
     bool LoadMemoryData(const FString& SaveData);
 
+    /**
+     * Write memories into their chunk of a binary save container (NarrativeMemorySaveChunk::Write)
+     * Skips encoding entirely if no memory was added, changed or forgotten since the chunk was last
+     * written to or read from this container
+     */
+    void WriteSaveChunk(FSaveGameContainer& Container) const;
+
+    /**
+     * Load memories from a binary save container, then rebuild MemoryIndex and ContextAggregates.
+     * The rebuild also runs when the chunk is missing or corrupt, so read this after the quest and
+     * companion chunks to pick up their restored state.
+     * @return True if the narrative memory chunk was present and decoded
+     */
+    bool ReadSaveChunk(const FSaveGameContainer& Container);
+
     /**
      * Get memory statistics
      * @return Map of statistics (total memories, by type, etc.)
@@ -288,6 +340,9 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Narrative Memory")
     TMap<FString, int32> GetMemoryStatistics() const;
 
+    /** Cached context; compare its section versions to skip re-serializing unchanged sections */
+    const FNarrativeContext& GetCachedContext() const { return CachedContext; }
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Memory Events")
     FOnMemoryAdded OnMemoryAdded;
@@ -299,10 +354,13 @@ public:
     FOnContextGenerated OnContextGenerated;
 
 protected:
-    // Memory storage
+    // Memory storage (unordered; mutate through MemoryIndex)
     UPROPERTY(BlueprintReadOnly, Category = "Narrative Memory")
     TArray<FNarrativeMemory> Memories;
 
+    // ID lookup, chronological search postings and decay buckets over Memories
+    FNarrativeMemoryIndex MemoryIndex;
+
     // Component references
     UPROPERTY()
     UQuestManagerComponent* QuestManagerRef;
@@ -330,21 +388,25 @@ protected:
     UPROPERTY()
     FNarrativeContext CachedContext;
 
+    // Running inputs for CachedContext, fed by AddMemory and the quest/companion handlers
+    FNarrativeContextAggregates ContextAggregates;
+
     UPROPERTY()
     float LastContextUpdate;
 
+    // Bumped whenever a memory is added, updated or forgotten
+    FSaveChunkRevision SaveRevision;
+
 private:
     // Helper methods
     FString GenerateMemoryID();
-    void CleanupOldMemories();
+    float GetMemoryTime() const; // World time memories are stamped and decayed with
+    void CleanupOldMemories(); // Expires decayed buckets, then trims to MaxMemories
     float CalculateMemoryRelevance(const FNarrativeMemory& Memory, const FString& ContextType, 
                                   const FString& NPCName, const FString& Location) const;
-    void UpdateCachedContext();
-    FString GenerateAlignmentSummary() const;
-    FString GenerateReputationSummary() const;
-    TMap<FString, FString> GenerateCompanionRelationshipSummary() const;
-    TArray<FString> GenerateActiveQuestContext() const;
-    FString GenerateLocationHistory() const;
+    void UpdateCachedContext(); // ContextAggregates.Refresh: rewrites only the sections that changed
+    void RebuildDerivedState(); // After Memories is replaced wholesale: re-index and re-fold the aggregates
+    void BindTrackedComponents(bool bBind);
 
     // Auto-tracking event handlers
     UFUNCTION()
@@ -353,6 +415,9 @@ private:
     UFUNCTION()
     void OnQuestCompleted(const FActiveQuest& Quest);
 
+    UFUNCTION()
+    void OnQuestFailed(const FActiveQuest& Quest);
+
     UFUNCTION()
     void OnCompanionLoyaltyChanged(const FActiveCompanion& Companion);
 
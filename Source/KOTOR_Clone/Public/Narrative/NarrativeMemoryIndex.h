@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Narrative/MemoryDecayBuckets.h"
+
+// Forward declarations
+struct FNarrativeMemory;
+enum class EMemoryEventType : uint8;
+enum class EMemoryImportance : uint8;
+
+/** Criteria for FNarrativeMemoryIndex::Search; every criterion that is set must match */
+struct FNarrativeMemorySearch
+{
+    TOptional<EMemoryEventType> EventType;
+    EMemoryImportance MinImportance = {}; // Compared against the decayed importance at Now
+    TArray<FString> Tags;                 // Memory must carry all of them
+    TArray<FString> Participants;         // ... and involve all of these NPCs
+    int32 MaxResults = MAX_int32;
+    float Now = 0.0f;
+};
+
+/**
+ * Index over UNarrativeMemoryComponent::Memories.
+ *
+ * The component keeps owning the array (it is the reflected, saved copy); every mutation goes
+ * through this index so it can keep the MemoryID -> slot map and the decay buckets in step.
+ * Removal swaps the last memory into the hole, so Memories is not in chronological order -
+ * readers that need an order sort by Timestamp.
+ *
+ * Importance decays lazily from the creation time at DecayRate levels per in-game hour;
+ * Critical and Legendary memories never decay. A memory expires once it would decay below
+ * Trivial, and ExpireMemories drops those by whole bucket.
+ *
+ * Each indexed memory gets an ID local to the index (reused after removal), and is filed under
+ * an order key of (Timestamp, local ID). Searches run over inverted posting lists (tag,
+ * participant NPC, event type, plus one list holding every memory) kept sorted by order key, so
+ * intersecting them smallest-first walks matches newest first and recency queries are a binary
+ * search on the all-memories list.
+ */
+class KOTOR_CLONE_API FNarrativeMemoryIndex
+{
+public:
+    /** Re-index an existing array (after loading), dropping duplicate IDs */
+    void Rebuild(TArray<FNarrativeMemory>& Memories, float InDecayRate);
+
+    void Reset();
+
+    /** Append a memory, or overwrite the one with the same MemoryID; returns its slot */
+    int32 Add(TArray<FNarrativeMemory>& Memories, const FNarrativeMemory& Memory);
+
+    /** Overwrite a slot, re-filing it if its age, importance or search terms changed */
+    void Update(TArray<FNarrativeMemory>& Memories, int32 Slot, const FNarrativeMemory& Memory);
+
+    /** Swap-remove a slot */
+    void RemoveAt(TArray<FNarrativeMemory>& Memories, int32 Slot);
+
+    int32 FindSlot(const FString& MemoryID) const;
+
+    /** Drop every memory that has decayed below Trivial by Now; cost scales with the number dropped */
+    int32 ExpireMemories(TArray<FNarrativeMemory>& Memories, float Now);
+    int32 ExpireMemories(TArray<FNarrativeMemory>& Memories, float Now, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved);
+
+    /** Drop the memories closest to expiring until at most MaxMemories remain (never-decaying ones are kept) */
+    int32 TrimToCount(TArray<FNarrativeMemory>& Memories, int32 MaxMemories);
+    int32 TrimToCount(TArray<FNarrativeMemory>& Memories, int32 MaxMemories, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved);
+
+    /**
+     * Slots of memories matching every criterion, newest first
+     * @return Number of slots appended to OutSlots
+     */
+    int32 Search(const TArray<FNarrativeMemory>& Memories, const FNarrativeMemorySearch& Criteria, TArray<int32>& OutSlots) const;
+
+    /**
+     * Slots of memories formed within TimeWindow seconds of Now, newest first
+     * @return Number of slots appended to OutSlots
+     */
+    int32 GetRecent(const TArray<FNarrativeMemory>& Memories, float Now, float TimeWindow, int32 MaxResults, TArray<int32>& OutSlots) const;
+
+    EMemoryImportance GetEffectiveImportance(const FNarrativeMemory& Memory, float Now) const;
+    float GetExpiryTime(const FNarrativeMemory& Memory) const;
+
+    float GetDecayRate() const { return DecayRate; }
+
+private:
+    enum class EPostingKind : uint8
+    {
+        Tag,
+        Participant,
+        EventType,
+        All
+    };
+
+    using FPostingKeys = TArray<uint64, TInlineAllocator<16>>;
+
+    static uint64 MakePostingKey(EPostingKind Kind, int32 Id) { return (static_cast<uint64>(Kind) << 32) | static_cast<uint32>(Id); }
+
+    /** Sorts by timestamp, then local ID; unsigned comparison of the result matches float order */
+    static uint64 MakeOrderKey(float Timestamp, int32 Id);
+    static int32 GetOrderKeyId(uint64 OrderKey) { return static_cast<int32>(static_cast<uint32>(OrderKey)); }
+
+    uint64 GetOrderKey(const TArray<FNarrativeMemory>& Memories, int32 Slot) const;
+
+    /** Local ID for a memory at Slot, taken from the free list when one is available */
+    int32 AllocateId(const FString& MemoryID, int32 Slot);
+    void FreeId(const FString& MemoryID, int32 Id);
+
+    /** Posting keys for a memory's terms; with bIntern false, unknown tags and NPCs are skipped */
+    void GatherPostingKeys(const FNarrativeMemory& Memory, bool bIntern, FPostingKeys& OutKeys);
+
+    void IndexTerms(const FNarrativeMemory& Memory, uint64 OrderKey);
+    void UnindexTerms(const FNarrativeMemory& Memory, uint64 OrderKey);
+
+    /** Swap-remove a slot and re-point the memory moved into it; the caller has already unfiled it */
+    void RemoveSlot(TArray<FNarrativeMemory>& Memories, int32 Slot);
+
+    /** Remove the memories for a batch of popped local IDs */
+    int32 RemoveIds(TArray<FNarrativeMemory>& Memories, TArrayView<const int32> Ids, TFunctionRef<void(const FNarrativeMemory&)> OnRemoved);
+
+    float DecayRate = 0.0f;
+
+    // Local IDs: decay buckets and postings use them, and they survive the swaps in RemoveAt
+    TMap<FString, int32> IdLookup; // MemoryID -> local ID, case-insensitive
+    TArray<int32> SlotById;        // INDEX_NONE for free IDs
+    TArray<int32> FreeIds;
+    TArray<int32> SlotIds;         // Parallel to Memories; INDEX_NONE for memories without an ID
+    FMemoryDecayBuckets DecayBuckets;
+    TArray<int32> ExpiredScratch;
+
+    // Posting lists of order keys, each sorted ascending
+    TMap<uint64, TArray<uint64>> Postings;
+    TMap<FString, int32> TagLookup;         // Case-insensitive, like the FString comparisons it replaces
+    TMap<FString, int32> ParticipantLookup;
+};
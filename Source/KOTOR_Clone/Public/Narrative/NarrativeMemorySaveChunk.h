@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+struct FNarrativeMemory;
+class FSaveGameContainer;
+
+/**
+ * Narrative memory chunk of the binary save container.
+ *
+ * Memories are written in (Timestamp, MemoryID) order rather than array order: the timestamp
+ * deltas stay small, and the same set of memories always encodes to the same bytes, so a save
+ * after swap-removals that changed nothing else leaves the chunk clean.
+ */
+namespace NarrativeMemorySaveChunk
+{
+    static constexpr uint32 Version = 1;
+
+    KOTOR_CLONE_API void Write(const TArray<FNarrativeMemory>& Memories, FSaveGameContainer& Container);
+
+    /**
+     * Decode the narrative memory chunk
+     * @return False if the chunk is missing or corrupt; OutMemories is only replaced on success
+     */
+    KOTOR_CLONE_API bool Read(const FSaveGameContainer& Container, TArray<FNarrativeMemory>& OutMemories);
+}
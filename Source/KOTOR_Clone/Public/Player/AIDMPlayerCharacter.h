@@ -7,6 +7,7 @@
 #include "AIDM/CampaignLoaderSubsystem.h"
 #include "AIDM/AIDirectorComponent.h"
 #include "AIDM/QuestManagerComponent.h"
+#include "AIDM/SaveGameContainer.h"
 #include "UI/DialogueWidget.h"
 #include "Debug/AIDMDebugWidget.h"
 #include "AIDMPlayerCharacter.generated.h"
@@ -169,6 +170,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AIDM")
     void TravelToLayout(const FString& LayoutName);
 
+    /**
+     * Save quests, companions, memories and the timeline to a slot
+     * @param SlotName Save slot; becomes the file name under Saved/SaveGames
+     * @return True if the file was written
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM")
+    bool SaveGameToSlot(const FString& SlotName);
+
+    /**
+     * Load a slot written by SaveGameToSlot
+     * @param SlotName Save slot to load
+     * @return True if the file was read; subsystems whose chunk is missing or corrupt keep their state
+     */
+    UFUNCTION(BlueprintCallable, Category = "AIDM")
+    bool LoadGameFromSlot(const FString& SlotName);
+
 protected:
     // AIDM Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AIDM")
@@ -225,6 +242,9 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction")
     float InteractionRange;
 
+    // Kept between saves so subsystems that have not changed reuse their encoded chunks
+    FSaveGameContainer SaveGameContainer;
+
 private:
     // Input handlers
     void OnDebugToggle();
@@ -236,6 +256,7 @@ private:
     void UpdateInteractable();
     AActor* FindNearestInteractable();
     bool IsActorInteractable(AActor* Actor) const;
+    FString GetSaveSlotPath(const FString& SlotName) const;
 
     // Event handlers
     UFUNCTION()
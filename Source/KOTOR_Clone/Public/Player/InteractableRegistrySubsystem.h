@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "InteractableRegistrySubsystem.generated.h"
+
+// Forward declarations
+class AActor;
+
+/**
+ * Interactable Registry - spatial hash of the actors the player can interact with.
+ *
+ * NPCs, loot pickups, chests, shrines and echo volumes (plus anything tagged "NPC" or
+ * "Interactable") register when they enter the world and unregister when destroyed.
+ * Nearest-interactable queries only visit the grid cells overlapping the query radius.
+ * Cells are 2D (XY); distances are still measured in 3D.
+ */
+UCLASS()
+class KOTOR_CLONE_API UInteractableRegistrySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UInteractableRegistrySubsystem();
+
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * Add an actor to the registry (no-op if already registered)
+     * @param Actor Actor the player can interact with
+     */
+    UFUNCTION(BlueprintCallable, Category = "Interaction")
+    void RegisterInteractable(AActor* Actor);
+
+    /**
+     * Remove an actor from the registry
+     * @param Actor Previously registered actor
+     */
+    UFUNCTION(BlueprintCallable, Category = "Interaction")
+    void UnregisterInteractable(AActor* Actor);
+
+    /**
+     * Find the nearest registered actor within range
+     * @param Location Query origin
+     * @param Range Maximum distance
+     * @param IgnoreActor Actor to skip (usually the querying pawn)
+     * @return Nearest actor, or null if none is in range
+     */
+    UFUNCTION(BlueprintCallable, Category = "Interaction")
+    AActor* FindNearestInteractable(const FVector& Location, float Range, AActor* IgnoreActor = nullptr) const;
+
+    /** Number of registered actors */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Interaction")
+    int32 GetNumInteractables() const { return RegisteredCells.Num(); }
+
+    /** True for the actor types and tags that register automatically */
+    static bool ShouldAutoRegister(const AActor* Actor);
+
+private:
+    // Grid cell edge length (cm); roughly the player interaction range
+    float CellSize;
+
+    // Cell -> actors whose location falls inside it
+    TMap<FIntPoint, TArray<TWeakObjectPtr<AActor>>> Cells;
+
+    // Registered actor -> the cell it is filed under
+    TMap<TObjectKey<AActor>, FIntPoint> RegisteredCells;
+
+    // Registered actors that can move (re-bucketed in Tick)
+    TArray<TWeakObjectPtr<AActor>> MovableActors;
+
+    FDelegateHandle ActorSpawnedHandle;
+
+    FIntPoint GetCell(const FVector& Location) const;
+    void RemoveFromCell(const FIntPoint& Cell, const AActor* Actor);
+    void HandleActorSpawned(AActor* Actor);
+
+    UFUNCTION()
+    void HandleActorDestroyed(AActor* DestroyedActor);
+};
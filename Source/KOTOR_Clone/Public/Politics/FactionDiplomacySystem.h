@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "AIDM/CampaignLoaderSubsystem.h"
+#include "AIDM/AIDMSymbolTable.h"
+#include "Politics/FactionRelationMatrix.h"
+#include "Politics/TerritoryControlIndex.h"
 #include "Narrative/NarrativeMemoryComponent.h"
 #include "FactionDiplomacySystem.generated.h"
 
@@ -51,6 +54,10 @@ struct KOTOR_CLONE_API FFactionData
     UPROPERTY(BlueprintReadWrite, Category = "Faction")
     FString FactionID;
 
+    // Interned FactionID used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Faction")
+    FAIDMId FactionSymbol;
+
     UPROPERTY(BlueprintReadWrite, Category = "Faction")
     FString FactionName;
 
@@ -158,6 +165,10 @@ struct KOTOR_CLONE_API FPlayerReputation
     UPROPERTY(BlueprintReadWrite, Category = "Player Reputation")
     FString FactionID;
 
+    // Interned FactionID used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Player Reputation")
+    FAIDMId FactionSymbol;
+
     UPROPERTY(BlueprintReadWrite, Category = "Player Reputation")
     int32 ReputationValue; // -100 to 100
 
@@ -247,6 +258,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -385,6 +397,49 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Faction Diplomacy")
     int32 GetFactionInfluenceOnPlanet(const FString& FactionID, const FString& Planet) const;
 
+    /**
+     * O(1) stance lookup for combat and dialogue (interned faction IDs, see FAIDMSymbolTable)
+     * @return Neutral if either faction is unknown
+     */
+    EDiplomaticStance GetDiplomaticStance(FAIDMId FactionA, FAIDMId FactionB) const { return RelationMatrix.GetStance(FactionA, FactionB); }
+
+    /** O(1) war check for combat and dialogue (interned faction IDs) */
+    bool AreFactionsAtWar(FAIDMId FactionA, FAIDMId FactionB) const { return RelationMatrix.AreAtWar(FactionA, FactionB); }
+
+    /** Dense stance/value table behind the relationship queries (read-only) */
+    const FFactionRelationMatrix& GetRelationMatrix() const { return RelationMatrix; }
+
+    /**
+     * Factions controlling a territory - a hash lookup that does not allocate.
+     * The view is invalidated by the next territory change.
+     * @param Territory Interned planet/layout name (EAIDMSymbolKind::Planet)
+     */
+    TConstArrayView<FAIDMId> GetTerritoryControllers(FAIDMId Territory) const { return TerritoryIndex.GetControllers(Territory); }
+
+    /** Territories a faction controls (view, see GetTerritoryControllers) */
+    TConstArrayView<FAIDMId> GetControlledTerritories(FAIDMId Faction) const { return TerritoryIndex.GetTerritories(Faction); }
+
+    /** Bidirectional territory <-> faction index (read-only) */
+    const FTerritoryControlIndex& GetTerritoryIndex() const { return TerritoryIndex; }
+
+    /**
+     * Hand a territory to a faction, keeping the index, TerritoryControl records and
+     * FFactionData::ControlledTerritories in step. Used by TransferTerritoryControl and by
+     * UWorldStateSimulator::ChangePlanetControl.
+     * @param FromFaction Controller losing the territory (empty = every current controller)
+     */
+    void ApplyTerritoryTransfer(const FString& Territory, const FString& FromFaction, const FString& ToFaction);
+
+    /**
+     * Headless diplomacy for world fast-forward. Between Begin and End, each StepDiplomacyHeadless
+     * call runs one round of relationship drift over every faction pair without Blueprint events,
+     * delegates or proposed actions. EndHeadlessSimulation then broadcasts OnDiplomaticStanceChanged
+     * once per pair whose stance changed.
+     */
+    void BeginHeadlessSimulation();
+    int32 StepDiplomacyHeadless(uint32 Seed, uint32 StepIndex); // Returns stance changes this round
+    void EndHeadlessSimulation();
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Faction Events")
     FOnDiplomaticStanceChanged OnDiplomaticStanceChanged;
@@ -403,9 +458,14 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Faction Diplomacy")
     TArray<FFactionData> Factions;
 
+    // Treaties, conflicts and history per pair; Stance and RelationshipValue are mirrored from
+    // RelationMatrix by SyncRelationshipRecords (the matrix is authoritative)
     UPROPERTY(BlueprintReadOnly, Category = "Faction Diplomacy")
     TArray<FDiplomaticRelationship> DiplomaticRelationships;
 
+    // Dense stance/value table for every faction pair
+    FFactionRelationMatrix RelationMatrix;
+
     UPROPERTY(BlueprintReadOnly, Category = "Faction Diplomacy")
     TArray<FPlayerReputation> PlayerReputations;
 
@@ -427,6 +487,9 @@ protected:
      */
     TArray<FString> TerritoryControl; 
 
+    // Query-side view of TerritoryControl, kept in step incrementally
+    FTerritoryControlIndex TerritoryIndex;
+
     // Component references
     UPROPERTY()
     UCampaignLoaderSubsystem* CampaignLoaderRef;
@@ -444,18 +507,29 @@ protected:
     // Timer handles
     FTimerHandle DiplomacyTimer;
 
+    // Matrix slot pairs (A < B) whose stance changed during a headless run
+    TSet<FIntPoint> HeadlessChangedPairs;
+    bool bHeadlessSimulation = false;
+
 private:
     // Helper methods
     void LoadFactionsFromCampaign();
     void InitializeDiplomaticRelationships();
     FFactionData* FindFaction(const FString& FactionID);
+    FFactionData* FindFaction(FAIDMId FactionSymbol);
     FDiplomaticRelationship* FindRelationship(const FString& FactionA, const FString& FactionB);
     FPlayerReputation* FindPlayerReputation(const FString& FactionID);
+    FPlayerReputation* FindPlayerReputation(FAIDMId FactionSymbol);
     FDiplomaticAction* FindAction(const FString& ActionID);
-    EDiplomaticStance CalculateDiplomaticStance(int32 RelationshipValue);
-    FString CalculateReputationTitle(int32 ReputationValue);
+    EDiplomaticStance CalculateDiplomaticStance(int32 RelationshipValue) const;
+    FString CalculateReputationTitle(int32 ReputationValue) const;
     void ProcessAutomaticDiplomacy();
+    void RebuildRelationMatrix(); // Slots for Factions, cells from DiplomaticRelationships
+    void SyncRelationshipRecords(); // Copy matrix stance/value back into DiplomaticRelationships
+    void RebuildTerritoryIndex(); // From TerritoryControl records and FFactionData::ControlledTerritories
+    void RemoveFactionTerritories(FAIDMId Faction); // Drop a removed faction from the index and records
     FString GenerateActionID();
+    void HandleSymbolsReset(); // Faction symbols are campaign-scoped; re-intern after a campaign load
 
     // Event handlers
     UFUNCTION()
@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/AIDMSymbolTable.h"
+
+// Forward declarations
+enum class EDiplomaticStance : uint8;
+
+/**
+ * Stance and value of one faction pair, packed into two bytes
+ */
+struct FFactionRelationCell
+{
+    int8 Value = 0;                         // -100 to 100
+    EDiplomaticStance Stance = {};          // The matrix initializes cells to Neutral
+};
+
+static_assert(sizeof(FFactionRelationCell) == 2, "FFactionRelationCell should stay packed");
+
+/**
+ * Faction relation matrix - dense N x N table of diplomatic stance and value.
+ *
+ * Every faction gets a slot; the pair (A, B) lives at Cells[Min * Stride + Max], so a stance
+ * or war check is an array lookup with no hashing or string compares. Relationships have no
+ * direction (like FDiplomaticRelationship), so only the upper triangle is used.
+ * FDiplomaticRelationship records are still kept for treaties, conflicts and history; each
+ * cell remembers the index of its record, if it has one.
+ *
+ * Slots of removed factions are cleared and reused. Sweeps walk the upper triangle row by
+ * row, i.e. linearly through memory.
+ */
+class KOTOR_CLONE_API FFactionRelationMatrix
+{
+public:
+    /** Drop every faction */
+    void Reset();
+
+    /**
+     * Give a faction a slot (interning its ID); all its pairs start neutral
+     * @return Slot of the faction (its existing slot if already present)
+     */
+    int32 AddFaction(const FString& FactionID);
+
+    /** Clear a faction's row and column and free its slot */
+    void RemoveFaction(FAIDMId Faction);
+
+    /** Slot for a faction, or INDEX_NONE */
+    int32 FindSlot(FAIDMId Faction) const
+    {
+        return SlotBySymbol.IsValidIndex(Faction.Index) ? SlotBySymbol[Faction.Index] : INDEX_NONE;
+    }
+
+    /** Faction in a slot (invalid for free slots) */
+    FAIDMId GetFaction(int32 Slot) const { return SlotFactions[Slot]; }
+
+    /** Stable hash of the faction ID in a slot (seeds per-pair random streams) */
+    uint32 GetSlotHash(int32 Slot) const { return SlotHashes[Slot]; }
+
+    /** Number of slots (including free ones) */
+    int32 NumSlots() const { return Stride; }
+
+    const FFactionRelationCell& GetCell(int32 SlotA, int32 SlotB) const { return Cells[CellIndex(SlotA, SlotB)]; }
+
+    void SetRelationship(int32 SlotA, int32 SlotB, int32 Value, EDiplomaticStance Stance);
+
+    /** Index into the FDiplomaticRelationship records, or INDEX_NONE */
+    int32 GetRecordIndex(int32 SlotA, int32 SlotB) const { return RecordIndices[CellIndex(SlotA, SlotB)]; }
+    void SetRecordIndex(int32 SlotA, int32 SlotB, int32 RecordIndex);
+
+    /** Stance between two factions (Neutral if either is unknown, Allied for a faction with itself) */
+    EDiplomaticStance GetStance(FAIDMId FactionA, FAIDMId FactionB) const;
+
+    /** Relationship value between two factions (0 if either is unknown) */
+    int32 GetValue(FAIDMId FactionA, FAIDMId FactionB) const;
+
+    /** True if the two factions are hostile */
+    bool AreAtWar(FAIDMId FactionA, FAIDMId FactionB) const;
+
+    /**
+     * Visit every pair of live factions once (SlotA < SlotB), in memory order.
+     * The callback may modify the cell.
+     * @param Func void(int32 SlotA, int32 SlotB, FFactionRelationCell& Cell)
+     */
+    template <typename FuncType>
+    void SweepPairs(FuncType&& Func)
+    {
+        for (int32 SlotA = 0; SlotA < Stride; ++SlotA)
+        {
+            if (!SlotFactions[SlotA].IsValid())
+            {
+                continue;
+            }
+
+            FFactionRelationCell* Row = Cells.GetData() + SlotA * Stride;
+            for (int32 SlotB = SlotA + 1; SlotB < Stride; ++SlotB)
+            {
+                if (SlotFactions[SlotB].IsValid())
+                {
+                    Func(SlotA, SlotB, Row[SlotB]);
+                }
+            }
+        }
+    }
+
+private:
+    int32 CellIndex(int32 SlotA, int32 SlotB) const { return FMath::Min(SlotA, SlotB) * Stride + FMath::Max(SlotA, SlotB); }
+
+    void Grow(int32 NewStride);
+    void ClearSlot(int32 Slot);
+
+    int32 Stride = 0;
+
+    // Stride x Stride, row-major; only the upper triangle and diagonal are used
+    TArray<FFactionRelationCell> Cells;
+    TArray<int32> RecordIndices;
+
+    // Slot -> faction, and the hash of its ID
+    TArray<FAIDMId> SlotFactions;
+    TArray<uint32> SlotHashes;
+
+    // Faction symbol index -> slot (symbols are dense, so this is an array)
+    TArray<int32> SlotBySymbol;
+
+    TArray<int32> FreeSlots;
+};
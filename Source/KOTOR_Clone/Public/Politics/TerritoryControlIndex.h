@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/AIDMSymbolTable.h"
+
+/**
+ * Territory control index - bidirectional territory <-> faction lookup.
+ *
+ * Territories are interned as planet symbols, factions as faction symbols. Both directions
+ * are hash lookups that return views into the index, so queries never allocate; the views
+ * are invalidated by the next change to the index. Updates are incremental (one territory or
+ * faction at a time); the flattened "TerritoryID::FactionID" records kept for UPROPERTY
+ * serialization are only parsed by a full rebuild.
+ */
+class KOTOR_CLONE_API FTerritoryControlIndex
+{
+public:
+    /** Drop everything */
+    void Reset();
+
+    /** Add a controller to a territory (territories may be contested by several factions) */
+    void AddControl(FAIDMId Territory, FAIDMId Faction);
+
+    /** Remove one controller from a territory */
+    void RemoveControl(FAIDMId Territory, FAIDMId Faction);
+
+    /** Make a faction the sole controller of a territory */
+    void SetController(FAIDMId Territory, FAIDMId Faction);
+
+    /** Remove a faction from every territory it controls */
+    void RemoveFaction(FAIDMId Faction);
+
+    /** Factions controlling a territory (empty if none) */
+    TConstArrayView<FAIDMId> GetControllers(FAIDMId Territory) const;
+
+    /** Territories a faction controls (empty if none) */
+    TConstArrayView<FAIDMId> GetTerritories(FAIDMId Faction) const;
+
+    /** First (longest-standing) controller of a territory, or an invalid ID */
+    FAIDMId GetPrimaryController(FAIDMId Territory) const;
+
+    bool IsControlledBy(FAIDMId Territory, FAIDMId Faction) const { return GetControllers(Territory).Contains(Faction); }
+
+    int32 NumTerritories() const { return ControllersByTerritory.Num(); }
+
+private:
+    // Most territories have one or two controllers and most factions a handful of territories
+    TMap<FAIDMId, TArray<FAIDMId, TInlineAllocator<2>>> ControllersByTerritory;
+    TMap<FAIDMId, TArray<FAIDMId, TInlineAllocator<8>>> TerritoriesByFaction;
+};
@@ -0,0 +1,234 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIDM/AIDMSymbolTable.h"
+
+// Forward declarations
+struct FPlanetWorldState;
+enum class EPlanetState : uint8;
+enum class EEconomicState : uint8;
+enum class EWeatherPattern : uint8;
+
+/**
+ * Planet simulation kernels - one pass over contiguous columns per rule.
+ *
+ * Each kernel only reads and writes the row it is on, has no branches or calls in the loop
+ * body and takes RESTRICT pointers, so the loops auto-vectorize. Values drift toward a target
+ * by Alpha (0 = no change, 1 = snap to target) and stay within 0..1.
+ */
+namespace PlanetSimulationKernels
+{
+    /** Resource availability follows security and morale, minus war/weather pressure */
+    KOTOR_CLONE_API void UpdateEconomy(float* RESTRICT Economy, const float* RESTRICT Security, const float* RESTRICT Morale,
+                                       const float* RESTRICT EconomyPressure, int32 Num, float Alpha);
+
+    /** Security follows the political state's baseline, nudged by civilian morale */
+    KOTOR_CLONE_API void UpdateSecurity(float* RESTRICT Security, const float* RESTRICT SecurityBaseline, const float* RESTRICT Morale,
+                                        int32 Num, float Alpha);
+
+    /** Morale follows economy and security, minus war/weather pressure */
+    KOTOR_CLONE_API void UpdateMorale(float* RESTRICT Morale, const float* RESTRICT Economy, const float* RESTRICT Security,
+                                      const float* RESTRICT MoralePressure, int32 Num, float Alpha);
+
+    /** Population grows on prosperous, content worlds and shrinks on failing ones */
+    KOTOR_CLONE_API void UpdatePopulation(float* RESTRICT Population, const float* RESTRICT Economy, const float* RESTRICT Morale,
+                                          int32 Num, float DeltaHours);
+}
+
+/**
+ * Additive change to a planet's simulated values (one galactic event's StateEffects)
+ */
+struct KOTOR_CLONE_API FPlanetStateEffect
+{
+    float Economy = 0.0f;
+    float Security = 0.0f;
+    float Morale = 0.0f;
+    float Population = 0.0f;   // Relative: -0.1 removes a tenth of the inhabitants
+
+    /**
+     * Resolve string-keyed effects ("Economy"/"ResourceAvailability", "Security"/"SecurityLevel",
+     * "Morale"/"CivilianMorale", "Population"; case-insensitive). Unknown keys are ignored.
+     */
+    static FPlanetStateEffect FromStateChanges(const TMap<FString, float>& StateChanges);
+};
+
+/**
+ * An effect and the rows it applies to
+ */
+struct FPlanetEffectSource
+{
+    FPlanetStateEffect Effect;
+    TArray<int32> Rows;
+};
+
+/**
+ * Inputs for one simulation step
+ */
+struct FPlanetSimulationStepParams
+{
+    /** In-game hours since the last step */
+    float DeltaHours = 1.0f;
+
+    /** Stamped into LastUpdateTime */
+    float CurrentTime = 0.0f;
+
+    /** Campaign simulation seed; with StepIndex and the planet name it seeds each planet's stream */
+    uint32 Seed = 0;
+
+    /** Monotonic step counter, so every step draws fresh numbers */
+    uint32 StepIndex = 0;
+
+    /** Chance per hour of a random event on a planet at 0.5 security (scaled by instability) */
+    float EventChancePerHour = 0.0f;
+
+    /** Spread row blocks across worker threads; results are identical either way */
+    bool bParallel = true;
+};
+
+/**
+ * A planet whose random event roll succeeded this step
+ */
+struct FPlanetEventRoll
+{
+    int32 Row = INDEX_NONE;
+
+    /** Uniform 0..1 draw from the planet's stream, for picking an event template */
+    float Selector = 0.0f;
+};
+
+/**
+ * Outputs of one simulation step, in row order
+ */
+struct FPlanetSimulationStepResult
+{
+    /** Rows whose economic condition changed */
+    TArray<int32> ChangedRows;
+
+    /** Rows that rolled a random event */
+    TArray<FPlanetEventRoll> EventRolls;
+};
+
+/**
+ * Planet simulation table - structure-of-arrays storage for UWorldStateSimulator.
+ *
+ * The values the tick touches (economy, security, morale, population and the modifiers
+ * derived from political state and weather) live in parallel float columns indexed by row,
+ * so a tick is a handful of linear passes no matter how many planets a campaign has.
+ * Everything else (names, faction, prices, events, history) sits in side tables that the
+ * tick never reads. FPlanetWorldState is only built on demand, as a façade for Blueprints
+ * and delegates.
+ *
+ * Rows are never reordered while a campaign runs; Reset() drops everything.
+ *
+ * Steps are deterministic: rows are processed in fixed-size blocks (independent of how many
+ * threads run them), every planet draws from its own random stream seeded by (Seed, StepIndex,
+ * planet name), and event effects are added to each row in event order. The same inputs give
+ * bit-identical columns whether the step runs on one thread or many.
+ */
+struct KOTOR_CLONE_API FPlanetSimulationTable
+{
+    /** Number of planets */
+    int32 Num() const { return Names.Num(); }
+
+    /** Drop every planet */
+    void Reset();
+
+    /**
+     * Add a planet, or overwrite it if a planet with the same name already exists
+     * @return Row of the planet
+     */
+    int32 AddPlanet(const FPlanetWorldState& State);
+
+    /**
+     * Add a planet under an already interned name. An invalid symbol adds an anonymous row that
+     * FindRow never returns (benchmarks use this to stay out of the campaign symbol table).
+     * @return Row of the planet
+     */
+    int32 AddPlanet(const FPlanetWorldState& State, FAIDMId Symbol);
+
+    /** Row for a planet, or INDEX_NONE */
+    int32 FindRow(FAIDMId PlanetSymbol) const;
+    int32 FindRow(const FString& PlanetName) const;
+
+    /** Assemble the façade struct for a row */
+    FPlanetWorldState GetRow(int32 Row) const;
+
+    /** Façade structs for every planet, in row order */
+    TArray<FPlanetWorldState> GetAllRows() const;
+
+    /** Write a façade struct back into its row (the planet name is kept) */
+    void SetRow(int32 Row, const FPlanetWorldState& State);
+
+    /** Add an effect to a row right away (outside a step), clamped like Step */
+    void ApplyEffect(int32 Row, const FPlanetStateEffect& Effect);
+
+    /** Append to a planet's recent history, dropping the oldest entries beyond MaxRecentHistory */
+    void AddHistory(int32 Row, const FString& Entry);
+
+    /** Re-intern every planet name after FAIDMSymbolTable::Reset() */
+    void RefreshSymbols();
+
+    /** Change political state or weather and refresh the derived modifier columns */
+    void SetPoliticalState(int32 Row, EPlanetState NewState);
+    void SetWeather(int32 Row, EWeatherPattern NewWeather);
+
+    /**
+     * Advance every planet: add event effects, run the economy, security, morale and
+     * population passes, re-derive economic conditions and roll random events
+     * @param Params Step inputs
+     * @param Effects Active event effects, in event order
+     * @param OutResult Receives changed rows and event rolls
+     */
+    void Step(const FPlanetSimulationStepParams& Params, TConstArrayView<FPlanetEffectSource> Effects, FPlanetSimulationStepResult& OutResult);
+
+    /** Hash of every simulated column, for checking that two runs match bit for bit */
+    uint32 ComputeChecksum() const;
+
+    /** Rows per block; fixed so results never depend on the worker count */
+    static constexpr int32 RowsPerBlock = 256;
+
+    /** Entries kept in RecentHistory per planet */
+    static constexpr int32 MaxRecentHistory = 10;
+
+    // Hot columns (one entry per row)
+    TArray<float> Economy;              // FPlanetWorldState::ResourceAvailability
+    TArray<float> Security;
+    TArray<float> Morale;
+    TArray<float> Population;
+
+    // Derived from PoliticalState + WeatherCondition by RefreshModifiers
+    TArray<float> SecurityBaseline;
+    TArray<float> EconomyPressure;
+    TArray<float> MoralePressure;
+
+    TArray<EPlanetState> PoliticalState;
+    TArray<EEconomicState> EconomicCondition;
+    TArray<EWeatherPattern> WeatherCondition;
+    TArray<float> LastUpdateTime;
+
+    // Stable per-planet seed (hash of the name), mixed into each step's random stream
+    TArray<uint32> RowSeeds;
+
+    // Side tables (not touched by Step)
+    TArray<FString> Names;
+    TArray<FAIDMId> Symbols;
+    TArray<FString> ControllingFaction;
+    TArray<TMap<FString, float>> PriceModifiers;
+    TArray<TArray<FString>> ActiveEvents;
+    TArray<TArray<FString>> RecentHistory;
+
+private:
+    void RefreshModifiers(int32 Row);
+    void StepBlock(int32 BlockIndex, const FPlanetSimulationStepParams& Params, TConstArrayView<FPlanetEffectSource> Effects);
+
+    // Per-step scratch, one entry per row (written by blocks, compacted afterwards)
+    TArray<int32> EffectOffsets;        // CSR: effects of row R are EffectIndices[EffectOffsets[R]..EffectOffsets[R + 1]]
+    TArray<int32> EffectIndices;
+    TArray<uint8> ConditionChanged;
+    TArray<float> EventSelectors;       // < 0 when no event was rolled
+
+    // Interned planet name -> row
+    TMap<FAIDMId, int32> RowBySymbol;
+};
@@ -7,6 +7,7 @@
 #include "AIDM/CampaignLoaderSubsystem.h"
 #include "Politics/FactionDiplomacySystem.h"
 #include "Narrative/NarrativeMemoryComponent.h"
+#include "Simulation/PlanetSimulationTable.h"
 #include "WorldStateSimulator.generated.h"
 
 /**
@@ -68,6 +69,10 @@ struct KOTOR_CLONE_API FPlanetWorldState
     UPROPERTY(BlueprintReadWrite, Category = "Planet State")
     FString PlanetName;
 
+    // Interned PlanetName used for lookups (session-local, never saved)
+    UPROPERTY(BlueprintReadOnly, Transient, Category = "Planet State")
+    FAIDMId PlanetSymbol;
+
     UPROPERTY(BlueprintReadWrite, Category = "Planet State")
     FString ControllingFaction; // Current faction in control
 
@@ -89,6 +94,9 @@ struct KOTOR_CLONE_API FPlanetWorldState
     UPROPERTY(BlueprintReadWrite, Category = "Planet State")
     float SecurityLevel; // 0.0 to 1.0
 
+    UPROPERTY(BlueprintReadWrite, Category = "Planet State")
+    float Population; // Millions of inhabitants
+
     UPROPERTY(BlueprintReadWrite, Category = "Planet State")
     TMap<FString, float> PriceModifiers; // Item type -> price multiplier
 
@@ -111,6 +119,7 @@ struct KOTOR_CLONE_API FPlanetWorldState
         CivilianMorale = 0.5f;
         ResourceAvailability = 0.5f;
         SecurityLevel = 0.5f;
+        Population = 1000.0f;
         LastUpdateTime = 0.0f;
     }
 };
@@ -165,12 +174,58 @@ struct KOTOR_CLONE_API FGalacticEvent
     }
 };
 
+/**
+ * Result of a headless fast-forward
+ */
+USTRUCT(BlueprintType)
+struct KOTOR_CLONE_API FWorldFastForwardReport
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    int32 StepsSimulated; // Simulation steps taken
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    float SimulatedHours; // In-game time covered
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    float WallSeconds; // Real time spent
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    float StepsPerSecond;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    int32 PlanetsChanged; // Distinct planets whose state changed (one notification each)
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    int32 EventsTriggered; // Galactic events started during the run
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    int32 EventsExpired; // Galactic events that ran their course
+
+    UPROPERTY(BlueprintReadOnly, Category = "Fast Forward")
+    int32 StanceChanges; // Faction stance changes (before collapsing per pair)
+
+    FWorldFastForwardReport()
+    {
+        StepsSimulated = 0;
+        SimulatedHours = 0.0f;
+        WallSeconds = 0.0f;
+        StepsPerSecond = 0.0f;
+        PlanetsChanged = 0;
+        EventsTriggered = 0;
+        EventsExpired = 0;
+        StanceChanges = 0;
+    }
+};
+
 /**
  * World simulation events
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlanetStateChanged, const FPlanetWorldState&, NewState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnGalacticEventTriggered, const FGalacticEvent&, Event);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFactionControlChanged, const FString&, Planet, const FString&, NewFaction);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWorldFastForwardCompleted, const FWorldFastForwardReport&, Report);
 
 /**
  * World State Simulator - Simulates dynamic galaxy state with factions, economy, and events
@@ -244,7 +299,10 @@ public:
      * @return Array of all planet world states
      */
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "World Simulation")
-    TArray<FPlanetWorldState> GetAllPlanetStates() const { return PlanetStates; }
+    TArray<FPlanetWorldState> GetAllPlanetStates() const { return PlanetTable.GetAllRows(); }
+
+    /** Column storage behind the planet façade (read-only) */
+    const FPlanetSimulationTable& GetPlanetTable() const { return PlanetTable; }
 
     /**
      * Get active galactic events
@@ -282,6 +340,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "World Simulation")
     void SetAutomaticSimulationEnabled(bool bEnabled);
 
+    /**
+     * Simulate the galaxy (planets, galactic events and faction diplomacy) as fast as the CPU allows.
+     * Runs headless: no actors, no Blueprint events, no per-step delegates. Listeners are notified
+     * once at the end (one OnPlanetStateChanged per changed planet, then OnWorldFastForwardCompleted).
+     * @param Days In-game days to simulate (stepped in UpdateInterval hours)
+     * @return Steps taken, in-game time covered and throughput
+     */
+    UFUNCTION(BlueprintCallable, Category = "World Simulation")
+    FWorldFastForwardReport FastForward(float Days);
+
+    /** True while FastForward is running */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "World Simulation")
+    bool IsFastForwarding() const { return bFastForwarding; }
+
+    /** In-game hours simulated since the campaign started (galactic event start/expiry clock) */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "World Simulation")
+    float GetSimulationHours() const { return SimulationStepIndex * FMath::Max(UpdateInterval, 0.01f); }
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "World Simulation Events")
     FOnPlanetStateChanged OnPlanetStateChanged;
@@ -292,8 +368,14 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "World Simulation Events")
     FOnFactionControlChanged OnFactionControlChanged;
 
+    UPROPERTY(BlueprintAssignable, Category = "World Simulation Events")
+    FOnWorldFastForwardCompleted OnWorldFastForwardCompleted;
+
 protected:
-    // World state data
+    // World state data; planets are stored column-wise, FPlanetWorldState is only a façade
+    FPlanetSimulationTable PlanetTable;
+
+    // Reflected copy of PlanetTable in row order, refreshed after each update (not per fast-forward step)
     UPROPERTY(BlueprintReadOnly, Category = "World Simulation")
     TArray<FPlanetWorldState> PlanetStates;
 
@@ -323,6 +405,26 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation Settings")
     float UpdateInterval; // Hours between updates
 
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation Settings")
+    int32 SimulationSeed = 0; // Same seed + same inputs = same galaxy, regardless of thread count
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation Settings")
+    bool bParallelSimulation = true; // Spread planet blocks across worker threads
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation Settings")
+    float RandomEventChancePerHour = 0.002f; // Per planet, at average security
+
+    // Steps taken since the campaign started; mixed into every planet's random stream. Every step,
+    // live or fast-forwarded, covers UpdateInterval hours, so this is also the simulation clock.
+    uint32 SimulationStepIndex = 0;
+
+    // Set for the duration of FastForward
+    bool bFastForwarding = false;
+
+    // Reused across steps so a long fast-forward does not allocate per step
+    TArray<FPlanetEffectSource> EffectScratch;
+    FPlanetSimulationStepResult StepResultScratch;
+
     // Timer handles
     FTimerHandle SimulationTimer;
 
@@ -345,12 +447,20 @@ private:
     void ProcessActiveEvents();
     void GenerateRandomEvents();
     void ApplyEventEffects(const FGalacticEvent& Event);
-    void UpdatePlanetEconomy(FPlanetWorldState& Planet);
-    void UpdatePlanetSecurity(FPlanetWorldState& Planet);
-    void UpdateCivilianMorale(FPlanetWorldState& Planet);
-    FPlanetWorldState* FindPlanetState(const FString& PlanetName);
+    void UpdatePlanets(float DeltaHours); // One FPlanetSimulationTable step, then change events and rolled events
+    FPlanetSimulationStepParams MakeStepParams(float DeltaHours) const;
+    void BuildEventEffects(float DeltaHours, TArray<FPlanetEffectSource>& OutEffects) const; // ActiveEvents -> row effects, in event order
+    void StepHeadless(float DeltaHours, TBitArray<>& DirtyRows, FWorldFastForwardReport& Report); // One fast-forward step, no notifications
+    int32 ExpireFinishedEvents(TBitArray<>& DirtyRows); // Move finished ActiveEvents to EventHistory
+    int32 StartRolledEvents(TConstArrayView<FPlanetEventRoll> Rolls, TBitArray<>& DirtyRows); // Create events from template picks, no notifications
+    int32 FindPlanetRow(const FString& PlanetName) const;
+    int32 FindPlanetRow(FAIDMId PlanetSymbol) const;
+    void NotifyPlanetChanged(int32 Row, const FPlanetWorldState& OldState);
+    void NotifyChangedRows(const TBitArray<>& ChangedRows); // Old states come from the PlanetStates view
+    void RefreshPlanetStatesView();
+    void RestartSimulationTimer();
+    void HandleSymbolsReset();
     FString GenerateEventID();
-    float CalculateEventProbability(const FString& EventType) const;
 
     // Event handlers
     UFUNCTION()
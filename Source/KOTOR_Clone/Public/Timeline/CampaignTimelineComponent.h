@@ -9,6 +9,7 @@
 #include "AIDM/QuestManagerComponent.h"
 #include "Narrative/NarrativeMemoryComponent.h"
 #include "Companions/CompanionManagerComponent.h"
+#include "AIDM/SaveGameContainer.h"
 #include "CampaignTimelineComponent.generated.h"
 
 /**
@@ -221,6 +222,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -334,6 +336,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Campaign Timeline")
     bool ImportTimelineData(const FString& TimelineData);
 
+    /**
+     * Write events and snapshots into their chunk of a binary save container (TimelineSaveChunk::Write)
+     * Skips encoding entirely if no event or snapshot was added or dropped since the chunk was last
+     * written to or read from this container
+     */
+    void WriteSaveChunk(FSaveGameContainer& Container) const;
+
+    /**
+     * Load events and snapshots from a binary save container
+     * @return True if the timeline chunk was present and decoded
+     */
+    bool ReadSaveChunk(const FSaveGameContainer& Container);
+
     /**
      * Get current game time
      * @return Current game time in seconds
@@ -383,7 +398,7 @@ public:
     FOnReplayEventPlayed OnReplayEventPlayed;
 
 protected:
-    // Timeline data
+    // Timeline data; events are kept sorted by Timestamp, oldest first
     UPROPERTY(BlueprintReadOnly, Category = "Campaign Timeline")
     TArray<FTimelineEvent> TimelineEvents;
 
@@ -427,15 +442,27 @@ protected:
     UPROPERTY()
     float ReplayStartTime;
 
+    UPROPERTY()
+    float ReplayCursor; // Campaign time the replay has reached
+
     UPROPERTY()
     float LastSnapshotTime;
 
+    // Copies of the replayed events in time order, so trimming the timeline cannot pull them out mid-replay
+    UPROPERTY()
+    TArray<FTimelineEvent> ReplayQueue;
+
     // Timer handles
     FTimerHandle SnapshotTimer;
     FTimerHandle ReplayTimer;
 
+    // Bumped whenever an event or snapshot is added or dropped
+    FSaveChunkRevision SaveRevision;
+
 private:
     // Helper methods
+    float GetTimelineTime() const; // World time events and snapshots are stamped with
+    void BindTrackedComponents(bool bBind);
     FString GenerateEventID();
     FString GenerateSnapshotID();
     FString GenerateSessionID();
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+struct FTimelineEvent;
+struct FWorldStateSnapshot;
+class FSaveGameContainer;
+
+/**
+ * Campaign timeline chunk of the binary save container.
+ *
+ * Events and snapshots are written in timeline order, so their timestamps delta-encode to a
+ * few bytes each; quest, companion and item names repeated across snapshots share one string
+ * table entry.
+ */
+namespace TimelineSaveChunk
+{
+    static constexpr uint32 Version = 1;
+
+    KOTOR_CLONE_API void Write(const TArray<FTimelineEvent>& Events, const TArray<FWorldStateSnapshot>& Snapshots, FSaveGameContainer& Container);
+
+    /**
+     * Decode the timeline chunk
+     * @return False if the chunk is missing or corrupt; the outputs are only replaced on success
+     */
+    KOTOR_CLONE_API bool Read(const FSaveGameContainer& Container, TArray<FTimelineEvent>& OutEvents, TArray<FWorldStateSnapshot>& OutSnapshots);
+}
@@ -11,6 +11,9 @@
 #include "AIDM/QuestManagerComponent.h"
 #include "DialogueWidget.generated.h"
 
+// Forward declarations
+class UVoiceSynthesisComponent;
+
 /**
  * Dialogue option data
  */
@@ -110,6 +113,14 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Dialogue")
     FNPCData GetCurrentNPCData() const { return CurrentNPCData; }
 
+    /**
+     * Voice NPC responses through a voice synthesis component.
+     * The responses to every available option are prefetched while the player is choosing.
+     * @param VoiceComponent Voice synthesis to use (null disables voiced dialogue)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Dialogue")
+    void SetVoiceSynthesis(UVoiceSynthesisComponent* VoiceComponent);
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Dialogue Events")
     FOnDialogueStarted OnDialogueStarted;
@@ -150,6 +161,9 @@ protected:
     UPROPERTY()
     UQuestManagerComponent* CurrentQuestManager;
 
+    UPROPERTY()
+    UVoiceSynthesisComponent* VoiceSynthesis;
+
     // Option button class for creating dialogue options
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|UI")
     TSubclassOf<class UButton> OptionButtonClass;
@@ -161,6 +175,7 @@ private:
     void ClearOptionButtons();
     FString GetGreetingText() const;
     bool IsOptionAvailable(const FDialogueOption& Option) const;
+    void PrefetchOptionResponses();
 
     UFUNCTION()
     void OnEndDialogueClicked();